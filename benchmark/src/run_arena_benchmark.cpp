@@ -0,0 +1,92 @@
+/*
+ * Times filling and scanning an ingest sized buffer on the heap and in each arena mode, with and without prefaulting.
+ * The first round of a mode pays for mapping and faulting its pages, later rounds reuse the cached region. Prints one
+ * CSV line per case to stdout, so results of two runs can be diffed to spot regressions.
+ *
+ * Usage: run_arena_benchmark [megabytes] [rounds]
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "vita_socket.cpp"
+
+/* Defaults for the buffer size and number of rounds per case */
+static const size_t DEFAULT_MEGABYTES = 64;
+static const int    DEFAULT_ROUNDS    = 10;
+
+/* Shared by all cases, so the compiler cannot drop the scans */
+static volatile uint64_t checksum;
+
+/* Times of each round in ms */
+template <typename Make>
+static std::vector<double> run(Make make, size_t bytes, int rounds) {
+    std::vector<double> times;
+    for (int round = 0; round < rounds; round++) {
+        auto start  = std::chrono::steady_clock::now();
+        auto buffer = make();
+        buffer.resize(bytes);
+        for (size_t i = 0; i < bytes; i += 64) {
+            buffer[i] = static_cast<uint8_t>(i);
+        }
+        uint64_t sum = 0;
+        for (size_t i = 0; i < bytes; i += 64) {
+            sum += buffer[i];
+        }
+        checksum = checksum + sum;
+        times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+    return times;
+}
+
+static void print(const char* mode, bool prefault, size_t megabytes, const std::vector<double>& times,
+                  bool fell_back) {
+    double warm = 0;
+    for (size_t round = 1; round < times.size(); round++) {
+        warm += times[round];
+    }
+    warm = times.size() > 1 ? warm / static_cast<double>(times.size() - 1) : times[0];
+    printf("%s,%d,%zu,%zu,%.2f,%.2f,%d\n", mode, prefault ? 1 : 0, megabytes, times.size(), times[0], warm,
+           fell_back ? 1 : 0);
+}
+
+int main(int argc, char** argv) {
+    size_t megabytes = DEFAULT_MEGABYTES;
+    int    rounds    = DEFAULT_ROUNDS;
+    if (argc > 3) {
+        fprintf(stderr, "Usage: %s [megabytes] [rounds]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (argc > 1) {
+        megabytes = strtoul(argv[1], nullptr, 10);
+        if (megabytes == 0) {
+            fprintf(stderr, "Invalid buffer size '%s'\n", argv[1]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (argc > 2) {
+        rounds = atoi(argv[2]);
+        if (rounds <= 0) {
+            fprintf(stderr, "Invalid number of rounds '%s'\n", argv[2]);
+            return EXIT_FAILURE;
+        }
+    }
+    const size_t bytes = megabytes * 1024 * 1024;
+
+    Arena& arena = Arena::instance();
+    printf("mode,prefault,megabytes,rounds,first_ms,warm_ms,fell_back\n");
+    print("heap", false, megabytes, run([] { return std::vector<uint8_t>(); }, bytes, rounds), false);
+    for (const char* mode : {"pages", "thp", "hugetlb"}) {
+        for (bool prefault : {false, true}) {
+            arena.configure(Arena::parseMode(mode), prefault, false, 256 * 1024 * 1024);
+            uint64_t fallbacks = arena.getStats().fallbacks;
+            std::vector<double> times = run([] { return ArenaBytes(); }, bytes, rounds);
+            print(mode, prefault, megabytes, times, arena.getStats().fallbacks > fallbacks);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
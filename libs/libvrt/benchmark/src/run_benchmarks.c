@@ -0,0 +1,322 @@
+/*
+ * Measure read and write time of representative packets, with and without validation, in both byte orders. Reads are
+ * measured both into a full packet struct and into the slim packet view. Prints one
+ * CSV line per case to stdout, so results of two runs can be diffed to spot regressions. Throughput is packet size over
+ * time, also for reads where the data section is only pointed to and never copied.
+ *
+ * Usage: run_benchmarks [min_seconds_per_case]
+ */
+
+/* For clock_gettime */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_string.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_write.h>
+
+/* Size of buffer in 32-bit words */
+#define SIZE 2048
+
+/* Number of 32-bit words of samples in the data packet */
+#define WORDS_DATA 1024
+
+/* Number of packet types */
+#define NUM_PACKETS 4
+
+/* Default minimum run time of each case */
+#define DEFAULT_MIN_SECONDS 0.2
+
+/* What a case measures */
+enum direction { DIRECTION_WRITE, DIRECTION_READ, DIRECTION_READ_VIEW, NUM_DIRECTIONS };
+
+/* Shared by all cases, so the compiler cannot drop calls whose results are unused */
+static volatile int32_t sink;
+
+/**
+ * Monotonic time.
+ *
+ * \return Time [ns].
+ */
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * Run one read or write case, doubling the number of iterations until it runs for at least min_seconds.
+ *
+ * \param packet      Packet to write. Unused when reading.
+ * \param buf         Buffer holding the written packet, in the byte order of be.
+ * \param direction   What to measure.
+ * \param be          True to use the big endian (network order) functions.
+ * \param validate    Passed on to the read or write function.
+ * \param min_seconds Minimum run time.
+ * \param iterations  Number of iterations of the final run.
+ *
+ * \return Time per packet [ns], or a negative number if error.
+ */
+static double run_case(const struct vrt_packet* packet,
+                       uint32_t*                buf,
+                       enum direction           direction,
+                       bool                     be,
+                       bool                     validate,
+                       double                   min_seconds,
+                       int64_t*                 iterations) {
+    struct vrt_packet      out;
+    struct vrt_packet_view view;
+    vrt_init_packet(&out);
+    for (int64_t n = 1;; n *= 2) {
+        double start = now_ns();
+        for (int64_t i = 0; i < n; ++i) {
+            int32_t rv;
+            switch (direction) {
+                case DIRECTION_READ: {
+                    rv = be ? vrt_read_packet_be(buf, SIZE, &out, validate)
+                            : vrt_read_packet(buf, SIZE, &out, validate);
+                    break;
+                }
+                case DIRECTION_READ_VIEW: {
+                    rv = be ? vrt_read_packet_view_be(buf, SIZE, &view, validate)
+                            : vrt_read_packet_view(buf, SIZE, &view, validate);
+                    break;
+                }
+                default: {
+                    rv = be ? vrt_write_packet_be(packet, buf, SIZE, validate, false)
+                            : vrt_write_packet(packet, buf, SIZE, validate);
+                    break;
+                }
+            }
+            if (rv < 0) {
+                fprintf(stderr, "Failed to %s packet: %s\n", direction == DIRECTION_WRITE ? "write" : "read",
+                        vrt_string_error(rv));
+                return -1.0;
+            }
+            sink = rv;
+        }
+        double elapsed = now_ns() - start;
+        if (elapsed >= min_seconds * 1e9) {
+            *iterations = n;
+            return elapsed / (double)n;
+        }
+    }
+}
+
+/**
+ * Enable every subfield of a formatted geolocation.
+ *
+ * \param g Formatted geolocation.
+ */
+static void populate_geolocation(struct vrt_formatted_geolocation* g) {
+    g->has.latitude           = true;
+    g->has.longitude          = true;
+    g->has.altitude           = true;
+    g->has.speed_over_ground  = true;
+    g->has.heading_angle      = true;
+    g->has.track_angle        = true;
+    g->has.magnetic_variation = true;
+    g->latitude               = 57.7;
+    g->longitude              = 11.9;
+    g->altitude               = 100.0;
+    g->speed_over_ground      = 10.0;
+    g->heading_angle          = 90.0;
+    g->track_angle            = 90.0;
+    g->magnetic_variation     = 3.0;
+}
+
+/**
+ * Enable every subfield of an ephemeris.
+ *
+ * \param e Ephemeris.
+ */
+static void populate_ephemeris(struct vrt_ephemeris* e) {
+    e->has.position_x     = true;
+    e->has.position_y     = true;
+    e->has.position_z     = true;
+    e->has.attitude_alpha = true;
+    e->has.attitude_beta  = true;
+    e->has.attitude_phi   = true;
+    e->has.velocity_dx    = true;
+    e->has.velocity_dy    = true;
+    e->has.velocity_dz    = true;
+    e->position_x         = 1000.0;
+    e->position_y         = 2000.0;
+    e->position_z         = 3000.0;
+    e->attitude_alpha     = 10.0;
+    e->attitude_beta      = 20.0;
+    e->attitude_phi       = 30.0;
+    e->velocity_dx        = 1.0;
+    e->velocity_dy        = 2.0;
+    e->velocity_dz        = 3.0;
+}
+
+/**
+ * Smallest possible packet, i.e. only per-packet overhead.
+ *
+ * \param p Packet.
+ */
+static void init_header_only(struct vrt_packet* p) {
+    vrt_init_packet(p);
+    p->header.packet_type = VRT_PT_IF_DATA_WITHOUT_STREAM_ID;
+}
+
+/**
+ * Typical data packet, with timestamps and trailer.
+ *
+ * \param p Packet.
+ */
+static void init_data_trailer(struct vrt_packet* p) {
+    static uint32_t samples[WORDS_DATA];
+    for (uint32_t i = 0; i < WORDS_DATA; ++i) {
+        samples[i] = i;
+    }
+
+    vrt_init_packet(p);
+    p->header.packet_type                  = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    p->header.tsi                          = VRT_TSI_UTC;
+    p->header.tsf                          = VRT_TSF_REAL_TIME;
+    p->header.has.trailer                  = true;
+    p->fields.stream_id                    = 0xDEADBEEF;
+    p->fields.integer_seconds_timestamp    = 1600000000;
+    p->fields.fractional_seconds_timestamp = 500000000000;
+    p->body                                = samples;
+    p->words_body                          = WORDS_DATA;
+    p->trailer.has.valid_data              = true;
+    p->trailer.valid_data                  = true;
+}
+
+/**
+ * Context packet with only the indicator field.
+ *
+ * \param p Packet.
+ */
+static void init_context_minimal(struct vrt_packet* p) {
+    vrt_init_packet(p);
+    p->header.packet_type = VRT_PT_IF_CONTEXT;
+    p->fields.stream_id   = 0xDEADBEEF;
+}
+
+/**
+ * Context packet with every field.
+ *
+ * \param p Packet.
+ */
+static void init_context_full(struct vrt_packet* p) {
+    static const char     gps_ascii[]  = "$GPGGA,,,,,,,,,,,,,*00\0";
+    static const uint32_t stream_ids[] = {0xA, 0xB, 0xC, 0xD};
+
+    vrt_init_packet(p);
+    p->header.packet_type = VRT_PT_IF_CONTEXT;
+    p->header.tsi         = VRT_TSI_UTC;
+    p->header.tsf         = VRT_TSF_REAL_TIME;
+    p->fields.stream_id   = 0xDEADBEEF;
+
+    struct vrt_if_context* c              = &p->if_context;
+    c->context_field_change_indicator     = true;
+    c->has.reference_point_identifier     = true;
+    c->has.bandwidth                      = true;
+    c->has.if_reference_frequency         = true;
+    c->has.rf_reference_frequency         = true;
+    c->has.rf_reference_frequency_offset  = true;
+    c->has.if_band_offset                 = true;
+    c->has.reference_level                = true;
+    c->has.gain                           = true;
+    c->has.over_range_count               = true;
+    c->has.sample_rate                    = true;
+    c->has.timestamp_adjustment           = true;
+    c->has.timestamp_calibration_time     = true;
+    c->has.temperature                    = true;
+    c->has.device_identifier              = true;
+    c->has.state_and_event_indicators     = true;
+    c->has.data_packet_payload_format     = true;
+    c->has.formatted_gps_geolocation      = true;
+    c->has.formatted_ins_geolocation      = true;
+    c->has.ecef_ephemeris                 = true;
+    c->has.relative_ephemeris             = true;
+    c->has.ephemeris_reference_identifier = true;
+    c->has.gps_ascii                      = true;
+    c->has.context_association_lists      = true;
+    c->bandwidth                          = 2.4e9;
+    c->if_reference_frequency             = 10e6;
+    c->rf_reference_frequency             = 1.2e9;
+    c->sample_rate                        = 2e6;
+    c->temperature                        = 24.0F;
+    populate_geolocation(&c->formatted_gps_geolocation);
+    populate_geolocation(&c->formatted_ins_geolocation);
+    populate_ephemeris(&c->ecef_ephemeris);
+    populate_ephemeris(&c->relative_ephemeris);
+    c->gps_ascii.number_of_words = (uint32_t)sizeof(gps_ascii) / 4;
+    c->gps_ascii.ascii           = gps_ascii;
+
+    struct vrt_context_association_lists* l          = &c->context_association_lists;
+    l->source_list_size                              = 1;
+    l->system_list_size                              = 1;
+    l->vector_component_list_size                    = 1;
+    l->asynchronous_channel_list_size                = 1;
+    l->source_context_association_list               = stream_ids;
+    l->system_context_association_list               = stream_ids + 1;
+    l->vector_component_context_association_list     = stream_ids + 2;
+    l->asynchronous_channel_context_association_list = stream_ids + 3;
+}
+
+int main(int argc, char** argv) {
+    double min_seconds = DEFAULT_MIN_SECONDS;
+    if (argc > 2) {
+        fprintf(stderr, "Usage: %s [min_seconds_per_case]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (argc == 2) {
+        min_seconds = strtod(argv[1], NULL);
+        if (min_seconds <= 0.0) {
+            fprintf(stderr, "Invalid minimum run time '%s'\n", argv[1]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    static const char* const names[NUM_PACKETS] = {"header_only", "data_trailer", "context_minimal", "context_full"};
+    static const char* const directions[NUM_DIRECTIONS] = {"write", "read", "read_view"};
+    static struct vrt_packet packets[NUM_PACKETS];
+    init_header_only(&packets[0]);
+    init_data_trailer(&packets[1]);
+    init_context_minimal(&packets[2]);
+    init_context_full(&packets[3]);
+
+    static uint32_t buf[SIZE];
+
+    printf("packet,direction,byte_order,validate,words,iterations,ns_per_packet,gb_per_s\n");
+    for (int i = 0; i < NUM_PACKETS; ++i) {
+        for (int be = 0; be <= 1; ++be) {
+            /* Write once to get the packet to read, and its size */
+            int32_t words = be ? vrt_write_packet_be(&packets[i], buf, SIZE, true, false)
+                               : vrt_write_packet(&packets[i], buf, SIZE, true);
+            if (words < 0) {
+                fprintf(stderr, "Failed to write '%s' packet: %s\n", names[i], vrt_string_error(words));
+                return EXIT_FAILURE;
+            }
+
+            for (int d = 0; d < NUM_DIRECTIONS; ++d) {
+                for (int validate = 0; validate <= 1; ++validate) {
+                    int64_t iterations = 0;
+                    double  ns         = run_case(&packets[i], buf, (enum direction)d, be != 0, validate != 0,
+                                                  min_seconds, &iterations);
+                    if (ns < 0.0) {
+                        return EXIT_FAILURE;
+                    }
+                    printf("%s,%s,%s,%d,%d,%lld,%.2f,%.3f\n", names[i], directions[d],
+                           be ? "network" : "host", validate, words, (long long)iterations, ns,
+                           (double)words * sizeof(uint32_t) / ns);
+                }
+            }
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
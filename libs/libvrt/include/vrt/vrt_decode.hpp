@@ -0,0 +1,278 @@
+#ifndef INCLUDE_VRT_VRT_DECODE_HPP_
+#define INCLUDE_VRT_VRT_DECODE_HPP_
+
+/*
+ * Header-only C++ decoders for data packets with a layout known at compile time. A stream with a fixed layout, e.g.
+ * IF data with Stream ID, UTC and sample count timestamps, and a trailer, has every field at a constant offset, so the
+ * decoder does not need to branch on header flags. Output is identical to vrt_read_packet and vrt_read_packet_view,
+ * which are used as fallback for any packet that does not match the layout.
+ */
+
+#include <cstdint>
+#include <type_traits>
+
+#include "vrt_error_code.h"
+#include "vrt_read.h"
+#include "vrt_types.h"
+
+namespace vrt {
+
+/**
+ * Layout of a data packet, as given by the header flags.
+ *
+ * \tparam PacketType Data packet type.
+ * \tparam HasClassId True if it has the Class ID field.
+ * \tparam HasTrailer True if it has the trailer word.
+ * \tparam Tsi        Type of integer second timestamp.
+ * \tparam Tsf        Type of fractional second timestamp.
+ */
+template <vrt_packet_type PacketType, bool HasClassId, bool HasTrailer, vrt_tsi Tsi, vrt_tsf Tsf>
+struct data_layout {
+    static_assert(PacketType == VRT_PT_IF_DATA_WITHOUT_STREAM_ID || PacketType == VRT_PT_IF_DATA_WITH_STREAM_ID ||
+                      PacketType == VRT_PT_EXT_DATA_WITHOUT_STREAM_ID || PacketType == VRT_PT_EXT_DATA_WITH_STREAM_ID,
+                  "Only data packets have a layout fixed by the header");
+
+    static constexpr vrt_packet_type packet_type  = PacketType;
+    static constexpr bool            has_class_id = HasClassId;
+    static constexpr bool            has_trailer  = HasTrailer;
+    static constexpr vrt_tsi         tsi          = Tsi;
+    static constexpr vrt_tsf         tsf          = Tsf;
+
+    static constexpr bool has_stream_id = PacketType == VRT_PT_IF_DATA_WITH_STREAM_ID ||
+                                          PacketType == VRT_PT_EXT_DATA_WITH_STREAM_ID;
+
+    /* Offsets from start of packet, in 32-bit words */
+    static constexpr int32_t offset_stream_id  = 1;
+    static constexpr int32_t offset_class_id   = offset_stream_id + (has_stream_id ? 1 : 0);
+    static constexpr int32_t offset_integer    = offset_class_id + (HasClassId ? 2 : 0);
+    static constexpr int32_t offset_fractional = offset_integer + (Tsi != VRT_TSI_NONE ? 1 : 0);
+    static constexpr int32_t offset_body       = offset_fractional + (Tsf != VRT_TSF_NONE ? 2 : 0);
+    static constexpr int32_t words_fields      = offset_body - 1;
+    static constexpr int32_t words_trailer     = HasTrailer ? 1 : 0;
+
+    /* Header bits that determine the layout, i.e. all but TSM, reserved, packet count, and packet size */
+    static constexpr uint32_t key_mask = 0xFCF00000U;
+    static constexpr uint32_t key = static_cast<uint32_t>(PacketType) << 28U |
+                                    static_cast<uint32_t>(HasClassId) << 27U |
+                                    static_cast<uint32_t>(HasTrailer) << 26U | static_cast<uint32_t>(Tsi) << 22U |
+                                    static_cast<uint32_t>(Tsf) << 20U;
+
+    /**
+     * Check if a header word has this layout.
+     *
+     * \param header_word First word of packet, in host order.
+     *
+     * \return True if it matches.
+     */
+    static constexpr bool matches(uint32_t header_word) { return (header_word & key_mask) == key; }
+};
+
+/**
+ * IF data packet with Stream ID, without Class ID, with UTC and sample count timestamps and a trailer.
+ */
+using if_data_utc_sample_count =
+    data_layout<VRT_PT_IF_DATA_WITH_STREAM_ID, false, true, VRT_TSI_UTC, VRT_TSF_SAMPLE_COUNT>;
+
+namespace detail {
+
+/**
+ * Read word from buffer.
+ *
+ * \tparam Be True if the buffer is big endian (network order) rather than host order.
+ *
+ * \param b Buffer to read from.
+ *
+ * \return Word in host order.
+ */
+template <bool Be>
+inline uint32_t read_uint32(const uint32_t* b) {
+    uint32_t u = *b;
+    if (!Be) {
+        return u;
+    }
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return u;
+#elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(u);
+#else
+    return (u >> 24U) | ((u >> 8U) & 0x0000FF00U) | ((u << 8U) & 0x00FF0000U) | (u << 24U);
+#endif
+}
+
+/**
+ * Decode packet, assuming the header matches the layout. Follows vrt_read_packet (or vrt_read_packet_view) step by
+ * step, including which members are written and in which order errors are detected, so the result is identical.
+ *
+ * \tparam Layout Packet layout.
+ * \tparam Be     True if the buffer is big endian (network order) rather than host order.
+ * \tparam Out    vrt_packet or vrt_packet_view.
+ */
+template <typename Layout, bool Be, typename Out>
+inline int32_t decode(void* buf, int32_t words_buf, Out* out, bool validate) {
+    constexpr bool  is_view = std::is_same<Out, vrt_packet_view>::value;
+    const uint32_t* b       = static_cast<const uint32_t*>(buf);
+
+    /* Header, with buffer size already checked by caller */
+    uint32_t h               = read_uint32<Be>(b);
+    out->header.packet_type  = Layout::packet_type;
+    out->header.has.class_id = Layout::has_class_id;
+    out->header.has.trailer  = Layout::has_trailer;
+    out->header.tsm          = static_cast<vrt_tsm>((h >> 24U) & 0x1U);
+    out->header.tsi          = Layout::tsi;
+    out->header.tsf          = Layout::tsf;
+    out->header.packet_count = static_cast<uint8_t>((h >> 16U) & 0xFU);
+    out->header.packet_size  = static_cast<uint16_t>(h);
+    if (validate && out->header.tsm != VRT_TSM_FINE) {
+        return VRT_ERR_TSM_IN_DATA;
+    }
+
+    /* Fields */
+    if (words_buf - 1 < Layout::words_fields) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+    vrt_fields* f = &out->fields;
+    f->stream_id  = Layout::has_stream_id ? read_uint32<Be>(b + Layout::offset_stream_id) : 0;
+    if (Layout::has_class_id) {
+        uint32_t c0                        = read_uint32<Be>(b + Layout::offset_class_id);
+        uint32_t c1                        = read_uint32<Be>(b + Layout::offset_class_id + 1);
+        f->class_id.oui                    = c0 & 0x00FFFFFFU;
+        f->class_id.information_class_code = static_cast<uint16_t>(c1 >> 16U);
+        f->class_id.packet_class_code      = static_cast<uint16_t>(c1);
+        if (validate && (c0 & 0xFF000000U) != 0) {
+            return VRT_ERR_RESERVED;
+        }
+    } else {
+        f->class_id.oui                    = 0;
+        f->class_id.information_class_code = 0;
+        f->class_id.packet_class_code      = 0;
+    }
+    f->integer_seconds_timestamp = Layout::tsi != VRT_TSI_NONE ? read_uint32<Be>(b + Layout::offset_integer) : 0;
+    if (Layout::tsf != VRT_TSF_NONE) {
+        f->fractional_seconds_timestamp =
+            static_cast<uint64_t>(read_uint32<Be>(b + Layout::offset_fractional)) << 32U |
+            static_cast<uint64_t>(read_uint32<Be>(b + Layout::offset_fractional + 1));
+        if (validate && Layout::tsf == VRT_TSF_REAL_TIME &&
+            f->fractional_seconds_timestamp >= static_cast<uint64_t>(1000000000000)) {
+            return VRT_ERR_BOUNDS_REAL_TIME;
+        }
+    } else {
+        f->fractional_seconds_timestamp = 0;
+    }
+
+    /* Body */
+    int32_t words_total = Layout::offset_body;
+    out->words_body     = out->header.packet_size - words_total - Layout::words_trailer;
+    if ((is_view || validate) && out->words_body < 0) {
+        return VRT_ERR_MISMATCH_PACKET_SIZE;
+    }
+    out->body = out->words_body > 0 ? static_cast<uint32_t*>(buf) + words_total : nullptr;
+    words_total += out->words_body;
+    if (words_total > words_buf) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    /* Trailer. Uses the library since there are no constant offsets to gain here. */
+    if (Layout::has_trailer) {
+        int32_t words_trailer = Be ? vrt_read_trailer_be(b + words_total, words_buf - words_total, &out->trailer)
+                                   : vrt_read_trailer(b + words_total, words_buf - words_total, &out->trailer);
+        if (words_trailer < 0) {
+            return words_trailer;
+        }
+        words_total += words_trailer;
+    }
+
+    if (!is_view && validate && out->header.packet_size != words_total) {
+        return VRT_ERR_MISMATCH_PACKET_SIZE;
+    }
+
+    return words_total;
+}
+
+/**
+ * Generic decoding, i.e. vrt_read_packet or vrt_read_packet_view.
+ */
+template <bool Be>
+inline int32_t decode_generic(void* buf, int32_t words_buf, vrt_packet* packet, bool validate) {
+    return Be ? vrt_read_packet_be(buf, words_buf, packet, validate)
+              : vrt_read_packet(buf, words_buf, packet, validate);
+}
+template <bool Be>
+inline int32_t decode_generic(void* buf, int32_t words_buf, vrt_packet_view* view, bool validate) {
+    return Be ? vrt_read_packet_view_be(buf, words_buf, view, validate)
+              : vrt_read_packet_view(buf, words_buf, view, validate);
+}
+
+/**
+ * Decode with the first layout matching the header word, or generically if none does.
+ */
+template <bool Be, typename Out>
+inline int32_t dispatch(uint32_t /*header_word*/, void* buf, int32_t words_buf, Out* out, bool validate) {
+    return decode_generic<Be>(buf, words_buf, out, validate);
+}
+template <bool Be, typename Out, typename Layout, typename... Layouts>
+inline int32_t dispatch(uint32_t header_word, void* buf, int32_t words_buf, Out* out, bool validate) {
+    if (Layout::matches(header_word)) {
+        return decode<Layout, Be>(buf, words_buf, out, validate);
+    }
+    return dispatch<Be, Out, Layouts...>(header_word, buf, words_buf, out, validate);
+}
+
+/**
+ * Read packet with any of the layouts, see read_packet.
+ */
+template <bool Be, typename Out, typename... Layouts>
+inline int32_t read(void* buf, int32_t words_buf, Out* out, bool validate) {
+    if (words_buf < 1) {
+        return decode_generic<Be>(buf, words_buf, out, validate);
+    }
+    return dispatch<Be, Out, Layouts...>(read_uint32<Be>(static_cast<const uint32_t*>(buf)), buf, words_buf, out,
+                                         validate);
+}
+
+}  // namespace detail
+
+/**
+ * Read packet with a decoder specialized for each of the given layouts. The layout is picked from the header word, in
+ * the order given. Packets with any other layout, including all context packets, are read with vrt_read_packet.
+ *
+ * \tparam Layouts Packet layouts, e.g. if_data_utc_sample_count.
+ *
+ * \param buf       Buffer to read from, in host order.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param packet    Packet [out].
+ * \param validate  True if data should be validated, otherwise false.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. Same as vrt_read_packet.
+ */
+template <typename... Layouts>
+inline int32_t read_packet(void* buf, int32_t words_buf, vrt_packet* packet, bool validate) {
+    return detail::read<false, vrt_packet, Layouts...>(buf, words_buf, packet, validate);
+}
+
+/**
+ * Same as read_packet, but reads a buffer in big endian (network order). Falls back to vrt_read_packet_be.
+ */
+template <typename... Layouts>
+inline int32_t read_packet_be(void* buf, int32_t words_buf, vrt_packet* packet, bool validate) {
+    return detail::read<true, vrt_packet, Layouts...>(buf, words_buf, packet, validate);
+}
+
+/**
+ * Same as read_packet, but reads into a packet view. Falls back to vrt_read_packet_view.
+ */
+template <typename... Layouts>
+inline int32_t read_packet_view(void* buf, int32_t words_buf, vrt_packet_view* view, bool validate) {
+    return detail::read<false, vrt_packet_view, Layouts...>(buf, words_buf, view, validate);
+}
+
+/**
+ * Same as read_packet_view, but reads a buffer in big endian (network order). Falls back to vrt_read_packet_view_be.
+ */
+template <typename... Layouts>
+inline int32_t read_packet_view_be(void* buf, int32_t words_buf, vrt_packet_view* view, bool validate) {
+    return detail::read<true, vrt_packet_view, Layouts...>(buf, words_buf, view, validate);
+}
+
+}  // namespace vrt
+
+#endif
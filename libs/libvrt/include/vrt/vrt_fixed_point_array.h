@@ -0,0 +1,68 @@
+#ifndef INCLUDE_VRT_VRT_FIXED_POINT_ARRAY_H_
+#define INCLUDE_VRT_VRT_FIXED_POINT_ARRAY_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Fixed point conversions of whole arrays, e.g. for gain, frequency, and level telemetry collected from many context
+ * packets. Radix positions are given as in the VRT standard, e.g. 20 for frequency fields and 7 for gain and reference
+ * level. On x86 the conversions use AVX2 when the CPU supports it, and SSE2 otherwise.
+ */
+
+/**
+ * Convert an array of int16 fixed point to floating point representation. Bit-exact with the scalar conversion of
+ * each element.
+ *
+ * \param fp Fixed point representations.
+ * \param n  Number of elements.
+ * \param r  Position of radix, from least significant bit.
+ * \param f  Floating point representations. Must hold n elements.
+ */
+void vrt_fixed_point_i16_to_float_n(const int16_t* fp, int32_t n, uint32_t r, float* f);
+
+/**
+ * Convert an array of int32 fixed point to floating point representation. Bit-exact with the scalar conversion of
+ * each element.
+ *
+ * \param fp Fixed point representations.
+ * \param n  Number of elements.
+ * \param r  Position of radix, from least significant bit.
+ * \param d  Floating point representations. Must hold n elements.
+ */
+void vrt_fixed_point_i32_to_double_n(const int32_t* fp, int32_t n, uint32_t r, double* d);
+
+/**
+ * Convert an array of floating point to int16 fixed point representation. Bit-exact with the scalar conversion of
+ * each element, i.e. rounds half away from zero.
+ *
+ * \param f  Floating point representations.
+ * \param n  Number of elements.
+ * \param r  Position of radix, from least significant bit.
+ * \param fp Fixed point representations. Must hold n elements.
+ *
+ * \warning A number outside range leads to undefined behaviour, as for the scalar conversion.
+ */
+void vrt_float_to_fixed_point_i16_n(const float* f, int32_t n, uint32_t r, int16_t* fp);
+
+/**
+ * Convert an array of floating point to int32 fixed point representation. Bit-exact with the scalar conversion of
+ * each element, i.e. rounds half away from zero.
+ *
+ * \param d  Floating point representations.
+ * \param n  Number of elements.
+ * \param r  Position of radix, from least significant bit.
+ * \param fp Fixed point representations. Must hold n elements.
+ *
+ * \warning A number outside range leads to undefined behaviour, as for the scalar conversion.
+ */
+void vrt_double_to_fixed_point_i32_n(const double* d, int32_t n, uint32_t r, int32_t* fp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -5,6 +5,7 @@
 extern "C" {
 #endif
 
+struct vrt_context_cache;
 struct vrt_fields;
 struct vrt_header;
 struct vrt_if_context;
@@ -48,6 +49,13 @@ void vrt_init_if_context(struct vrt_if_context* if_context);
  */
 void vrt_init_packet(struct vrt_packet* packet);
 
+/**
+ * Initialize context cache to an empty state, with zeroed counters.
+ *
+ * \param cache Context cache.
+ */
+void vrt_init_context_cache(struct vrt_context_cache* cache);
+
 #ifdef __cplusplus
 }
 #endif
@@ -10,10 +10,13 @@
 extern "C" {
 #endif
 
+struct vrt_context_cache;
 struct vrt_fields;
 struct vrt_header;
 struct vrt_if_context;
 struct vrt_packet;
+struct vrt_packet_desc;
+struct vrt_packet_view;
 struct vrt_trailer;
 
 /**
@@ -31,7 +34,8 @@ struct vrt_trailer;
  * \retval VRT_ERR_TRAILER_IN_CONTEXT   Context packet has trailer bit set.
  * \retval VRT_ERR_TSM_IN_DATA          Data packet has TSM bit set.
  *
- * \note Requires input buffer data to be byte swapped if platform endianess isn't big endian (network order).
+ * \note Requires input buffer data to be byte swapped if platform endianess isn't big endian (network order), see
+ *       vrt_read_header_be for reading network order directly.
  */
 VRT_WARN_UNUSED
 int32_t vrt_read_header(const void* buf, int32_t words_buf, struct vrt_header* header, bool validate);
@@ -160,6 +164,272 @@ int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_co
 VRT_WARN_UNUSED
 int32_t vrt_read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet, bool validate);
 
+/**
+ * Same as vrt_read_header, but reads a buffer in big endian (network order), i.e. as received, without swapping it
+ * first.
+ *
+ * \param buf       Buffer to read from, in network order.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param header    Header to read into.
+ * \param validate  True if validation shall be done. If false, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_header.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_header_be(const void* buf, int32_t words_buf, struct vrt_header* header, bool validate);
+
+/**
+ * Same as vrt_read_fields, but reads a buffer in big endian (network order).
+ *
+ * \param header    Header.
+ * \param buf       Buffer to read from, in network order. This must point to the first field in the sequence.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param fields    Fields section to read into.
+ * \param validate  True if validation shall be done. If false, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_fields.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_fields_be(const struct vrt_header* header,
+                           const void*              buf,
+                           int32_t                  words_buf,
+                           struct vrt_fields*       fields,
+                           bool                     validate);
+
+/**
+ * Same as vrt_read_trailer, but reads a buffer in big endian (network order).
+ *
+ * \param buf       Buffer to read from, in network order. This must point to the position of the trailer word.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param trailer   Trailer to read into.
+ *
+ * \return Number of read 32-bit words, i.e. 1, or a negative number if error. See vrt_read_trailer.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_trailer_be(const void* buf, int32_t words_buf, struct vrt_trailer* trailer);
+
+/**
+ * Same as vrt_read_if_context, but reads a buffer in big endian (network order).
+ *
+ * \param buf        Buffer to read from, in network order.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param if_context IF context struct to read into.
+ * \param validate   True if validation shall be done. If false, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_if_context.
+ *
+ * \warning The GPS ASCII and context association list pointers point into buf and are left in network order.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_if_context_be(const void* buf, int32_t words_buf, struct vrt_if_context* if_context, bool validate);
+
+/**
+ * Same as vrt_read_packet, but reads a buffer in big endian (network order). Only the words that are decoded are byte
+ * swapped, so the payload is never touched.
+ *
+ * \param buf        Buffer to read from, in network order.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param packet     Packet to read into.
+ * \param validate   True if validation shall be done. If false, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_packet.
+ *
+ * \warning The packet body pointer points into buf and the body is left in network order.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_packet_be(void* buf, int32_t words_buf, struct vrt_packet* packet, bool validate);
+
+/**
+ * Read a VRT packet into a slim packet view, which is the same as vrt_read_packet except that the IF context section is
+ * not decoded. Reading and copying a vrt_packet_view is much cheaper than a vrt_packet, since the latter holds a full
+ * IF context even for data packets.
+ *
+ * \param buf       Buffer to read from.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param view      Packet view to read into. For IF context packets the body is the undecoded IF context section.
+ * \param validate  True if validation shall be done. If false, only buffer size and packet size are validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error.
+ * \retval VRT_ERR_BUFFER_SIZE          Buffer is too small.
+ * \retval VRT_ERR_MISMATCH_PACKET_SIZE Packet size in header is too small for the header, fields and trailer sections.
+ * \retval VRT_ERR_RESERVED             One or multiple reserved bits are set.
+ * \retval VRT_ERR_INVALID_PACKET_TYPE  Packet type is an invalid value.
+ * \retval VRT_ERR_TRAILER_IN_CONTEXT   Context packet has trailer bit set.
+ * \retval VRT_ERR_TSM_IN_DATA          Data packet has TSM bit set.
+ * \retval VRT_ERR_BOUNDS_REAL_TIME     Real time fractional timestamp is outside valid bounds.
+ *
+ * \warning The packet body pointer will point into buf, which is why buf isn't const.
+ * \note Requires input buffer data to be byte swapped if platform endianess isn't big endian (network order), see
+ *       vrt_read_packet_view_be for reading network order directly.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_packet_view(void* buf, int32_t words_buf, struct vrt_packet_view* view, bool validate);
+
+/**
+ * Same as vrt_read_packet_view, but reads a buffer in big endian (network order).
+ *
+ * \param buf       Buffer to read from, in network order.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param view      Packet view to read into.
+ * \param validate  True if validation shall be done.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_packet_view.
+ *
+ * \warning The packet body pointer points into buf and the body is left in network order.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_packet_view_be(void* buf, int32_t words_buf, struct vrt_packet_view* view, bool validate);
+
+/**
+ * Decode the IF context section of an IF context packet read with vrt_read_packet_view.
+ *
+ * \param view       Packet view.
+ * \param if_context IF context struct to read into.
+ * \param validate   True if validation shall be done. If false, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_if_context.
+ * \retval VRT_ERR_INVALID_PACKET_TYPE  Packet is not an IF context packet.
+ * \retval VRT_ERR_MISMATCH_PACKET_SIZE IF context section does not fill the packet.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_view_if_context(const struct vrt_packet_view* view, struct vrt_if_context* if_context, bool validate);
+
+/**
+ * Same as vrt_read_view_if_context, but for a packet view read with vrt_read_packet_view_be.
+ *
+ * \param view       Packet view, read from a network order buffer.
+ * \param if_context IF context struct to read into.
+ * \param validate   True if validation shall be done. If false, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_view_if_context.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_view_if_context_be(const struct vrt_packet_view* view,
+                                    struct vrt_if_context*        if_context,
+                                    bool                          validate);
+
+/**
+ * Same as vrt_read_if_context, but skips decoding when the IF context section is identical to the last one read
+ * through the cache. Radios tend to resend unchanged context packets, so this saves decoding all indicators and fixed
+ * point fields again. The raw words are hashed and, on a matching hash, compared word by word with the previous
+ * section, and the context field change indicator is part of the compared words.
+ *
+ * \param buf        Buffer to read from.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param cache      Context cache, initialized with vrt_init_context_cache. Holds the decoded IF context afterwards,
+ *                   and cache->changed tells if it was decoded in this call.
+ * \param validate   True if validation shall be done. If false, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_if_context. The cache is emptied
+ *         on error.
+ *
+ * \note Sections with GPS ASCII or context association lists are never cached, since they point into buf.
+ * \note Requires input buffer data to be byte swapped if platform endianess isn't big endian (network order), see
+ *       vrt_read_if_context_cached_be for reading network order directly.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_if_context_cached(const void*               buf,
+                                   int32_t                   words_buf,
+                                   struct vrt_context_cache* cache,
+                                   bool                      validate);
+
+/**
+ * Same as vrt_read_if_context_cached, but reads a buffer in big endian (network order).
+ *
+ * \param buf        Buffer to read from, in network order.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param cache      Context cache, initialized with vrt_init_context_cache.
+ * \param validate   True if validation shall be done. If false, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_if_context_cached.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_if_context_cached_be(const void*               buf,
+                                      int32_t                   words_buf,
+                                      struct vrt_context_cache* cache,
+                                      bool                      validate);
+
+/**
+ * Peek at a VRT packet without fully reading it. Only the header and fields sections are decoded, which is enough to
+ * know the packet type, size, stream ID and where the body is. This is much cheaper than vrt_read_packet when only the
+ * packet boundaries are of interest, e.g. when searching for packets in a stream of bytes.
+ *
+ * \param buf       Buffer to read from.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param desc      Packet descriptor to read into. Its offset is always 0.
+ * \param validate  True if the header and fields sections shall be validated. If false, only buffer size and packet
+ *                  size are validated.
+ *
+ * \return Number of 32-bit words in packet, or a negative number if error.
+ * \retval VRT_ERR_BUFFER_SIZE          Buffer is too small to hold the full packet.
+ * \retval VRT_ERR_MISMATCH_PACKET_SIZE Packet size in header is too small for the header, fields and trailer sections.
+ * \retval VRT_ERR_RESERVED             One or multiple reserved bits are set.
+ * \retval VRT_ERR_INVALID_PACKET_TYPE  Packet type is an invalid value.
+ * \retval VRT_ERR_TRAILER_IN_CONTEXT   Context packet has trailer bit set.
+ * \retval VRT_ERR_TSM_IN_DATA          Data packet has TSM bit set.
+ * \retval VRT_ERR_BOUNDS_REAL_TIME     Real time fractional timestamp is outside valid bounds.
+ *
+ * \note Requires input buffer data to be byte swapped if platform endianess isn't big endian (network order), see
+ *       vrt_peek_packet_be for reading network order directly.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_peek_packet(const void* buf, int32_t words_buf, struct vrt_packet_desc* desc, bool validate);
+
+/**
+ * Same as vrt_peek_packet, but reads a buffer in big endian (network order).
+ *
+ * \param buf       Buffer to read from, in network order.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param desc      Packet descriptor to read into. Its offset is always 0.
+ * \param validate  True if the header and fields sections shall be validated.
+ *
+ * \return Number of 32-bit words in packet, or a negative number if error. See vrt_peek_packet.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_peek_packet_be(const void* buf, int32_t words_buf, struct vrt_packet_desc* desc, bool validate);
+
+/**
+ * Find consecutive VRT packets in a buffer in a single pass, peeking at each one as vrt_peek_packet does. Framing stops
+ * at the end of the buffer, when descs is full, or at the first packet that is incomplete or invalid. Since a packet
+ * that fails is never described, calling again at the end of the last described packet returns its error.
+ *
+ * \param buf       Buffer to read from.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param descs     Packet descriptors to write into, with offsets relative to buf.
+ * \param max_descs Maximum number of packet descriptors to write.
+ * \param validate  True if the header and fields sections shall be validated.
+ *
+ * \return Number of packets found, or a negative number if the first packet is invalid. 0 if the first packet is
+ *         incomplete. See vrt_peek_packet for errors.
+ *
+ * \note Requires input buffer data to be byte swapped if platform endianess isn't big endian (network order), see
+ *       vrt_frame_packets_be for reading network order directly.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_frame_packets(const void*             buf,
+                          int32_t                 words_buf,
+                          struct vrt_packet_desc* descs,
+                          int32_t                 max_descs,
+                          bool                    validate);
+
+/**
+ * Same as vrt_frame_packets, but reads a buffer in big endian (network order).
+ *
+ * \param buf       Buffer to read from, in network order.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param descs     Packet descriptors to write into, with offsets relative to buf.
+ * \param max_descs Maximum number of packet descriptors to write.
+ * \param validate  True if the header and fields sections shall be validated.
+ *
+ * \return Number of packets found, or a negative number if the first packet is invalid. See vrt_frame_packets.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_frame_packets_be(const void*             buf,
+                             int32_t                 words_buf,
+                             struct vrt_packet_desc* descs,
+                             int32_t                 max_descs,
+                             bool                    validate);
+
 #ifdef __cplusplus
 }
 #endif
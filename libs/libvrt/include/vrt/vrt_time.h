@@ -48,6 +48,35 @@ int vrt_time_difference_fields(const struct vrt_header* h2,
                                double                   sample_rate,
                                struct vrt_time*         diff);
 
+/**
+ * Calculate time differences between an array of fields sections and a reference, e.g. the first packet of a stream.
+ * Same as calling vrt_time_difference_fields for each element, but since all elements share one header, TSI and TSF
+ * are dispatched on and the sample rate is checked once rather than per element. Fractional timestamps are still
+ * bounds checked per element.
+ *
+ * \param header      Header of all fields sections, including the reference.
+ * \param fields      Fields sections.
+ * \param n           Number of elements.
+ * \param reference   Fields section to calculate the differences from.
+ * \param sample_rate Sample rate [Hz]. May be set to 0 if TSF isn't VRT_TSF_SAMPLE_COUNT.
+ * \param diffs       Time differences [out]. Must hold n elements.
+ *
+ * \return 0, or error code if error. Elements before the one causing the error have been written.
+ * \retval VRT_ERR_MISSING_SAMPLE_RATE      Sample rate is required but is not provided (<= 0).
+ * \retval VRT_ERR_BOUNDS_SAMPLE_COUNT      Fractional timestamp is outside valid bounds (>= sample rate).
+ * \retval VRT_ERR_BOUNDS_REAL_TIME         TSF is VRT_TSF_REAL_TIME but fractional timestamp is outside valid bounds
+ *                                          (> 999999999999 ps).
+ * \retval VRT_ERR_INTEGER_SECONDS_MISMATCH Timestamp integer seconds and calculated seconds from the Free running count
+ *                                          fractional part differ.
+ */
+VRT_WARN_UNUSED
+int vrt_time_difference_fields_n(const struct vrt_header* header,
+                                 const struct vrt_fields* fields,
+                                 int32_t                  n,
+                                 const struct vrt_fields* reference,
+                                 double                   sample_rate,
+                                 struct vrt_time*         diffs);
+
 /**
  * \deprecated{This will be removed in a future version. Use vrt_time_difference_fields instead.}
  */
@@ -83,6 +112,34 @@ int vrt_time_calendar_fields(const struct vrt_header*  header,
                              double                    sample_rate,
                              struct vrt_calendar_time* cal_time);
 
+/**
+ * Generate calendar representations of an array of fields section timestamps. Same as calling vrt_time_calendar_fields
+ * for each element, but the calendar date is only calculated when the day changes, which makes it much faster for
+ * timestamps in order.
+ *
+ * \note GPS timestamps may seem a bit off since they do not take leap seconds in consideration.
+ *
+ * \param header      Header of all fields sections.
+ * \param fields      Fields sections.
+ * \param n           Number of elements.
+ * \param sample_rate Sample rate [Hz]. May be set to 0 if TSF isn't VRT_TSF_SAMPLE_COUNT.
+ * \param cal_times   Calendar representations [out]. Must hold n elements.
+ *
+ * \return 0, or error code if error. Elements before the one causing the error have been written.
+ * \retval VRT_ERR_INVALID_TSI          TSI is an invalid value.
+ * \retval VRT_ERR_INVALID_TSF          TSF is an invalid value.
+ * \retval VRT_ERR_MISSING_SAMPLE_RATE  Sample rate is required but is not provided (<= 0).
+ * \retval VRT_ERR_BOUNDS_SAMPLE_COUNT  Fractional timestamp is outside valid bounds (>= sample rate).
+ * \retval VRT_ERR_BOUNDS_REAL_TIME     TSF is VRT_TSF_REAL_TIME but fractional timestamp is outside valid bounds
+ *                                      (> 999999999999 ps).
+ */
+VRT_WARN_UNUSED
+int vrt_time_calendar_fields_n(const struct vrt_header*  header,
+                               const struct vrt_fields*  fields,
+                               int32_t                   n,
+                               double                    sample_rate,
+                               struct vrt_calendar_time* cal_times);
+
 /**
  * Generate a calendar representation of IF context GPS geolocation timestamp. Only applicable when GPS geolocation is
  * present and GPS geolocation TSI is UTC or GPS.
@@ -720,6 +720,75 @@ struct vrt_packet {
     struct vrt_if_context if_context; /**< IF context. */
 };
 
+/**
+ * Largest IF context section, in 32-bit words, kept by vrt_read_if_context_cached. This is the indicator field and
+ * every fixed size field, since sections with GPS ASCII or context association lists are never cached.
+ */
+#define VRT_WORDS_MAX_CACHED_IF_CONTEXT 75
+
+/**
+ * Cache of the last IF context section read with vrt_read_if_context_cached. Use one cache per stream, since a cache
+ * only remembers a single context.
+ */
+struct vrt_context_cache {
+    struct vrt_if_context if_context; /**< Last read IF context. */
+    uint32_t              raw[VRT_WORDS_MAX_CACHED_IF_CONTEXT]; /**< Raw words of the last read IF context section. */
+    uint64_t              hash;       /**< Hash of the raw words of the last read IF context section. */
+    int32_t               words;      /**< Number of 32-bit words of the last read IF context section, or 0 if none. */
+    bool                  be;         /**< True if the last read IF context section was in network order. */
+    bool                  validated;  /**< True if the last read IF context section was validated. */
+    bool                  changed;    /**< True if the last read decoded the section, false if served from the cache. */
+    uint64_t              hits;       /**< Number of reads served from the cache. */
+    uint64_t              misses;     /**< Number of reads that decoded the section. */
+};
+
+/**
+ * Compact description of where a VRT packet is in a buffer, without its decoded content.
+ */
+struct vrt_packet_desc {
+    struct vrt_header header;      /**< Header. */
+    uint32_t          stream_id;   /**< Stream ID, or 0 if the packet type has none. */
+    int32_t           offset;      /**< Offset of packet from start of buffer, in 32-bit words. */
+    int32_t           offset_body; /**< Offset of body (or IF context section) from start of packet, in 32-bit words. */
+    int32_t           words_body;  /**< Number of 32-bit words in body (or IF context section), excluding trailer. */
+};
+
+/**
+ * Slim VRT packet, i.e. a vrt_packet without the IF context. For IF context packets the context section is left
+ * undecoded in the body, to be read on demand with vrt_read_view_if_context.
+ */
+struct vrt_packet_view {
+    struct vrt_header  header;     /**< Header. */
+    struct vrt_fields  fields;     /**< Fields. */
+    void*              body;       /**< Data payload, Ext context section, or undecoded IF context section. */
+    int32_t            words_body; /**< Number of 32-bit words used for body. */
+    struct vrt_trailer trailer;    /**< Trailer. */
+};
+
+/**
+ * State of a packetizer, which splits a sample buffer into a stream of data packets with vrt_packetize. Initialize
+ * with vrt_packetizer_init. Context packets are interleaved if context is set afterwards.
+ */
+struct vrt_packetizer {
+    /**
+     * Template of the next data packet. Packet count and timestamps are advanced after each written packet, while body
+     * and words_body are set per packet.
+     */
+    struct vrt_packet packet;
+    /**
+     * IF context packet to write before the first data packet, and then every context_interval data packets. NULL if
+     * none. Its timestamps are set to those of the data packet that follows it, if TSI and TSF are the same.
+     */
+    const struct vrt_packet* context;
+    int32_t  context_interval; /**< Number of data packets between context packets. 0 to only write the first one. */
+    int32_t  words_per_packet; /**< Maximum number of body words per data packet. */
+    int32_t  words_per_sample; /**< Number of 32-bit words per sample, e.g. 1 for 16-bit I/Q. */
+    uint64_t sample_rate;      /**< Sample rate [Hz], used to advance timestamps. */
+    uint64_t remainder;        /**< Part of a timestamp increment that is too small to be represented yet. */
+    uint8_t  context_count;    /**< Packet count of the next context packet. */
+    int32_t  since_context;    /**< Number of data packets since the last context packet, or -1 if none written. */
+};
+
 /**
  * Timestamp in whole and fractional seconds.
  *
@@ -14,6 +14,7 @@ struct vrt_fields;
 struct vrt_header;
 struct vrt_if_context;
 struct vrt_packet;
+struct vrt_packetizer;
 struct vrt_trailer;
 
 /**
@@ -224,12 +225,168 @@ int32_t vrt_write_if_context(const struct vrt_if_context* if_context, void* buf,
  *
  * \note Calculates packet_size field in header to match the number of written words. There is no need to calculate it
  *       beforehand. It is not modified in the const packet parameter, though.
- * \note May require output buffer data to be byte swapped if platform endianess isn't big endian (network order).
+ * \note May require output buffer data to be byte swapped if platform endianess isn't big endian (network order), see
+ *       vrt_write_packet_be for writing network order directly.
  * \note Will copy body data. For a zero-copy write, use the low-level routines.
  */
 VRT_WARN_UNUSED
 int32_t vrt_write_packet(const struct vrt_packet* packet, void* buf, int32_t words_buf, bool validate);
 
+/**
+ * Same as vrt_write_header, but writes big endian (network order), i.e. ready to be sent.
+ *
+ * \param header    Header to write.
+ * \param buf       Buffer to write to.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param validate  True if validation shall be done. If false, only buffer size is validated.
+ *
+ * \return Number of written 32-bit words (always 1), or a negative number if error. See vrt_write_header.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_write_header_be(const struct vrt_header* header, void* buf, int32_t words_buf, bool validate);
+
+/**
+ * Same as vrt_write_fields, but writes big endian (network order).
+ *
+ * \param header    Header.
+ * \param fields    Fields to write.
+ * \param buf       Buffer to write to. This must point to the start of the fields section.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param validate  True if validation shall be done. If false, only buffer size is validated.
+ *
+ * \return Number of written 32-bit words, or a negative number if error. See vrt_write_fields.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_write_fields_be(const struct vrt_header* header,
+                            const struct vrt_fields* fields,
+                            void*                    buf,
+                            int32_t                  words_buf,
+                            bool                     validate);
+
+/**
+ * Same as vrt_write_trailer, but writes big endian (network order).
+ *
+ * \param trailer   Trailer to write.
+ * \param buf       Buffer to write to. This must point to the position of the trailer word.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param validate  True if validation shall be done. If false, only buffer size is validated.
+ *
+ * \return Number of written 32-bit words (always 1), or a negative number if error. See vrt_write_trailer.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_write_trailer_be(const struct vrt_trailer* trailer, void* buf, int32_t words_buf, bool validate);
+
+/**
+ * Same as vrt_write_if_context, but writes big endian (network order). GPS ASCII and context association list words
+ * are taken to be in host order, like every other field, and swapped as well.
+ *
+ * \param if_context IF context to write.
+ * \param buf        Buffer to write to.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param validate   True if validation shall be done. If false, only buffer size is validated.
+ *
+ * \return Number of written 32-bit words, or a negative number if error. See vrt_write_if_context.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_write_if_context_be(const struct vrt_if_context* if_context, void* buf, int32_t words_buf, bool validate);
+
+/**
+ * Same as vrt_write_packet, but writes big endian (network order), i.e. a standard conforming packet that is ready to
+ * be sent regardless of platform endianess.
+ *
+ * \param packet     Packet to write.
+ * \param buf        Buffer to write to.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param validate   True if validation shall be done. If false, only buffer size is validated.
+ * \param swap_body  True if the body is in host order and its 32-bit words shall be byte swapped while copied. False
+ *                   if it is already in network order, or has a layout that 32-bit swaps do not apply to, and shall be
+ *                   copied as is.
+ *
+ * \return Number of written 32-bit words, or a negative number if error. See vrt_write_packet.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_write_packet_be(const struct vrt_packet* packet,
+                            void*                    buf,
+                            int32_t                  words_buf,
+                            bool                     validate,
+                            bool                     swap_body);
+
+/**
+ * Initialize a packetizer for splitting sample buffers into data packets. No context packets are written unless
+ * packetizer->context is set afterwards.
+ *
+ * \param packetizer       Packetizer to initialize.
+ * \param packet           Template data packet, with header, fields, and trailer of the first packet. Packet size,
+ *                         body, and IF context are ignored.
+ * \param words_per_packet Maximum number of body words per data packet.
+ * \param words_per_sample Number of 32-bit words per sample, e.g. 1 for 16-bit I/Q or 2 for 32-bit float I/Q.
+ * \param sample_rate      Sample rate [Hz], used to advance timestamps. May be 0 if the packets have no timestamps.
+ */
+void vrt_packetizer_init(struct vrt_packetizer*   packetizer,
+                         const struct vrt_packet* packet,
+                         int32_t                  words_per_packet,
+                         int32_t                  words_per_sample,
+                         uint64_t                 sample_rate);
+
+/**
+ * Write samples as back-to-back data packets, in a single pass. Each packet gets words_per_packet words of samples,
+ * except the last one which gets what is left, rounded down to whole samples. Packet count is incremented modulo 16
+ * and timestamps are advanced by the number of samples in each packet, rolling over into integer seconds when there is
+ * an integer timestamp. Context packets are interleaved if the packetizer has one, with their own packet count.
+ *
+ * Writing stops early when the next packet does not fit in buf, in which case words_consumed tells where to continue
+ * from in the next call. Words of buf after the returned number of words may have been overwritten by then. On error,
+ * a context packet written just before the failing data packet is rolled back, so it is written again by the next call.
+ *
+ * \param packetizer     Packetizer, initialized with vrt_packetizer_init.
+ * \param samples        Samples to write, in host order.
+ * \param words_samples  Size of samples in 32-bit words.
+ * \param buf            Buffer to write to.
+ * \param words_buf      Size of buf in 32-bit words.
+ * \param validate       True if validation shall be done. If false, only buffer size is validated.
+ * \param words_consumed Number of 32-bit words of samples that were written.
+ *
+ * \return Number of written 32-bit words, or a negative number if error. See vrt_write_packet for errors.
+ * \retval VRT_ERR_BOUNDS_PACKET_SIZE  Words per packet is not a positive multiple of words per sample, or too large
+ *                                    to fit in a packet together with header, fields, and trailer.
+ * \retval VRT_ERR_MISSING_SAMPLE_RATE Timestamps need to be advanced but sample rate is 0.
+ *
+ * \note Output is in host order, see vrt_packetize_be for writing network order directly.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_packetize(struct vrt_packetizer* packetizer,
+                      const void*            samples,
+                      int32_t                words_samples,
+                      void*                  buf,
+                      int32_t                words_buf,
+                      bool                   validate,
+                      int32_t*               words_consumed);
+
+/**
+ * Same as vrt_packetize, but writes big endian (network order). Samples are taken to be in host order and are byte
+ * swapped as 32-bit words if swap_body is true, see vrt_write_packet_be.
+ *
+ * \param packetizer     Packetizer, initialized with vrt_packetizer_init.
+ * \param samples        Samples to write.
+ * \param words_samples  Size of samples in 32-bit words.
+ * \param buf            Buffer to write to.
+ * \param words_buf      Size of buf in 32-bit words.
+ * \param validate       True if validation shall be done. If false, only buffer size is validated.
+ * \param swap_body      True if the 32-bit words of samples shall be byte swapped while copied.
+ * \param words_consumed Number of 32-bit words of samples that were written.
+ *
+ * \return Number of written 32-bit words, or a negative number if error. See vrt_packetize.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_packetize_be(struct vrt_packetizer* packetizer,
+                         const void*            samples,
+                         int32_t                words_samples,
+                         void*                  buf,
+                         int32_t                words_buf,
+                         bool                   validate,
+                         bool                   swap_body,
+                         int32_t*               words_consumed);
+
 #ifdef __cplusplus
 }
 #endif
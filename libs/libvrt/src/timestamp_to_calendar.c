@@ -8,6 +8,11 @@
  */
 static const uint64_t PS_IN_S = 1000000000000;
 
+/**
+ * Number of seconds in a day. Days are always this long since leap seconds are not considered.
+ */
+static const uint32_t SECONDS_IN_DAY = 86400;
+
 /**
  * Offset between GPS and UTC time [s].
  */
@@ -165,6 +170,48 @@ static int vrt_gmtime(uint32_t in_time, struct vrt_calendar_time* t) {
     return 0;
 }
 
+/**
+ * Convert fractional timestamp to picoseconds.
+ *
+ * \param tsf         TSF.
+ * \param ts_frac     Fractional second timestamp.
+ * \param sample_rate Sample rate [Hz].
+ * \param ps          Picoseconds [out].
+ *
+ * \return 0, or error code if error.
+ */
+static inline int fractional_to_ps(enum vrt_tsf tsf, uint64_t ts_frac, double sample_rate, uint64_t* ps) {
+    switch (tsf) {
+        case VRT_TSF_NONE: {
+            *ps = 0;
+            break;
+        }
+        case VRT_TSF_SAMPLE_COUNT: {
+            if (sample_rate <= 0.0) {
+                return VRT_ERR_MISSING_SAMPLE_RATE;
+            }
+            if (ts_frac >= (uint64_t)sample_rate) {
+                return VRT_ERR_BOUNDS_SAMPLE_COUNT;
+            }
+            *ps = (uint64_t)(ts_frac / sample_rate * PS_IN_S);
+            break;
+        }
+        case VRT_TSF_REAL_TIME: {
+            if (ts_frac >= PS_IN_S) {
+                return VRT_ERR_BOUNDS_REAL_TIME;
+            }
+            *ps = ts_frac;
+            break;
+        }
+        case VRT_TSF_FREE_RUNNING_COUNT:
+        default: {
+            return VRT_ERR_INVALID_TSF;
+        }
+    }
+
+    return 0;
+}
+
 int timestamp_to_calendar(enum vrt_tsi              tsi,
                           enum vrt_tsf              tsf,
                           uint32_t                  ts_int,
@@ -195,31 +242,62 @@ int timestamp_to_calendar(enum vrt_tsi              tsi,
     }
 
     /* TSF*/
-    switch (tsf) {
-        case VRT_TSF_NONE: {
-            cal_time->ps = 0;
+    return fractional_to_ps(tsf, ts_frac, sample_rate, &cal_time->ps);
+}
+
+int timestamps_to_calendar(enum vrt_tsi              tsi,
+                           enum vrt_tsf              tsf,
+                           const struct vrt_fields*  fields,
+                           int32_t                   n,
+                           double                    sample_rate,
+                           struct vrt_calendar_time* cal_times) {
+    uint32_t offset = 0;
+    switch (tsi) {
+        case VRT_TSI_UTC: {
             break;
         }
-        case VRT_TSF_SAMPLE_COUNT: {
-            if (sample_rate <= 0.0) {
-                return VRT_ERR_MISSING_SAMPLE_RATE;
-            }
-            if (ts_frac >= (uint64_t)sample_rate) {
-                return VRT_ERR_BOUNDS_SAMPLE_COUNT;
-            }
-            cal_time->ps = (uint64_t)(ts_frac / sample_rate * PS_IN_S);
+        case VRT_TSI_GPS: {
+            offset = UTC_GPS_OFFSET;
             break;
         }
-        case VRT_TSF_REAL_TIME: {
-            if (ts_frac >= PS_IN_S) {
-                return VRT_ERR_BOUNDS_REAL_TIME;
+        case VRT_TSI_NONE:
+        case VRT_TSI_OTHER:
+        default: {
+            return VRT_ERR_INVALID_TSI;
+        }
+    }
+
+    /* Calendar date of the day currently cached, which starts at day_start and is valid for SECONDS_IN_DAY seconds */
+    struct vrt_calendar_time day;
+    uint32_t                 day_start = 0;
+    bool                     has_day   = false;
+    for (int32_t i = 0; i < n; ++i) {
+        uint32_t                  t  = fields[i].integer_seconds_timestamp + offset;
+        struct vrt_calendar_time* ct = &cal_times[i];
+        if (has_day && t >= day_start && t - day_start < SECONDS_IN_DAY) {
+            /* Same day, so only time of day changes */
+            uint32_t s = t - day_start;
+            ct->year   = day.year;
+            ct->mday   = day.mday;
+            ct->yday   = day.yday;
+            ct->mon    = day.mon;
+            ct->wday   = day.wday;
+            ct->hour   = (int32_t)(s / 3600);
+            ct->min    = (int32_t)(s / 60 % 60);
+            ct->sec    = (int32_t)(s % 60);
+        } else {
+            int rv = vrt_gmtime(t, ct);
+            if (rv < 0) {
+                return rv;
             }
-            cal_time->ps = ts_frac;
-            break;
+            day       = *ct;
+            day_start = t - t % SECONDS_IN_DAY;
+            has_day   = true;
         }
-        case VRT_TSF_FREE_RUNNING_COUNT:
-        default: {
-            return VRT_ERR_INVALID_TSF;
+
+        int rv = fractional_to_ps(tsf, fields[i].fractional_seconds_timestamp, sample_rate, &ct->ps);
+        if (rv < 0) {
+            return rv;
         }
     }
 
@@ -30,6 +30,26 @@ int timestamp_to_calendar(enum vrt_tsi              tsi,
                           double                    sample_rate,
                           struct vrt_calendar_time* cal_time);
 
+/**
+ * Convert time stamps of an array of fields sections to calendar format. Same as calling timestamp_to_calendar for
+ * each element, but the calendar date is only calculated once per day.
+ *
+ * \param tsi         TSI.
+ * \param tsf         TSF.
+ * \param fields      Fields sections.
+ * \param n           Number of elements.
+ * \param sample_rate Sample rate [Hz].
+ * \param cal_times   Calendar times [out]. Must hold n elements.
+ *
+ * \return 0, or error code if error.
+ */
+int timestamps_to_calendar(enum vrt_tsi              tsi,
+                           enum vrt_tsf              tsf,
+                           const struct vrt_fields*  fields,
+                           int32_t                   n,
+                           double                    sample_rate,
+                           struct vrt_calendar_time* cal_times);
+
 #endif
 
 #ifdef __cplusplus
@@ -13,3 +13,241 @@ extern inline int16_t  vrt_float_to_fixed_point_i16(float fp, uint32_t r);
 extern inline int32_t  vrt_double_to_fixed_point_i32(double fp, uint32_t r);
 extern inline uint32_t vrt_double_to_fixed_point_u32(double fp, uint32_t r);
 extern inline int64_t  vrt_double_to_fixed_point_i64(double fp, uint32_t r);
+
+/*
+ * Instruction sets used by the array conversions. AVX2 is picked at run time with GCC and Clang on x86, so a default
+ * build uses it on CPUs that have it. Other compilers only use it when targeting it, e.g. with /arch:AVX2.
+ */
+#if defined(__AVX2__) || ((defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)))
+#include <immintrin.h>
+#define VRT_FIXED_POINT_AVX2
+#if defined(__AVX2__)
+#define VRT_TARGET_AVX2
+#else
+#define VRT_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VRT_FIXED_POINT_SSE2
+#endif
+
+#if defined(VRT_FIXED_POINT_AVX2)
+/* Set by vrt_fixed_point_use_avx2 to leave AVX2 unused. Accessed atomically, since conversions may run on any thread. */
+static int avx2_off = 0;
+#if defined(__GNUC__) || defined(__clang__)
+#define VRT_LOAD_AVX2_OFF() __atomic_load_n(&avx2_off, __ATOMIC_RELAXED)
+#define VRT_STORE_AVX2_OFF(v) __atomic_store_n(&avx2_off, (v), __ATOMIC_RELAXED)
+#else
+/* Aligned int accesses are atomic with MSVC on x86 */
+#define VRT_LOAD_AVX2_OFF() (*(volatile int*)&avx2_off)
+#define VRT_STORE_AVX2_OFF(v) (*(volatile int*)&avx2_off = (v))
+#endif
+
+/**
+ * Check if AVX2 shall be used. The CPU check only reads what the compiler runtime detected before main, so it is safe
+ * to call from any thread.
+ *
+ * \return True if AVX2 is supported and not turned off with vrt_fixed_point_use_avx2.
+ */
+static bool avx2_enabled(void) {
+    if (VRT_LOAD_AVX2_OFF() != 0) {
+        return false;
+    }
+#if defined(__AVX2__)
+    return true;
+#else
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+#endif
+
+bool vrt_fixed_point_use_avx2(bool avx2) {
+#if defined(VRT_FIXED_POINT_AVX2)
+    VRT_STORE_AVX2_OFF(avx2 ? 0 : 1);
+    return avx2_enabled();
+#else
+    (void)avx2;
+    return false;
+#endif
+}
+
+/*
+ * Vector parts of the array conversions. Each converts as many leading elements as fit in whole vectors and returns
+ * how many it converted, the caller converts the rest one by one.
+ */
+
+#if defined(VRT_FIXED_POINT_AVX2)
+VRT_TARGET_AVX2 static int32_t i16_to_float_avx2(const int16_t* fp, int32_t n, float scale, float* f) {
+    const __m256 s = _mm256_set1_ps(scale);
+    int32_t      i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(fp + i)));
+        _mm256_storeu_ps(f + i, _mm256_div_ps(_mm256_cvtepi32_ps(v), s));
+    }
+    return i;
+}
+
+VRT_TARGET_AVX2 static int32_t i32_to_double_avx2(const int32_t* fp, int32_t n, double scale, double* d) {
+    const __m256d s = _mm256_set1_pd(scale);
+    int32_t       i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(fp + i));
+        _mm256_storeu_pd(d + i, _mm256_div_pd(_mm256_cvtepi32_pd(v), s));
+    }
+    return i;
+}
+
+VRT_TARGET_AVX2 static int32_t float_to_i16_avx2(const float* f, int32_t n, float scale, int16_t* fp) {
+    const __m256 s    = _mm256_set1_ps(scale);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 pos  = _mm256_set1_ps(0.5F);
+    const __m256 neg  = _mm256_set1_ps(-0.5F);
+    int32_t      i    = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256  v    = _mm256_mul_ps(_mm256_loadu_ps(f + i), s);
+        __m256  half = _mm256_blendv_ps(neg, pos, _mm256_cmp_ps(v, zero, _CMP_GE_OQ));
+        __m256i t    = _mm256_cvttps_epi32(_mm256_add_ps(v, half));
+        __m128i p    = _mm_packs_epi32(_mm256_castsi256_si128(t), _mm256_extracti128_si256(t, 1));
+        _mm_storeu_si128((__m128i*)(fp + i), p);
+    }
+    return i;
+}
+
+VRT_TARGET_AVX2 static int32_t double_to_i32_avx2(const double* d, int32_t n, double scale, int32_t* fp) {
+    const __m256d s    = _mm256_set1_pd(scale);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d pos  = _mm256_set1_pd(0.5);
+    const __m256d neg  = _mm256_set1_pd(-0.5);
+    int32_t       i    = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d v    = _mm256_mul_pd(_mm256_loadu_pd(d + i), s);
+        __m256d half = _mm256_blendv_pd(neg, pos, _mm256_cmp_pd(v, zero, _CMP_GE_OQ));
+        _mm_storeu_si128((__m128i*)(fp + i), _mm256_cvttpd_epi32(_mm256_add_pd(v, half)));
+    }
+    return i;
+}
+#endif
+
+#if defined(VRT_FIXED_POINT_SSE2)
+static int32_t i16_to_float_sse2(const int16_t* fp, int32_t n, float scale, float* f) {
+    const __m128 s = _mm_set1_ps(scale);
+    int32_t      i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadl_epi64((const __m128i*)(fp + i));
+        /* Sign extend to int32 by placing each int16 in the upper half and shifting back */
+        v = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+        _mm_storeu_ps(f + i, _mm_div_ps(_mm_cvtepi32_ps(v), s));
+    }
+    return i;
+}
+
+static int32_t i32_to_double_sse2(const int32_t* fp, int32_t n, double scale, double* d) {
+    const __m128d s = _mm_set1_pd(scale);
+    int32_t       i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128i v = _mm_loadl_epi64((const __m128i*)(fp + i));
+        _mm_storeu_pd(d + i, _mm_div_pd(_mm_cvtepi32_pd(v), s));
+    }
+    return i;
+}
+
+static int32_t float_to_i16_sse2(const float* f, int32_t n, float scale, int16_t* fp) {
+    const __m128 s    = _mm_set1_ps(scale);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 pos  = _mm_set1_ps(0.5F);
+    const __m128 neg  = _mm_set1_ps(-0.5F);
+    int32_t      i    = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128  v    = _mm_mul_ps(_mm_loadu_ps(f + i), s);
+        __m128  ge   = _mm_cmpge_ps(v, zero);
+        __m128  half = _mm_or_ps(_mm_and_ps(ge, pos), _mm_andnot_ps(ge, neg));
+        __m128i t    = _mm_cvttps_epi32(_mm_add_ps(v, half));
+        _mm_storel_epi64((__m128i*)(fp + i), _mm_packs_epi32(t, t));
+    }
+    return i;
+}
+
+static int32_t double_to_i32_sse2(const double* d, int32_t n, double scale, int32_t* fp) {
+    const __m128d s    = _mm_set1_pd(scale);
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d pos  = _mm_set1_pd(0.5);
+    const __m128d neg  = _mm_set1_pd(-0.5);
+    int32_t       i    = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128d v    = _mm_mul_pd(_mm_loadu_pd(d + i), s);
+        __m128d ge   = _mm_cmpge_pd(v, zero);
+        __m128d half = _mm_or_pd(_mm_and_pd(ge, pos), _mm_andnot_pd(ge, neg));
+        _mm_storel_epi64((__m128i*)(fp + i), _mm_cvttpd_epi32(_mm_add_pd(v, half)));
+    }
+    return i;
+}
+#endif
+
+void vrt_fixed_point_i16_to_float_n(const int16_t* fp, int32_t n, uint32_t r, float* f) {
+    const float scale = (float)(1U << r);
+    int32_t     i     = 0;
+#if defined(VRT_FIXED_POINT_AVX2)
+    if (avx2_enabled()) {
+        i = i16_to_float_avx2(fp, n, scale, f);
+    }
+#endif
+#if defined(VRT_FIXED_POINT_SSE2)
+    i += i16_to_float_sse2(fp + i, n - i, scale, f + i);
+#endif
+    for (; i < n; ++i) {
+        f[i] = vrt_fixed_point_i16_to_float(fp[i], r);
+    }
+}
+
+void vrt_fixed_point_i32_to_double_n(const int32_t* fp, int32_t n, uint32_t r, double* d) {
+    const double scale = (double)(1U << r);
+    int32_t      i     = 0;
+#if defined(VRT_FIXED_POINT_AVX2)
+    if (avx2_enabled()) {
+        i = i32_to_double_avx2(fp, n, scale, d);
+    }
+#endif
+#if defined(VRT_FIXED_POINT_SSE2)
+    i += i32_to_double_sse2(fp + i, n - i, scale, d + i);
+#endif
+    for (; i < n; ++i) {
+        d[i] = vrt_fixed_point_i32_to_double(fp[i], r);
+    }
+}
+
+void vrt_float_to_fixed_point_i16_n(const float* f, int32_t n, uint32_t r, int16_t* fp) {
+    /* Vector parts do the same operations as vrt_round_f_to_i16: add 0.5 if >= 0 and subtract 0.5 otherwise, then
+     * truncate */
+    const float scale = (float)(1U << r);
+    int32_t     i     = 0;
+#if defined(VRT_FIXED_POINT_AVX2)
+    if (avx2_enabled()) {
+        i = float_to_i16_avx2(f, n, scale, fp);
+    }
+#endif
+#if defined(VRT_FIXED_POINT_SSE2)
+    i += float_to_i16_sse2(f + i, n - i, scale, fp + i);
+#endif
+    for (; i < n; ++i) {
+        fp[i] = vrt_float_to_fixed_point_i16(f[i], r);
+    }
+}
+
+void vrt_double_to_fixed_point_i32_n(const double* d, int32_t n, uint32_t r, int32_t* fp) {
+    /* Vector parts do the same operations as vrt_round_d_to_i32: add 0.5 if >= 0 and subtract 0.5 otherwise, then
+     * truncate */
+    const double scale = (double)(1U << r);
+    int32_t      i     = 0;
+#if defined(VRT_FIXED_POINT_AVX2)
+    if (avx2_enabled()) {
+        i = double_to_i32_avx2(d, n, scale, fp);
+    }
+#endif
+#if defined(VRT_FIXED_POINT_SSE2)
+    i += double_to_i32_sse2(d + i, n - i, scale, fp + i);
+#endif
+    for (; i < n; ++i) {
+        fp[i] = vrt_double_to_fixed_point_i32(d[i], r);
+    }
+}
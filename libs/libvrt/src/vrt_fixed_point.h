@@ -1,8 +1,11 @@
 #ifndef SRC_VRT_FIXED_POINT_H_
 #define SRC_VRT_FIXED_POINT_H_
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#include "vrt_fixed_point_array.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -19,6 +22,13 @@ extern "C" {
 #define VRT_STATIC_CAST(T, X) (T)(X)
 #endif
 
+/* Keep test hooks out of the symbols exported by a shared object that links libvrt */
+#if defined(__GNUC__) || defined(__clang__)
+#define VRT_HIDDEN __attribute__((visibility("hidden")))
+#else
+#define VRT_HIDDEN
+#endif
+
 /**
  * Radix position counting from lsb for frequency fields, such as Bandwidth, IF reference frequency, IF reference
  * frequency, RF reference frequency, RF reference frequency offset, IF band offset, and Sample rate.
@@ -211,6 +221,16 @@ inline int64_t vrt_double_to_fixed_point_i64(double fp, uint32_t r) {
     return vrt_round_d_to_u64(fp * VRT_STATIC_CAST(double, 1U << r));
 }
 
+/**
+ * Restrict the array conversions to at most SSE2, even if the CPU supports AVX2. Test hook that lets both code paths
+ * run on one machine.
+ *
+ * \param avx2 False to never use AVX2, true to use it if supported.
+ *
+ * \return True if AVX2 is used from now on.
+ */
+VRT_HIDDEN bool vrt_fixed_point_use_avx2(bool avx2);
+
 #ifndef __cplusplus
 #pragma GCC diagnostic pop
 #endif
@@ -230,3 +230,14 @@ void vrt_init_packet(struct vrt_packet* packet) {
     vrt_init_trailer(&packet->trailer);
     vrt_init_if_context(&packet->if_context);
 }
+
+void vrt_init_context_cache(struct vrt_context_cache* cache) {
+    vrt_init_if_context(&cache->if_context);
+    cache->hash      = 0;
+    cache->words     = 0;
+    cache->be        = false;
+    cache->validated = false;
+    cache->changed   = false;
+    cache->hits      = 0;
+    cache->misses    = 0;
+}
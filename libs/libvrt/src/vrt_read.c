@@ -1,6 +1,7 @@
 #include "vrt_read.h"
 
 #include <stddef.h>
+#include <string.h>
 
 #include "vrt_bounds.h"
 #include "vrt_error_code.h"
@@ -25,18 +26,40 @@ static inline uint32_t mskr(uint32_t val, uint32_t pos, uint32_t n) {
     return (val >> pos) & mask;
 }
 
+/**
+ * Read uint32 from uint32 buffer, byte swapping it first if the buffer is in network order.
+ *
+ * \param b  Buffer to read from.
+ * \param be True if the buffer is big endian (network order) rather than host order.
+ *
+ * \return uint32 in host order.
+ */
+static inline uint32_t read_uint32(const uint32_t* b, bool be) {
+    return be ? vrt_be32_to_host(*b) : *b;
+}
+
 /**
  * Read uint64 from uint32 buffer by interpreting the first word as most significant.
  *
- * \param b Buffer to read from.
+ * \param b  Buffer to read from.
+ * \param be True if the buffer is big endian (network order) rather than host order.
  *
  * \return uint64.
  */
-static inline uint64_t read_uint64(const uint32_t* b) {
-    return (uint64_t)b[0] << 32U | (uint64_t)b[1];
+static inline uint64_t read_uint64(const uint32_t* b, bool be) {
+    return (uint64_t)read_uint32(b, be) << 32U | (uint64_t)read_uint32(b + 1, be);
 }
 
-int32_t vrt_read_header(const void* buf, int32_t words_buf, struct vrt_header* header, bool validate) {
+/**
+ * Read VRT header section, see vrt_read_header.
+ *
+ * \param be True if the buffer is big endian (network order) rather than host order.
+ */
+static inline int32_t read_header(const void*        buf,
+                                  int32_t            words_buf,
+                                  struct vrt_header* header,
+                                  bool               validate,
+                                  bool               be) {
     /* Note that it makes sense to have words_buf as signed, to avoid overflow for words_buf - offset */
 
     /* Size is always 1 */
@@ -48,7 +71,7 @@ int32_t vrt_read_header(const void* buf, int32_t words_buf, struct vrt_header* h
     }
 
     /* Word in header section */
-    uint32_t b = *((const uint32_t*)buf);
+    uint32_t b = read_uint32((const uint32_t*)buf, be);
 
     /* Decode in order from msb to lsb */
     header->packet_type  = (enum vrt_packet_type)mskr(b, 28, 4);
@@ -81,11 +104,17 @@ int32_t vrt_read_header(const void* buf, int32_t words_buf, struct vrt_header* h
     return words;
 }
 
-int32_t vrt_read_fields(const struct vrt_header* header,
-                        const void*              buf,
-                        int32_t                  words_buf,
-                        struct vrt_fields*       fields,
-                        bool                     validate) {
+/**
+ * Read VRT fields section, see vrt_read_fields.
+ *
+ * \param be True if the buffer is big endian (network order) rather than host order.
+ */
+static inline int32_t read_fields(const struct vrt_header* header,
+                                  const void*              buf,
+                                  int32_t                  words_buf,
+                                  struct vrt_fields*       fields,
+                                  bool                     validate,
+                                  bool                     be) {
     const int32_t words = vrt_words_fields(header);
 
     /* Check if buf size is sufficient */
@@ -96,7 +125,7 @@ int32_t vrt_read_fields(const struct vrt_header* header,
     const uint32_t* b = ((const uint32_t*)buf);
 
     if (vrt_has_stream_id(header)) {
-        fields->stream_id = b[0];
+        fields->stream_id = read_uint32(b, be);
         b += 1;
     } else {
         /* Zero Stream ID here, just to be sure */
@@ -104,12 +133,12 @@ int32_t vrt_read_fields(const struct vrt_header* header,
     }
 
     if (header->has.class_id) {
-        fields->class_id.oui                    = mskr(b[0], 0, 24);
-        fields->class_id.information_class_code = (uint16_t)mskr(b[1], 16, 16);
-        fields->class_id.packet_class_code      = (uint16_t)b[1];
+        fields->class_id.oui                    = mskr(read_uint32(b, be), 0, 24);
+        fields->class_id.information_class_code = (uint16_t)mskr(read_uint32(b + 1, be), 16, 16);
+        fields->class_id.packet_class_code      = (uint16_t)read_uint32(b + 1, be);
 
         if (validate) {
-            if ((b[0] & 0xFF000000U) != 0) {
+            if ((read_uint32(b, be) & 0xFF000000U) != 0) {
                 return VRT_ERR_RESERVED;
             }
         }
@@ -126,12 +155,12 @@ int32_t vrt_read_fields(const struct vrt_header* header,
         /* Zero integer timestamp here, just to be sure */
         fields->integer_seconds_timestamp = 0;
     } else {
-        fields->integer_seconds_timestamp = b[0];
+        fields->integer_seconds_timestamp = read_uint32(b, be);
         b += 1;
     }
 
     if (vrt_has_fractional_timestamp(header->tsf)) {
-        fields->fractional_seconds_timestamp = read_uint64(b);
+        fields->fractional_seconds_timestamp = read_uint64(b, be);
 
         if (validate) {
             if (header->tsf == VRT_TSF_REAL_TIME && fields->fractional_seconds_timestamp >= (uint64_t)1000000000000) {
@@ -148,7 +177,12 @@ int32_t vrt_read_fields(const struct vrt_header* header,
     return words;
 }
 
-int32_t vrt_read_trailer(const void* buf, int32_t words_buf, struct vrt_trailer* trailer) {
+/**
+ * Read VRT trailer section, see vrt_read_trailer.
+ *
+ * \param be True if the buffer is big endian (network order) rather than host order.
+ */
+static inline int32_t read_trailer(const void* buf, int32_t words_buf, struct vrt_trailer* trailer, bool be) {
     /* Number of words are always 1 */
     const int32_t words = 1;
 
@@ -157,7 +191,7 @@ int32_t vrt_read_trailer(const void* buf, int32_t words_buf, struct vrt_trailer*
         return VRT_ERR_BUFFER_SIZE;
     }
 
-    uint32_t b = *(const uint32_t*)buf;
+    uint32_t b = read_uint32((const uint32_t*)buf, be);
 
     /* Go from msb to lsb. Make sure to zero fields if not present, just to be sure. */
     trailer->has.calibrated_time    = mskr(b, 31, 1);
@@ -396,25 +430,29 @@ static int32_t if_context_read_state_and_event_indicators(bool
  * \param b        Buffer to read from.
  * \param f        Data packet payload format struct to read into.
  * \param validate True if data shall be validated.
+ * \param be       True if the buffer is big endian (network order).
  *
  * \return Number of read words, or a negative number if error.
  */
 static int32_t if_context_read_data_packet_payload_format(bool                                   has,
                                                           const uint32_t*                        b,
                                                           struct vrt_data_packet_payload_format* f,
-                                                          bool                                   validate) {
+                                                          bool                                   validate,
+                                                          bool                                   be) {
     if (has) {
-        f->packing_method          = (enum vrt_packing_method)mskr(b[0], 31, 1);
-        f->real_or_complex         = (enum vrt_real_complex)mskr(b[0], 29, 2);
-        f->data_item_format        = (enum vrt_data_item_format)mskr(b[0], 24, 5);
-        f->sample_component_repeat = vrt_u2b(mskr(b[0], 23, 1));
-        f->event_tag_size          = (uint8_t)mskr(b[0], 20, 3);
-        f->channel_tag_size        = (uint8_t)mskr(b[0], 16, 4);
-        f->item_packing_field_size = (uint8_t)mskr(b[0], 6, 6);
-        f->data_item_size          = (uint8_t)mskr(b[0], 0, 6);
-
-        f->repeat_count = (uint16_t)mskr(b[1], 16, 16);
-        f->vector_size  = (uint16_t)mskr(b[1], 0, 16);
+        uint32_t w[2] = {read_uint32(b, be), read_uint32(b + 1, be)};
+
+        f->packing_method          = (enum vrt_packing_method)mskr(w[0], 31, 1);
+        f->real_or_complex         = (enum vrt_real_complex)mskr(w[0], 29, 2);
+        f->data_item_format        = (enum vrt_data_item_format)mskr(w[0], 24, 5);
+        f->sample_component_repeat = vrt_u2b(mskr(w[0], 23, 1));
+        f->event_tag_size          = (uint8_t)mskr(w[0], 20, 3);
+        f->channel_tag_size        = (uint8_t)mskr(w[0], 16, 4);
+        f->item_packing_field_size = (uint8_t)mskr(w[0], 6, 6);
+        f->data_item_size          = (uint8_t)mskr(w[0], 0, 6);
+
+        f->repeat_count = (uint16_t)mskr(w[1], 16, 16);
+        f->vector_size  = (uint16_t)mskr(w[1], 0, 16);
 
         if (validate) {
             if (f->real_or_complex > VRT_ROC_COMPLEX_POLAR) {
@@ -426,7 +464,7 @@ static int32_t if_context_read_data_packet_payload_format(bool
                 return VRT_ERR_INVALID_DATA_ITEM_FORMAT;
             }
 
-            if ((b[0] & 0x0000F000U) != 0) {
+            if ((w[0] & 0x0000F000U) != 0) {
                 return VRT_ERR_RESERVED;
             }
         }
@@ -455,37 +493,45 @@ static int32_t if_context_read_data_packet_payload_format(bool
  * \param b        Buffer to read from.
  * \param g        Formatted GPS/INS geolocation struct to read into.
  * \param validate True if data shall be validated.
+ * \param be       True if the buffer is big endian (network order).
  *
  * \return Number of read words, or a negative number if error.
  */
 static int32_t if_context_read_formatted_geolocation(bool                              has,
                                                      const uint32_t*                   b,
                                                      struct vrt_formatted_geolocation* g,
-                                                     bool                              validate) {
+                                                     bool                              validate,
+                                                     bool                              be) {
     if (has) {
-        g->tsi                         = (enum vrt_tsi)mskr(b[0], 26, 2);
-        g->tsf                         = (enum vrt_tsf)mskr(b[0], 24, 2);
-        g->oui                         = mskr(b[0], 0, 24);
-        g->integer_second_timestamp    = b[1];
-        g->fractional_second_timestamp = read_uint64(b + 2);
-        g->has.latitude                = (b[4] != VRT_UNSPECIFIED_FIXED_POINT);
-        g->latitude                    = vrt_fixed_point_i32_to_double((int32_t)b[4], VRT_RADIX_ANGLE);
-        g->has.longitude               = (b[5] != VRT_UNSPECIFIED_FIXED_POINT);
-        g->longitude                   = vrt_fixed_point_i32_to_double((int32_t)b[5], VRT_RADIX_ANGLE);
-        g->has.altitude                = (b[6] != VRT_UNSPECIFIED_FIXED_POINT);
-        g->altitude                    = vrt_fixed_point_i32_to_double((int32_t)b[6], VRT_RADIX_ALTITUDE);
-        g->has.speed_over_ground       = (b[7] != VRT_UNSPECIFIED_FIXED_POINT);
-        g->speed_over_ground           = vrt_fixed_point_u32_to_double(b[7], VRT_RADIX_SPEED_VELOCITY);
-        g->has.heading_angle           = (b[8] != VRT_UNSPECIFIED_FIXED_POINT);
-        g->heading_angle               = vrt_fixed_point_i32_to_double((int32_t)b[8], VRT_RADIX_ANGLE);
-        g->has.track_angle             = (b[9] != VRT_UNSPECIFIED_FIXED_POINT);
-        g->track_angle                 = vrt_fixed_point_i32_to_double((int32_t)b[9], VRT_RADIX_ANGLE);
-        g->has.magnetic_variation      = (b[10] != VRT_UNSPECIFIED_FIXED_POINT);
+        /* Every word of the field is decoded, so convert them all up front */
+        uint32_t w[11];
+        for (int32_t i = 0; i < 11; ++i) {
+            w[i] = read_uint32(b + i, be);
+        }
+
+        g->tsi                         = (enum vrt_tsi)mskr(w[0], 26, 2);
+        g->tsf                         = (enum vrt_tsf)mskr(w[0], 24, 2);
+        g->oui                         = mskr(w[0], 0, 24);
+        g->integer_second_timestamp    = w[1];
+        g->fractional_second_timestamp = read_uint64(b + 2, be);
+        g->has.latitude                = (w[4] != VRT_UNSPECIFIED_FIXED_POINT);
+        g->latitude                    = vrt_fixed_point_i32_to_double((int32_t)w[4], VRT_RADIX_ANGLE);
+        g->has.longitude               = (w[5] != VRT_UNSPECIFIED_FIXED_POINT);
+        g->longitude                   = vrt_fixed_point_i32_to_double((int32_t)w[5], VRT_RADIX_ANGLE);
+        g->has.altitude                = (w[6] != VRT_UNSPECIFIED_FIXED_POINT);
+        g->altitude                    = vrt_fixed_point_i32_to_double((int32_t)w[6], VRT_RADIX_ALTITUDE);
+        g->has.speed_over_ground       = (w[7] != VRT_UNSPECIFIED_FIXED_POINT);
+        g->speed_over_ground           = vrt_fixed_point_u32_to_double(w[7], VRT_RADIX_SPEED_VELOCITY);
+        g->has.heading_angle           = (w[8] != VRT_UNSPECIFIED_FIXED_POINT);
+        g->heading_angle               = vrt_fixed_point_i32_to_double((int32_t)w[8], VRT_RADIX_ANGLE);
+        g->has.track_angle             = (w[9] != VRT_UNSPECIFIED_FIXED_POINT);
+        g->track_angle                 = vrt_fixed_point_i32_to_double((int32_t)w[9], VRT_RADIX_ANGLE);
+        g->has.magnetic_variation      = (w[10] != VRT_UNSPECIFIED_FIXED_POINT);
         /* There seems to be an error in Rule 7.1.5.19-13. A correction seems to be 6.2.5.15-2 -> 7.1.5.19-2.*/
-        g->magnetic_variation = vrt_fixed_point_i32_to_double((int32_t)b[10], VRT_RADIX_ANGLE);
+        g->magnetic_variation = vrt_fixed_point_i32_to_double((int32_t)w[10], VRT_RADIX_ANGLE);
 
         if (validate) {
-            if ((b[0] & 0xF0000000U) != 0) {
+            if ((w[0] & 0xF0000000U) != 0) {
                 return VRT_ERR_RESERVED;
             }
             if (g->tsi == VRT_TSI_UNDEFINED && g->integer_second_timestamp != VRT_UNSPECIFIED_TSI) {
@@ -553,38 +599,49 @@ static int32_t if_context_read_formatted_geolocation(bool
  * \param b        Buffer to read from [0] or [13].
  * \param e        Ephemeris struct to read into.
  * \param validate True if data shall be validated.
+ * \param be       True if the buffer is big endian (network order).
  *
  * \return Number of read words, or a negative number if error.
  */
-static int32_t if_context_read_ephemeris(bool has, const uint32_t* b, struct vrt_ephemeris* e, bool validate) {
+static int32_t if_context_read_ephemeris(bool                  has,
+                                         const uint32_t*       b,
+                                         struct vrt_ephemeris* e,
+                                         bool                  validate,
+                                         bool                  be) {
     if (has) {
-        e->tsi                         = (enum vrt_tsi)mskr(b[0], 26, 2);
-        e->tsf                         = (enum vrt_tsf)mskr(b[0], 24, 2);
-        e->oui                         = mskr(b[0], 0, 24);
-        e->integer_second_timestamp    = b[1];
-        e->fractional_second_timestamp = read_uint64(b + 2);
-
-        e->has.position_x     = (b[4] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->position_x         = vrt_fixed_point_i32_to_double((int32_t)b[4], VRT_RADIX_POSITION);
-        e->has.position_y     = (b[5] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->position_y         = vrt_fixed_point_i32_to_double((int32_t)b[5], VRT_RADIX_POSITION);
-        e->has.position_z     = (b[6] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->position_z         = vrt_fixed_point_i32_to_double((int32_t)b[6], VRT_RADIX_POSITION);
-        e->has.attitude_alpha = (b[7] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->attitude_alpha     = vrt_fixed_point_i32_to_double((int32_t)b[7], VRT_RADIX_ANGLE);
-        e->has.attitude_beta  = (b[8] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->attitude_beta      = vrt_fixed_point_i32_to_double((int32_t)b[8], VRT_RADIX_ANGLE);
-        e->has.attitude_phi   = (b[9] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->attitude_phi       = vrt_fixed_point_i32_to_double((int32_t)b[9], VRT_RADIX_ANGLE);
-        e->has.velocity_dx    = (b[10] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->velocity_dx        = vrt_fixed_point_i32_to_double((int32_t)b[10], VRT_RADIX_SPEED_VELOCITY);
-        e->has.velocity_dy    = (b[11] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->velocity_dy        = vrt_fixed_point_i32_to_double((int32_t)b[11], VRT_RADIX_SPEED_VELOCITY);
-        e->has.velocity_dz    = (b[12] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->velocity_dz        = vrt_fixed_point_i32_to_double((int32_t)b[12], VRT_RADIX_SPEED_VELOCITY);
+        /* Every word of the field is decoded, so convert them all up front */
+        uint32_t w[13];
+        for (int32_t i = 0; i < 13; ++i) {
+            w[i] = read_uint32(b + i, be);
+        }
+
+        e->tsi                         = (enum vrt_tsi)mskr(w[0], 26, 2);
+        e->tsf                         = (enum vrt_tsf)mskr(w[0], 24, 2);
+        e->oui                         = mskr(w[0], 0, 24);
+        e->integer_second_timestamp    = w[1];
+        e->fractional_second_timestamp = read_uint64(b + 2, be);
+
+        e->has.position_x     = (w[4] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->position_x         = vrt_fixed_point_i32_to_double((int32_t)w[4], VRT_RADIX_POSITION);
+        e->has.position_y     = (w[5] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->position_y         = vrt_fixed_point_i32_to_double((int32_t)w[5], VRT_RADIX_POSITION);
+        e->has.position_z     = (w[6] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->position_z         = vrt_fixed_point_i32_to_double((int32_t)w[6], VRT_RADIX_POSITION);
+        e->has.attitude_alpha = (w[7] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->attitude_alpha     = vrt_fixed_point_i32_to_double((int32_t)w[7], VRT_RADIX_ANGLE);
+        e->has.attitude_beta  = (w[8] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->attitude_beta      = vrt_fixed_point_i32_to_double((int32_t)w[8], VRT_RADIX_ANGLE);
+        e->has.attitude_phi   = (w[9] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->attitude_phi       = vrt_fixed_point_i32_to_double((int32_t)w[9], VRT_RADIX_ANGLE);
+        e->has.velocity_dx    = (w[10] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->velocity_dx        = vrt_fixed_point_i32_to_double((int32_t)w[10], VRT_RADIX_SPEED_VELOCITY);
+        e->has.velocity_dy    = (w[11] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->velocity_dy        = vrt_fixed_point_i32_to_double((int32_t)w[11], VRT_RADIX_SPEED_VELOCITY);
+        e->has.velocity_dz    = (w[12] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->velocity_dz        = vrt_fixed_point_i32_to_double((int32_t)w[12], VRT_RADIX_SPEED_VELOCITY);
 
         if (validate) {
-            if ((b[0] & 0xF0000000U) != 0) {
+            if ((w[0] & 0xF0000000U) != 0) {
                 return VRT_ERR_RESERVED;
             }
             if (e->tsi == VRT_TSI_UNDEFINED && e->integer_second_timestamp != VRT_UNSPECIFIED_TSI) {
@@ -641,13 +698,14 @@ static int32_t if_context_read_ephemeris(bool has, const uint32_t* b, struct vrt
  * \param b        Buffer to read from.
  * \param g        GPS ASCII struct to read into.
  * \param validate True if data shall be validated.
+ * \param be       True if the buffer is big endian (network order).
  *
  * \return Number of read words, or a negative number if error.
  */
-static int32_t if_context_read_gps_ascii(bool has, const uint32_t* b, struct vrt_gps_ascii* g, bool validate) {
+static int32_t if_context_read_gps_ascii(bool has, const uint32_t* b, struct vrt_gps_ascii* g, bool validate, bool be) {
     if (has) {
-        g->oui             = mskr(b[0], 0, 24);
-        g->number_of_words = b[1];
+        g->oui             = mskr(read_uint32(b, be), 0, 24);
+        g->number_of_words = read_uint32(b + 1, be);
         if (g->number_of_words == 0) {
             g->ascii = NULL;
         } else {
@@ -655,7 +713,7 @@ static int32_t if_context_read_gps_ascii(bool has, const uint32_t* b, struct vrt
         }
 
         if (validate) {
-            if ((b[0] & 0xFF000000U) != 0) {
+            if ((read_uint32(b, be) & 0xFF000000U) != 0) {
                 return VRT_ERR_RESERVED;
             }
         }
@@ -676,16 +734,20 @@ static int32_t if_context_read_gps_ascii(bool has, const uint32_t* b, struct vrt
  * \param has True if it is included.
  * \param b   Buffer to read from.
  * \param l   Association lists struct to read into.
+ * \param be  True if the buffer is big endian (network order).
  *
  * \return Number of read words.
  */
-static int32_t if_context_read_association_lists(bool has, const uint32_t* b, struct vrt_context_association_lists* l) {
+static int32_t if_context_read_association_lists(bool                                   has,
+                                                 const uint32_t*                        b,
+                                                 struct vrt_context_association_lists* l,
+                                                 bool                                   be) {
     if (has) {
-        l->source_list_size                  = (uint16_t)mskr(b[0], 16, 9);
-        l->system_list_size                  = (uint16_t)mskr(b[0], 0, 9);
-        l->vector_component_list_size        = (uint16_t)mskr(b[1], 16, 16);
-        l->has.asynchronous_channel_tag_list = vrt_u2b(mskr(b[1], 15, 1));
-        l->asynchronous_channel_list_size    = (uint16_t)mskr(b[1], 0, 15);
+        l->source_list_size                  = (uint16_t)mskr(read_uint32(b, be), 16, 9);
+        l->system_list_size                  = (uint16_t)mskr(read_uint32(b, be), 0, 9);
+        l->vector_component_list_size        = (uint16_t)mskr(read_uint32(b + 1, be), 16, 16);
+        l->has.asynchronous_channel_tag_list = vrt_u2b(mskr(read_uint32(b + 1, be), 15, 1));
+        l->asynchronous_channel_list_size    = (uint16_t)mskr(read_uint32(b + 1, be), 0, 15);
 
         int32_t words = 2;
         if (l->source_list_size == 0) {
@@ -738,7 +800,16 @@ static int32_t if_context_read_association_lists(bool has, const uint32_t* b, st
     return 0;
 }
 
-int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_context* if_context, bool validate) {
+/**
+ * Read VRT IF context section, see vrt_read_if_context.
+ *
+ * \param be True if the buffer is big endian (network order) rather than host order.
+ */
+static inline int32_t read_if_context(const void*            buf,
+                                      int32_t                words_buf,
+                                      struct vrt_if_context* if_context,
+                                      bool                   validate,
+                                      bool                   be) {
     /* Cannot count words here since the IF context section hasn't been read yet */
 
     int32_t words = 1;
@@ -750,7 +821,7 @@ int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_co
     const uint32_t* b = (const uint32_t*)buf;
 
     /* Go from msb to lsb. Make sure to zero fields if not present, just to be sure. */
-    int32_t rv = if_context_read_indicator_field(b[0], if_context, validate);
+    int32_t rv = if_context_read_indicator_field(read_uint32(b, be), if_context, validate);
     if (rv < 0) {
         return rv;
     }
@@ -763,13 +834,13 @@ int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_co
     }
 
     if (if_context->has.reference_point_identifier) {
-        if_context->reference_point_identifier = b[0];
+        if_context->reference_point_identifier = read_uint32(b, be);
         b += 1;
     } else {
         if_context->reference_point_identifier = 0;
     }
     if (if_context->has.bandwidth) {
-        if_context->bandwidth = vrt_fixed_point_i64_to_double((int64_t)read_uint64(b), VRT_RADIX_FREQUENCY);
+        if_context->bandwidth = vrt_fixed_point_i64_to_double((int64_t)read_uint64(b, be), VRT_RADIX_FREQUENCY);
 
         if (validate) {
             if (if_context->bandwidth < 0.0) {
@@ -783,37 +854,37 @@ int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_co
     }
     if (if_context->has.if_reference_frequency) {
         if_context->if_reference_frequency =
-            vrt_fixed_point_i64_to_double((int64_t)read_uint64(b), VRT_RADIX_FREQUENCY);
+            vrt_fixed_point_i64_to_double((int64_t)read_uint64(b, be), VRT_RADIX_FREQUENCY);
         b += 2;
     } else {
         if_context->if_reference_frequency = 0.0;
     }
     if (if_context->has.rf_reference_frequency) {
         if_context->rf_reference_frequency =
-            vrt_fixed_point_i64_to_double((int64_t)read_uint64(b), VRT_RADIX_FREQUENCY);
+            vrt_fixed_point_i64_to_double((int64_t)read_uint64(b, be), VRT_RADIX_FREQUENCY);
         b += 2;
     } else {
         if_context->rf_reference_frequency = 0.0;
     }
     if (if_context->has.rf_reference_frequency_offset) {
         if_context->rf_reference_frequency_offset =
-            vrt_fixed_point_i64_to_double((int64_t)read_uint64(b), VRT_RADIX_FREQUENCY);
+            vrt_fixed_point_i64_to_double((int64_t)read_uint64(b, be), VRT_RADIX_FREQUENCY);
         b += 2;
     } else {
         if_context->rf_reference_frequency_offset = 0.0;
     }
     if (if_context->has.if_band_offset) {
-        if_context->if_band_offset = vrt_fixed_point_i64_to_double((int64_t)read_uint64(b), VRT_RADIX_FREQUENCY);
+        if_context->if_band_offset = vrt_fixed_point_i64_to_double((int64_t)read_uint64(b, be), VRT_RADIX_FREQUENCY);
         b += 2;
     } else {
         if_context->if_band_offset = 0.0;
     }
     if (if_context->has.reference_level) {
         if_context->reference_level =
-            vrt_fixed_point_i16_to_float((int16_t)(b[0] & 0x0000FFFFU), VRT_RADIX_REFERENCE_LEVEL);
+            vrt_fixed_point_i16_to_float((int16_t)(read_uint32(b, be) & 0x0000FFFFU), VRT_RADIX_REFERENCE_LEVEL);
 
         if (validate) {
-            if ((b[0] & 0xFFFF0000U) != 0) {
+            if ((read_uint32(b, be) & 0xFFFF0000U) != 0) {
                 return VRT_ERR_RESERVED;
             }
         }
@@ -823,8 +894,8 @@ int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_co
         if_context->reference_level = 0.0F;
     }
     if (if_context->has.gain) {
-        int16_t fp1             = b[0] & 0x0000FFFFU;
-        int16_t fp2             = (b[0] >> 16U) & 0x0000FFFFU;
+        int16_t fp1             = read_uint32(b, be) & 0x0000FFFFU;
+        int16_t fp2             = (read_uint32(b, be) >> 16U) & 0x0000FFFFU;
         if_context->gain.stage1 = vrt_fixed_point_i16_to_float(fp1, VRT_RADIX_GAIN);
         if_context->gain.stage2 = vrt_fixed_point_i16_to_float(fp2, VRT_RADIX_GAIN);
 
@@ -842,13 +913,13 @@ int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_co
         if_context->gain.stage2 = 0.0F;
     }
     if (if_context->has.over_range_count) {
-        if_context->over_range_count = b[0];
+        if_context->over_range_count = read_uint32(b, be);
         b += 1;
     } else {
         if_context->over_range_count = 0;
     }
     if (if_context->has.sample_rate) {
-        if_context->sample_rate = vrt_fixed_point_i64_to_double((int64_t)read_uint64(b), VRT_RADIX_FREQUENCY);
+        if_context->sample_rate = vrt_fixed_point_i64_to_double((int64_t)read_uint64(b, be), VRT_RADIX_FREQUENCY);
 
         if (validate) {
             if (if_context->sample_rate < VRT_MIN_SAMPLE_RATE) {
@@ -861,25 +932,25 @@ int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_co
         if_context->sample_rate = 0.0;
     }
     if (if_context->has.timestamp_adjustment) {
-        if_context->timestamp_adjustment = read_uint64(b);
+        if_context->timestamp_adjustment = read_uint64(b, be);
         b += 2;
     } else {
         if_context->timestamp_adjustment = 0;
     }
     if (if_context->has.timestamp_calibration_time) {
-        if_context->timestamp_calibration_time = b[0];
+        if_context->timestamp_calibration_time = read_uint32(b, be);
         b += 1;
     } else {
         if_context->timestamp_calibration_time = 0;
     }
     if (if_context->has.temperature) {
-        if_context->temperature = vrt_fixed_point_i16_to_float(b[0] & 0x0000FFFFU, VRT_RADIX_TEMPERATURE);
+        if_context->temperature = vrt_fixed_point_i16_to_float(read_uint32(b, be) & 0x0000FFFFU, VRT_RADIX_TEMPERATURE);
 
         if (validate) {
             if (if_context->temperature < VRT_MIN_TEMPERATURE) {
                 return VRT_ERR_BOUNDS_TEMPERATURE;
             }
-            if ((b[0] & 0xFFFF0000U) != 0) {
+            if ((read_uint32(b, be) & 0xFFFF0000U) != 0) {
                 return VRT_ERR_RESERVED;
             }
         }
@@ -889,11 +960,11 @@ int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_co
         if_context->temperature = 0.0F;
     }
     if (if_context->has.device_identifier) {
-        if_context->device_identifier.oui         = mskr(b[0], 0, 24);
-        if_context->device_identifier.device_code = (uint16_t)mskr(b[1], 0, 16);
+        if_context->device_identifier.oui         = mskr(read_uint32(b, be), 0, 24);
+        if_context->device_identifier.device_code = (uint16_t)mskr(read_uint32(b + 1, be), 0, 16);
 
         if (validate) {
-            if ((b[0] & 0xFF000000U) != 0 || (b[1] & 0xFFFF0000U) != 0) {
+            if ((read_uint32(b, be) & 0xFF000000U) != 0 || (read_uint32(b + 1, be) & 0xFFFF0000U) != 0) {
                 return VRT_ERR_RESERVED;
             }
         }
@@ -903,48 +974,49 @@ int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_co
         if_context->device_identifier.oui         = 0;
         if_context->device_identifier.device_code = 0;
     }
-    rv = if_context_read_state_and_event_indicators(if_context->has.state_and_event_indicators, b[0],
+    rv = if_context_read_state_and_event_indicators(if_context->has.state_and_event_indicators, read_uint32(b, be),
                                                     &if_context->state_and_event_indicators, validate);
     if (rv < 0) {
         return rv;
     }
     b += rv;
     rv = if_context_read_data_packet_payload_format(if_context->has.data_packet_payload_format, b,
-                                                    &if_context->data_packet_payload_format, validate);
+                                                    &if_context->data_packet_payload_format, validate, be);
     if (rv < 0) {
         return rv;
     }
     b += rv;
     rv = if_context_read_formatted_geolocation(if_context->has.formatted_gps_geolocation, b,
-                                               &if_context->formatted_gps_geolocation, validate);
+                                               &if_context->formatted_gps_geolocation, validate, be);
     if (rv < 0) {
         return rv;
     }
     b += rv;
     rv = if_context_read_formatted_geolocation(if_context->has.formatted_ins_geolocation, b,
-                                               &if_context->formatted_ins_geolocation, validate);
+                                               &if_context->formatted_ins_geolocation, validate, be);
     if (rv < 0) {
         return rv;
     }
     b += rv;
-    rv = if_context_read_ephemeris(if_context->has.ecef_ephemeris, b, &if_context->ecef_ephemeris, validate);
+    rv = if_context_read_ephemeris(if_context->has.ecef_ephemeris, b, &if_context->ecef_ephemeris, validate, be);
     if (rv < 0) {
         return rv;
     }
     b += rv;
-    rv = if_context_read_ephemeris(if_context->has.relative_ephemeris, b, &if_context->relative_ephemeris, validate);
+    rv = if_context_read_ephemeris(if_context->has.relative_ephemeris, b, &if_context->relative_ephemeris, validate,
+                                   be);
     if (rv < 0) {
         return rv;
     }
     b += rv;
     if (if_context->has.ephemeris_reference_identifier) {
-        if_context->ephemeris_reference_identifier = b[0];
+        if_context->ephemeris_reference_identifier = read_uint32(b, be);
         b += 1;
     } else {
         if_context->ephemeris_reference_identifier = 0;
     }
 
-    rv = if_context_read_gps_ascii(if_context->has.gps_ascii, b, &if_context->gps_ascii, validate);
+    rv = if_context_read_gps_ascii(if_context->has.gps_ascii, b, &if_context->gps_ascii, validate, be);
     if (rv < 0) {
         return rv;
     }
@@ -953,7 +1025,7 @@ int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_co
 
     /* No need to increase b here since it is last */
     rv = if_context_read_association_lists(if_context->has.context_association_lists, b,
-                                           &if_context->context_association_lists);
+                                           &if_context->context_association_lists, be);
     if (rv < 0) {
         return rv;
     }
@@ -962,11 +1034,16 @@ int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_co
     return words;
 }
 
-int32_t vrt_read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet, bool validate) {
+/**
+ * Read full VRT packet, see vrt_read_packet.
+ *
+ * \param be True if the buffer is big endian (network order) rather than host order.
+ */
+static inline int32_t read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet, bool validate, bool be) {
     uint32_t* b = (uint32_t*)buf;
 
     /* Header */
-    int32_t words_header = vrt_read_header(b, words_buf, &packet->header, validate);
+    int32_t words_header = read_header(b, words_buf, &packet->header, validate, be);
     if (words_header < 0) {
         return words_header;
     }
@@ -974,7 +1051,7 @@ int32_t vrt_read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet,
 
     /* Fields */
     int32_t words_fields =
-        vrt_read_fields(&packet->header, b + words_total, words_buf - words_total, &packet->fields, validate);
+        read_fields(&packet->header, b + words_total, words_buf - words_total, &packet->fields, validate, be);
     if (words_fields < 0) {
         return words_fields;
     }
@@ -1011,7 +1088,7 @@ int32_t vrt_read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet,
         case VRT_PT_IF_CONTEXT: {
             /* IF context */
             int32_t words_if_context =
-                vrt_read_if_context(b + words_total, words_buf - words_total, &packet->if_context, validate);
+                read_if_context(b + words_total, words_buf - words_total, &packet->if_context, validate, be);
             if (words_if_context < 0) {
                 return words_if_context;
             }
@@ -1031,7 +1108,7 @@ int32_t vrt_read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet,
 
     /* Trailer */
     if (has_trailer) {
-        int32_t words_trailer = vrt_read_trailer(b + words_total, words_buf - words_total, &packet->trailer);
+        int32_t words_trailer = read_trailer(b + words_total, words_buf - words_total, &packet->trailer, be);
         if (words_trailer < 0) {
             return words_trailer;
         }
@@ -1045,3 +1122,327 @@ int32_t vrt_read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet,
 
     return words_total;
 }
+
+/**
+ * Read VRT packet into a packet view, see vrt_read_packet_view.
+ *
+ * \param be True if the buffer is big endian (network order) rather than host order.
+ */
+static inline int32_t read_packet_view(void*                   buf,
+                                       int32_t                 words_buf,
+                                       struct vrt_packet_view* view,
+                                       bool                    validate,
+                                       bool                    be) {
+    uint32_t* b = (uint32_t*)buf;
+
+    /* Header */
+    int32_t words_header = read_header(b, words_buf, &view->header, validate, be);
+    if (words_header < 0) {
+        return words_header;
+    }
+    int32_t words_total = words_header;
+
+    /* Fields */
+    int32_t words_fields =
+        read_fields(&view->header, b + words_total, words_buf - words_total, &view->fields, validate, be);
+    if (words_fields < 0) {
+        return words_fields;
+    }
+    words_total += words_fields;
+
+    /* Body, which is whatever is left between fields and trailer */
+    bool has_trailer = !vrt_is_context(&view->header) && view->header.has.trailer;
+    view->words_body = view->header.packet_size - words_total - (has_trailer ? 1 : 0);
+    if (view->words_body < 0) {
+        return VRT_ERR_MISMATCH_PACKET_SIZE;
+    }
+    view->body = view->words_body > 0 ? b + words_total : NULL;
+    words_total += view->words_body;
+    if (words_total > words_buf) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    /* Trailer */
+    if (has_trailer) {
+        int32_t words_trailer = read_trailer(b + words_total, words_buf - words_total, &view->trailer, be);
+        if (words_trailer < 0) {
+            return words_trailer;
+        }
+        words_total += words_trailer;
+    }
+
+    return words_total;
+}
+
+/**
+ * Read IF context section of packet view, see vrt_read_view_if_context.
+ *
+ * \param be True if the buffer is big endian (network order) rather than host order.
+ */
+static inline int32_t read_view_if_context(const struct vrt_packet_view* view,
+                                           struct vrt_if_context*        if_context,
+                                           bool                          validate,
+                                           bool                          be) {
+    if (view->header.packet_type != VRT_PT_IF_CONTEXT) {
+        return VRT_ERR_INVALID_PACKET_TYPE;
+    }
+    int32_t rv = read_if_context(view->body, view->words_body, if_context, validate, be);
+    if (rv < 0) {
+        return rv;
+    }
+    if (validate && rv != view->words_body) {
+        return VRT_ERR_MISMATCH_PACKET_SIZE;
+    }
+
+    return rv;
+}
+
+/**
+ * Hash words with 64-bit FNV-1a, one word at a time.
+ *
+ * \param b     Buffer to hash.
+ * \param words Number of 32-bit words to hash.
+ *
+ * \return Hash.
+ */
+static inline uint64_t hash_words(const uint32_t* b, int32_t words) {
+    uint64_t h = 0xCBF29CE484222325U;
+    for (int32_t i = 0; i < words; ++i) {
+        h = (h ^ b[i]) * 0x00000100000001B3U;
+    }
+    return h;
+}
+
+/**
+ * Read IF context section through a cache, see vrt_read_if_context_cached.
+ *
+ * \param be True if the buffer is big endian (network order) rather than host order.
+ */
+static inline int32_t read_if_context_cached(const void*               buf,
+                                             int32_t                   words_buf,
+                                             struct vrt_context_cache* cache,
+                                             bool                      validate,
+                                             bool                      be) {
+    if (words_buf < 1) {
+        cache->words = 0;
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    /*
+     * The indicator field tells the section size, which is needed to know what to hash. Decoding it straight into the
+     * cache is fine, since it is part of the hashed words and is either identical on a hit or overwritten on a miss.
+     */
+    const uint32_t* b  = (const uint32_t*)buf;
+    int32_t         rv = if_context_read_indicator_field(read_uint32(b, be), &cache->if_context, validate);
+    if (rv < 0) {
+        cache->words = 0;
+        return rv;
+    }
+    int32_t words = vrt_words_if_context_indicator(&cache->if_context.has);
+
+    /* The hash is only a quick reject, a hit also needs the raw words to match so a collision can not pass */
+    uint64_t hash = words_buf < words ? 0 : hash_words(b, words);
+    if (words_buf >= words && cache->words == words && cache->hash == hash && cache->be == be &&
+        (cache->validated || !validate) && memcmp(cache->raw, b, (size_t)words * sizeof(uint32_t)) == 0) {
+        cache->changed = false;
+        cache->hits++;
+        return words;
+    }
+
+    cache->changed = true;
+    cache->misses++;
+    rv = read_if_context(buf, words_buf, &cache->if_context, validate, be);
+    if (rv < 0 || cache->if_context.has.gps_ascii || cache->if_context.has.context_association_lists) {
+        cache->words = 0;
+        return rv;
+    }
+    memcpy(cache->raw, b, (size_t)rv * sizeof(uint32_t));
+    cache->hash      = hash;
+    cache->words     = rv;
+    cache->be        = be;
+    cache->validated = validate;
+
+    return rv;
+}
+
+/**
+ * Peek at VRT packet, see vrt_peek_packet.
+ *
+ * \param be True if the buffer is big endian (network order) rather than host order.
+ */
+static inline int32_t peek_packet(const void*             buf,
+                                  int32_t                 words_buf,
+                                  struct vrt_packet_desc* desc,
+                                  bool                    validate,
+                                  bool                    be) {
+    const uint32_t* b = (const uint32_t*)buf;
+
+    /* Header */
+    int32_t words_header = read_header(b, words_buf, &desc->header, validate, be);
+    if (words_header < 0) {
+        return words_header;
+    }
+
+    /* Fields, where only the stream ID is kept */
+    struct vrt_fields fields;
+    int32_t           words_fields =
+        read_fields(&desc->header, b + words_header, words_buf - words_header, &fields, validate, be);
+    if (words_fields < 0) {
+        return words_fields;
+    }
+
+    int32_t words_packet = desc->header.packet_size;
+    int32_t words_before = words_header + words_fields;
+    int32_t words_after  = vrt_words_trailer(&desc->header);
+
+    /* Always check sizes, since the descriptor is meaningless otherwise */
+    if (words_packet < words_before + words_after) {
+        return VRT_ERR_MISMATCH_PACKET_SIZE;
+    }
+    if (words_packet > words_buf) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    desc->stream_id   = fields.stream_id;
+    desc->offset      = 0;
+    desc->offset_body = words_before;
+    desc->words_body  = words_packet - words_before - words_after;
+
+    return words_packet;
+}
+
+/**
+ * Frame VRT packets, see vrt_frame_packets.
+ *
+ * \param be True if the buffer is big endian (network order) rather than host order.
+ */
+static inline int32_t frame_packets(const void*             buf,
+                                    int32_t                 words_buf,
+                                    struct vrt_packet_desc* descs,
+                                    int32_t                 max_descs,
+                                    bool                    validate,
+                                    bool                    be) {
+    const uint32_t* b      = (const uint32_t*)buf;
+    int32_t         offset = 0;
+    int32_t         n      = 0;
+
+    while (n < max_descs && offset < words_buf) {
+        int32_t rv = peek_packet(b + offset, words_buf - offset, descs + n, validate, be);
+        if (rv < 0) {
+            /* An incomplete packet is not an error, it just ends the framing */
+            if (n == 0 && rv != VRT_ERR_BUFFER_SIZE) {
+                return rv;
+            }
+            break;
+        }
+        descs[n].offset = offset;
+        offset += rv;
+        n++;
+    }
+
+    return n;
+}
+
+int32_t vrt_read_header(const void* buf, int32_t words_buf, struct vrt_header* header, bool validate) {
+    return read_header(buf, words_buf, header, validate, false);
+}
+
+int32_t vrt_read_header_be(const void* buf, int32_t words_buf, struct vrt_header* header, bool validate) {
+    return read_header(buf, words_buf, header, validate, true);
+}
+
+int32_t vrt_read_fields(const struct vrt_header* header,
+                        const void*              buf,
+                        int32_t                  words_buf,
+                        struct vrt_fields*       fields,
+                        bool                     validate) {
+    return read_fields(header, buf, words_buf, fields, validate, false);
+}
+
+int32_t vrt_read_fields_be(const struct vrt_header* header,
+                           const void*              buf,
+                           int32_t                  words_buf,
+                           struct vrt_fields*       fields,
+                           bool                     validate) {
+    return read_fields(header, buf, words_buf, fields, validate, true);
+}
+
+int32_t vrt_read_trailer(const void* buf, int32_t words_buf, struct vrt_trailer* trailer) {
+    return read_trailer(buf, words_buf, trailer, false);
+}
+
+int32_t vrt_read_trailer_be(const void* buf, int32_t words_buf, struct vrt_trailer* trailer) {
+    return read_trailer(buf, words_buf, trailer, true);
+}
+
+int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_context* if_context, bool validate) {
+    return read_if_context(buf, words_buf, if_context, validate, false);
+}
+
+int32_t vrt_read_if_context_be(const void* buf, int32_t words_buf, struct vrt_if_context* if_context, bool validate) {
+    return read_if_context(buf, words_buf, if_context, validate, true);
+}
+
+int32_t vrt_read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet, bool validate) {
+    return read_packet(buf, words_buf, packet, validate, false);
+}
+
+int32_t vrt_read_packet_be(void* buf, int32_t words_buf, struct vrt_packet* packet, bool validate) {
+    return read_packet(buf, words_buf, packet, validate, true);
+}
+
+int32_t vrt_peek_packet(const void* buf, int32_t words_buf, struct vrt_packet_desc* desc, bool validate) {
+    return peek_packet(buf, words_buf, desc, validate, false);
+}
+
+int32_t vrt_peek_packet_be(const void* buf, int32_t words_buf, struct vrt_packet_desc* desc, bool validate) {
+    return peek_packet(buf, words_buf, desc, validate, true);
+}
+
+int32_t vrt_frame_packets(const void*             buf,
+                          int32_t                 words_buf,
+                          struct vrt_packet_desc* descs,
+                          int32_t                 max_descs,
+                          bool                    validate) {
+    return frame_packets(buf, words_buf, descs, max_descs, validate, false);
+}
+
+int32_t vrt_frame_packets_be(const void*             buf,
+                             int32_t                 words_buf,
+                             struct vrt_packet_desc* descs,
+                             int32_t                 max_descs,
+                             bool                    validate) {
+    return frame_packets(buf, words_buf, descs, max_descs, validate, true);
+}
+
+int32_t vrt_read_if_context_cached(const void*               buf,
+                                   int32_t                   words_buf,
+                                   struct vrt_context_cache* cache,
+                                   bool                      validate) {
+    return read_if_context_cached(buf, words_buf, cache, validate, false);
+}
+
+int32_t vrt_read_if_context_cached_be(const void*               buf,
+                                      int32_t                   words_buf,
+                                      struct vrt_context_cache* cache,
+                                      bool                      validate) {
+    return read_if_context_cached(buf, words_buf, cache, validate, true);
+}
+
+int32_t vrt_read_packet_view(void* buf, int32_t words_buf, struct vrt_packet_view* view, bool validate) {
+    return read_packet_view(buf, words_buf, view, validate, false);
+}
+
+int32_t vrt_read_packet_view_be(void* buf, int32_t words_buf, struct vrt_packet_view* view, bool validate) {
+    return read_packet_view(buf, words_buf, view, validate, true);
+}
+
+int32_t vrt_read_view_if_context(const struct vrt_packet_view* view, struct vrt_if_context* if_context, bool validate) {
+    return read_view_if_context(view, if_context, validate, false);
+}
+
+int32_t vrt_read_view_if_context_be(const struct vrt_packet_view* view,
+                                    struct vrt_if_context*        if_context,
+                                    bool                          validate) {
+    return read_view_if_context(view, if_context, validate, true);
+}
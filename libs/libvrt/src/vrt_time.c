@@ -19,7 +19,7 @@ static const uint64_t PS_IN_S = 1000000000000;
  * \param fs2         Fractional second timestamp 2.
  * \param is1         Integer second timestamp 1.
  * \param fs1         Fractional second timestamp 1.
- * \param sample_rate Sample rate [Hz].
+ * \param sample_rate Sample rate [Hz]. Must be positive.
  * \param diff        Time difference [out].
  *
  * \return 0, or error code if error.
@@ -32,9 +32,6 @@ static int diff_sample_count(enum vrt_tsi     tsi2,
                              double           sample_rate,
                              struct vrt_time* diff) {
     /* Sanity check */
-    if (sample_rate <= 0.0) {
-        return VRT_ERR_MISSING_SAMPLE_RATE;
-    }
     uint64_t sample_rate_i = (uint64_t)sample_rate;
     if (fs2 >= sample_rate_i || fs1 >= sample_rate_i) {
         return VRT_ERR_BOUNDS_SAMPLE_COUNT;
@@ -103,7 +100,7 @@ static int diff_real_time(enum vrt_tsi     tsi2,
  * \param fs2         Fractional second timestamp 2.
  * \param is1         Integer second timestamp 1.
  * \param fs1         Fractional second timestamp 1.
- * \param sample_rate Sample rate [Hz].
+ * \param sample_rate Sample rate [Hz]. Must be positive.
  * \param diff        Time difference [out].
  *
  * \return 0, or error code if error.
@@ -115,11 +112,6 @@ static int diff_free_running_count(enum vrt_tsi     tsi2,
                                    uint64_t         fs1,
                                    double           sample_rate,
                                    struct vrt_time* diff) {
-    /* Sanity check */
-    if (sample_rate <= 0.0) {
-        return VRT_ERR_MISSING_SAMPLE_RATE;
-    }
-
     /* Cannot use floating point modulo */
     uint64_t sample_rate_i = (uint64_t)sample_rate;
 
@@ -260,26 +252,48 @@ static int diff_tsi_and_tsf(enum vrt_tsi     tsi2,
     return 0;
 }
 
-int vrt_time_difference_fields(const struct vrt_header* h2,
-                               const struct vrt_fields* f2,
-                               const struct vrt_header* h1,
-                               const struct vrt_fields* f1,
-                               double                   sample_rate,
-                               struct vrt_time*         diff) {
-    enum vrt_tsi tsi2 = h2->tsi;
-    enum vrt_tsf tsf2 = h2->tsf;
-    uint32_t     is2  = f2->integer_seconds_timestamp;
-    uint64_t     fs2  = f2->fractional_seconds_timestamp;
-    enum vrt_tsi tsi1 = h1->tsi;
-    enum vrt_tsf tsf1 = h1->tsf;
-    uint32_t     is1  = f1->integer_seconds_timestamp;
-    uint64_t     fs1  = f1->fractional_seconds_timestamp;
-
-    /* Sanity check */
-    if (tsi2 != tsi1 || tsf2 != tsf1) {
-        return VRT_ERR_MISMATCH_TIME_TYPES;
+/**
+ * Check that a sample rate is provided if the fractional timestamp type needs one.
+ *
+ * \param tsf         Timestamp fractional.
+ * \param sample_rate Sample rate [Hz].
+ *
+ * \return 0, or error code if error.
+ */
+static inline int check_sample_rate(enum vrt_tsf tsf, double sample_rate) {
+    if ((tsf == VRT_TSF_SAMPLE_COUNT || tsf == VRT_TSF_FREE_RUNNING_COUNT) && sample_rate <= 0.0) {
+        return VRT_ERR_MISSING_SAMPLE_RATE;
     }
 
+    return 0;
+}
+
+/**
+ * Calculate time difference between timestamps of the same type.
+ *
+ * \param tsi2        Timestamp integer 2.
+ * \param tsf2        Timestamp fractional 2.
+ * \param is2         Integer second timestamp 2.
+ * \param fs2         Fractional second timestamp 2.
+ * \param is1         Integer second timestamp 1.
+ * \param fs1         Fractional second timestamp 1.
+ * \param sample_rate Sample rate [Hz].
+ * \param diff        Time difference [out].
+ *
+ * \return 0, or error code if error.
+ */
+static inline int time_difference(enum vrt_tsi     tsi2,
+                                  enum vrt_tsf     tsf2,
+                                  uint32_t         is2,
+                                  uint64_t         fs2,
+                                  uint32_t         is1,
+                                  uint64_t         fs1,
+                                  double           sample_rate,
+                                  struct vrt_time* diff) {
+    int rv = check_sample_rate(tsf2, sample_rate);
+    if (rv < 0) {
+        return rv;
+    }
     if (tsi2 == VRT_TSI_NONE && tsf2 == VRT_TSF_NONE) {
         return diff_none(diff);
     }
@@ -293,6 +307,87 @@ int vrt_time_difference_fields(const struct vrt_header* h2,
     return diff_tsi_and_tsf(tsi2, tsf2, is2, fs2, is1, fs1, sample_rate, diff);
 }
 
+int vrt_time_difference_fields(const struct vrt_header* h2,
+                               const struct vrt_fields* f2,
+                               const struct vrt_header* h1,
+                               const struct vrt_fields* f1,
+                               double                   sample_rate,
+                               struct vrt_time*         diff) {
+    /* Sanity check */
+    if (h2->tsi != h1->tsi || h2->tsf != h1->tsf) {
+        return VRT_ERR_MISMATCH_TIME_TYPES;
+    }
+
+    return time_difference(h2->tsi, h2->tsf, f2->integer_seconds_timestamp, f2->fractional_seconds_timestamp,
+                           f1->integer_seconds_timestamp, f1->fractional_seconds_timestamp, sample_rate, diff);
+}
+
+int vrt_time_difference_fields_n(const struct vrt_header* header,
+                                 const struct vrt_fields* fields,
+                                 int32_t                  n,
+                                 const struct vrt_fields* reference,
+                                 double                   sample_rate,
+                                 struct vrt_time*         diffs) {
+    if (n <= 0) {
+        return 0;
+    }
+    int rv = check_sample_rate(header->tsf, sample_rate);
+    if (rv < 0) {
+        return rv;
+    }
+
+    /* Same dispatch as time_difference, but once for all elements */
+    enum vrt_tsi tsi = header->tsi;
+    uint32_t     is1 = reference->integer_seconds_timestamp;
+    uint64_t     fs1 = reference->fractional_seconds_timestamp;
+    switch (header->tsf) {
+        case VRT_TSF_NONE: {
+            if (tsi == VRT_TSI_NONE) {
+                for (int32_t i = 0; i < n; ++i) {
+                    diff_none(&diffs[i]);
+                }
+            } else {
+                for (int32_t i = 0; i < n; ++i) {
+                    diff_tsi(fields[i].integer_seconds_timestamp, is1, &diffs[i]);
+                }
+            }
+            break;
+        }
+        case VRT_TSF_SAMPLE_COUNT: {
+            for (int32_t i = 0; i < n; ++i) {
+                rv = diff_sample_count(tsi, fields[i].integer_seconds_timestamp, fields[i].fractional_seconds_timestamp,
+                                       is1, fs1, sample_rate, &diffs[i]);
+                if (rv < 0) {
+                    return rv;
+                }
+            }
+            break;
+        }
+        case VRT_TSF_REAL_TIME: {
+            for (int32_t i = 0; i < n; ++i) {
+                rv = diff_real_time(tsi, fields[i].integer_seconds_timestamp, fields[i].fractional_seconds_timestamp,
+                                    is1, fs1, &diffs[i]);
+                if (rv < 0) {
+                    return rv;
+                }
+            }
+            break;
+        }
+        case VRT_TSF_FREE_RUNNING_COUNT: {
+            for (int32_t i = 0; i < n; ++i) {
+                rv = diff_free_running_count(tsi, fields[i].integer_seconds_timestamp,
+                                             fields[i].fractional_seconds_timestamp, is1, fs1, sample_rate, &diffs[i]);
+                if (rv < 0) {
+                    return rv;
+                }
+            }
+            break;
+        }
+    }
+
+    return 0;
+}
+
 int vrt_time_calendar_fields(const struct vrt_header*  header,
                              const struct vrt_fields*  fields,
                              double                    sample_rate,
@@ -301,6 +396,14 @@ int vrt_time_calendar_fields(const struct vrt_header*  header,
                                  fields->fractional_seconds_timestamp, sample_rate, cal_time);
 }
 
+int vrt_time_calendar_fields_n(const struct vrt_header*  header,
+                               const struct vrt_fields*  fields,
+                               int32_t                   n,
+                               double                    sample_rate,
+                               struct vrt_calendar_time* cal_times) {
+    return timestamps_to_calendar(header->tsi, header->tsf, fields, n, sample_rate, cal_times);
+}
+
 int vrt_time_difference(const struct vrt_packet* p2,
                         const struct vrt_packet* p1,
                         double                   sample_rate,
@@ -6,6 +6,8 @@
 extern uint32_t vrt_b2u(bool b);
 extern uint32_t vrt_u2b(uint32_t u);
 extern bool     vrt_has_fractional_timestamp(enum vrt_tsf t);
+extern uint32_t vrt_be32_to_host(uint32_t u);
+extern uint32_t vrt_host_to_be32(uint32_t u);
 
 int32_t vrt_words_if_context_indicator(const struct vrt_context_indicators* ind) {
     /* For context indicator field */
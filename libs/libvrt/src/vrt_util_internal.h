@@ -3,6 +3,9 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#ifdef _MSC_VER
+#include <stdlib.h>
+#endif
 
 #include "vrt_types.h"
 
@@ -56,6 +59,37 @@ inline bool vrt_has_fractional_timestamp(enum vrt_tsf t) {
     return t != VRT_TSF_NONE;
 }
 
+/**
+ * Convert a word read from a big endian (network order) buffer to host order.
+ *
+ * \param u Word as stored in the buffer.
+ *
+ * \return Word in host order.
+ */
+inline uint32_t vrt_be32_to_host(uint32_t u) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return u;
+#elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(u);
+#elif defined(_MSC_VER)
+    return _byteswap_ulong(u);
+#else
+    return (u >> 24U) | ((u >> 8U) & 0x0000FF00U) | ((u << 8U) & 0x00FF0000U) | (u << 24U);
+#endif
+}
+
+/**
+ * Convert a word in host order to big endian (network order), for writing to a buffer.
+ *
+ * \param u Word in host order.
+ *
+ * \return Word as it shall be stored in the buffer.
+ */
+inline uint32_t vrt_host_to_be32(uint32_t u) {
+    /* Swapping is its own inverse */
+    return vrt_be32_to_host(u);
+}
+
 /**
  * Calculate partial size in 32-bit words of IF context section, from the information available in the context indicator
  * section.
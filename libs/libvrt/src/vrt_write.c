@@ -36,6 +36,38 @@ static inline void write_uint64(uint64_t val, uint32_t* b) {
     b[1] = (uint32_t)val;
 }
 
+/**
+ * Byte swap words in place from host to network order. Used right after a section has been written, while it is still
+ * in cache, so the buffer is never traversed a second time.
+ *
+ * \param buf   Buffer of written words.
+ * \param words Number of words to swap.
+ */
+static inline void swap_to_network_order(void* buf, int32_t words) {
+    uint32_t* b = (uint32_t*)buf;
+    for (int32_t i = 0; i < words; ++i) {
+        b[i] = vrt_host_to_be32(b[i]);
+    }
+}
+
+/**
+ * Copy words, optionally converting them from host to network order in the same pass.
+ *
+ * \param dst   Buffer to write to.
+ * \param src   Words to copy.
+ * \param words Number of words to copy.
+ * \param swap  True if the words shall be byte swapped from host to network order.
+ */
+static inline void copy_words(uint32_t* dst, const uint32_t* src, int32_t words, bool swap) {
+    if (!swap) {
+        memcpy(dst, src, sizeof(uint32_t) * words);
+        return;
+    }
+    for (int32_t i = 0; i < words; ++i) {
+        dst[i] = vrt_host_to_be32(src[i]);
+    }
+}
+
 int32_t vrt_write_header(const struct vrt_header* header, void* buf, int32_t words_buf, bool validate) {
     /* Note that it makes sense to have words_buf as signed, to avoid overflow for words_buf - offset */
 
@@ -833,11 +865,23 @@ int32_t vrt_write_if_context(const struct vrt_if_context* if_context, void* buf,
     return words;
 }
 
-int32_t vrt_write_packet(const struct vrt_packet* packet, void* buf, int32_t words_buf, bool validate) {
+/**
+ * Write full VRT packet, see vrt_write_packet.
+ *
+ * \param be        True if the buffer shall be big endian (network order) rather than host order.
+ * \param swap_body True if the body shall be byte swapped from host to network order while copied.
+ */
+static inline int32_t write_packet(const struct vrt_packet* packet,
+                                   void*                    buf,
+                                   int32_t                  words_buf,
+                                   bool                     validate,
+                                   bool                     be,
+                                   bool                     swap_body) {
     uint32_t* b = (uint32_t*)buf;
 
     /* Header */
-    int32_t words_header = vrt_write_header(&packet->header, b, words_buf, validate);
+    int32_t words_header = be ? vrt_write_header_be(&packet->header, b, words_buf, validate)
+                              : vrt_write_header(&packet->header, b, words_buf, validate);
     if (words_header < 0) {
         return words_header;
     }
@@ -845,7 +889,8 @@ int32_t vrt_write_packet(const struct vrt_packet* packet, void* buf, int32_t wor
 
     /* Fields */
     int32_t words_fields =
-        vrt_write_fields(&packet->header, &packet->fields, b + words_total, words_buf - words_total, validate);
+        be ? vrt_write_fields_be(&packet->header, &packet->fields, b + words_total, words_buf - words_total, validate)
+           : vrt_write_fields(&packet->header, &packet->fields, b + words_total, words_buf - words_total, validate);
     if (words_fields < 0) {
         return words_fields;
     }
@@ -865,7 +910,7 @@ int32_t vrt_write_packet(const struct vrt_packet* packet, void* buf, int32_t wor
 
             /* Body is actually optional */
             if (packet->words_body != 0) {
-                memcpy(b + words_total, packet->body, sizeof(uint32_t) * packet->words_body);
+                copy_words(b + words_total, (const uint32_t*)packet->body, packet->words_body, swap_body);
             }
             words_total += packet->words_body;
             break;
@@ -873,7 +918,8 @@ int32_t vrt_write_packet(const struct vrt_packet* packet, void* buf, int32_t wor
         case VRT_PT_IF_CONTEXT: {
             /* IF context */
             int32_t words_if_context =
-                vrt_write_if_context(&packet->if_context, b + words_total, words_buf - words_total, validate);
+                be ? vrt_write_if_context_be(&packet->if_context, b + words_total, words_buf - words_total, validate)
+                   : vrt_write_if_context(&packet->if_context, b + words_total, words_buf - words_total, validate);
             if (words_if_context < 0) {
                 return words_if_context;
             }
@@ -888,7 +934,9 @@ int32_t vrt_write_packet(const struct vrt_packet* packet, void* buf, int32_t wor
 
     /* Trailer */
     if (!vrt_is_context(&packet->header) && packet->header.has.trailer) {
-        int32_t words_trailer = vrt_write_trailer(&packet->trailer, b + words_total, words_buf - words_total, validate);
+        int32_t words_trailer =
+            be ? vrt_write_trailer_be(&packet->trailer, b + words_total, words_buf - words_total, validate)
+               : vrt_write_trailer(&packet->trailer, b + words_total, words_buf - words_total, validate);
         if (words_trailer < 0) {
             return words_trailer;
         }
@@ -901,8 +949,247 @@ int32_t vrt_write_packet(const struct vrt_packet* packet, void* buf, int32_t wor
     }
 
     /* Write packet size directly into buffer to avoid copying const header */
-    b[0] &= 0xFFFF0000;
-    b[0] |= (uint16_t)words_total;
+    uint32_t header_word = be ? vrt_be32_to_host(b[0]) : b[0];
+    header_word &= 0xFFFF0000;
+    header_word |= (uint16_t)words_total;
+    b[0] = be ? vrt_host_to_be32(header_word) : header_word;
 
     return words_total;
 }
+
+int32_t vrt_write_packet(const struct vrt_packet* packet, void* buf, int32_t words_buf, bool validate) {
+    return write_packet(packet, buf, words_buf, validate, false, false);
+}
+
+int32_t vrt_write_header_be(const struct vrt_header* header, void* buf, int32_t words_buf, bool validate) {
+    int32_t rv = vrt_write_header(header, buf, words_buf, validate);
+    if (rv > 0) {
+        swap_to_network_order(buf, rv);
+    }
+    return rv;
+}
+
+int32_t vrt_write_fields_be(const struct vrt_header* header,
+                            const struct vrt_fields* fields,
+                            void*                    buf,
+                            int32_t                  words_buf,
+                            bool                     validate) {
+    int32_t rv = vrt_write_fields(header, fields, buf, words_buf, validate);
+    if (rv > 0) {
+        swap_to_network_order(buf, rv);
+    }
+    return rv;
+}
+
+int32_t vrt_write_trailer_be(const struct vrt_trailer* trailer, void* buf, int32_t words_buf, bool validate) {
+    int32_t rv = vrt_write_trailer(trailer, buf, words_buf, validate);
+    if (rv > 0) {
+        swap_to_network_order(buf, rv);
+    }
+    return rv;
+}
+
+int32_t vrt_write_if_context_be(const struct vrt_if_context* if_context, void* buf, int32_t words_buf, bool validate) {
+    int32_t rv = vrt_write_if_context(if_context, buf, words_buf, validate);
+    if (rv > 0) {
+        swap_to_network_order(buf, rv);
+    }
+    return rv;
+}
+
+int32_t vrt_write_packet_be(const struct vrt_packet* packet,
+                            void*                    buf,
+                            int32_t                  words_buf,
+                            bool                     validate,
+                            bool                     swap_body) {
+    return write_packet(packet, buf, words_buf, validate, true, swap_body);
+}
+
+/* Picoseconds per second, i.e. the roll over point of a real-time fractional timestamp */
+static const uint64_t PS_PER_S = 1000000000000;
+
+void vrt_packetizer_init(struct vrt_packetizer*   packetizer,
+                         const struct vrt_packet* packet,
+                         int32_t                  words_per_packet,
+                         int32_t                  words_per_sample,
+                         uint64_t                 sample_rate) {
+    packetizer->packet            = *packet;
+    packetizer->packet.body       = NULL;
+    packetizer->packet.words_body = 0;
+    packetizer->context           = NULL;
+    packetizer->context_interval  = 0;
+    packetizer->words_per_packet  = words_per_packet;
+    packetizer->words_per_sample  = words_per_sample;
+    packetizer->sample_rate       = sample_rate;
+    packetizer->remainder         = 0;
+    packetizer->context_count     = 0;
+    packetizer->since_context     = -1;
+}
+
+/**
+ * Advance timestamps of the packetizer template by a number of samples.
+ *
+ * \param p       Packetizer.
+ * \param samples Number of samples in the packet that was just written. At most UINT16_MAX.
+ */
+static inline void packetizer_advance(struct vrt_packetizer* p, uint64_t samples) {
+    struct vrt_fields* f = &p->packet.fields;
+    switch (p->packet.header.tsf) {
+        case VRT_TSF_SAMPLE_COUNT: {
+            f->fractional_seconds_timestamp += samples;
+            if (p->packet.header.tsi != VRT_TSI_NONE && p->sample_rate > 0) {
+                f->integer_seconds_timestamp += (uint32_t)(f->fractional_seconds_timestamp / p->sample_rate);
+                f->fractional_seconds_timestamp %= p->sample_rate;
+            }
+            break;
+        }
+        case VRT_TSF_REAL_TIME: {
+            /* Cannot overflow since samples fit in a packet, i.e. samples * 10^12 < 2^63 */
+            uint64_t total = samples * PS_PER_S + p->remainder;
+            f->fractional_seconds_timestamp += total / p->sample_rate;
+            p->remainder = total % p->sample_rate;
+            if (f->fractional_seconds_timestamp >= PS_PER_S) {
+                f->integer_seconds_timestamp += (uint32_t)(f->fractional_seconds_timestamp / PS_PER_S);
+                f->fractional_seconds_timestamp %= PS_PER_S;
+            }
+            break;
+        }
+        case VRT_TSF_FREE_RUNNING_COUNT: {
+            f->fractional_seconds_timestamp += samples;
+            break;
+        }
+        default: {
+            /* No fractional timestamp, so count samples until a whole second has passed */
+            if (p->packet.header.tsi != VRT_TSI_NONE && p->sample_rate > 0) {
+                p->remainder += samples;
+                f->integer_seconds_timestamp += (uint32_t)(p->remainder / p->sample_rate);
+                p->remainder %= p->sample_rate;
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * Write context packet of the packetizer, with timestamps of the next data packet if they are of the same kind.
+ *
+ * \return Number of written words, or a negative number if error.
+ */
+static inline int32_t packetizer_write_context(struct vrt_packetizer* p,
+                                               uint32_t*              b,
+                                               int32_t                words_buf,
+                                               bool                   validate,
+                                               bool                   be) {
+    struct vrt_packet context   = *p->context;
+    context.header.packet_count = p->context_count;
+    if (context.header.tsi == p->packet.header.tsi && context.header.tsf == p->packet.header.tsf) {
+        context.fields.integer_seconds_timestamp    = p->packet.fields.integer_seconds_timestamp;
+        context.fields.fractional_seconds_timestamp = p->packet.fields.fractional_seconds_timestamp;
+    }
+    int32_t rv = write_packet(&context, b, words_buf, validate, be, false);
+    if (rv >= 0) {
+        p->context_count = (uint8_t)((p->context_count + 1U) & 0xFU);
+        p->since_context = 0;
+    }
+    return rv;
+}
+
+/**
+ * Write samples as data packets, see vrt_packetize.
+ *
+ * \param be        True if the buffer shall be big endian (network order) rather than host order.
+ * \param swap_body True if the samples shall be byte swapped from host to network order while copied.
+ */
+static inline int32_t packetize(struct vrt_packetizer* p,
+                                const void*            samples,
+                                int32_t                words_samples,
+                                void*                  buf,
+                                int32_t                words_buf,
+                                bool                   validate,
+                                bool                   be,
+                                bool                   swap_body,
+                                int32_t*               words_consumed) {
+    *words_consumed = 0;
+    if (p->words_per_sample <= 0 || p->words_per_packet <= 0 || p->words_per_packet % p->words_per_sample != 0 ||
+        p->words_per_packet > UINT16_MAX - VRT_WORDS_HEADER - vrt_words_fields(&p->packet.header) -
+                                  vrt_words_trailer(&p->packet.header)) {
+        return VRT_ERR_BOUNDS_PACKET_SIZE;
+    }
+    if ((p->packet.header.tsf == VRT_TSF_SAMPLE_COUNT || p->packet.header.tsf == VRT_TSF_REAL_TIME) &&
+        p->sample_rate == 0) {
+        return VRT_ERR_MISSING_SAMPLE_RATE;
+    }
+
+    uint32_t*       b     = (uint32_t*)buf;
+    const uint32_t* s     = (const uint32_t*)samples;
+    int32_t         total = 0;
+    int32_t         left  = words_samples - words_samples % p->words_per_sample;
+    while (left > 0) {
+        int32_t words_body = left < p->words_per_packet ? left : p->words_per_packet;
+
+        /* Context packet, if due. Written only if the data packet after it is written as well, so it is never
+         * orphaned. */
+        int32_t words_context = 0;
+        uint8_t context_count = p->context_count;
+        int32_t since_context = p->since_context;
+        if (p->context != NULL &&
+            (p->since_context < 0 || (p->context_interval > 0 && p->since_context >= p->context_interval))) {
+            words_context = packetizer_write_context(p, b + total, words_buf - total, validate, be);
+            if (words_context == VRT_ERR_BUFFER_SIZE) {
+                break;
+            }
+            if (words_context < 0) {
+                return words_context;
+            }
+        }
+
+        /* Data packet */
+        p->packet.body       = (void*)(s + *words_consumed);
+        p->packet.words_body = words_body;
+        int32_t rv = write_packet(&p->packet, b + total + words_context, words_buf - total - words_context, validate,
+                                  be, swap_body);
+        p->packet.body       = NULL;
+        p->packet.words_body = 0;
+        if (rv < 0) {
+            /* Roll back the context packet, so it is written again with the data packet next call */
+            p->context_count = context_count;
+            p->since_context = since_context;
+            if (rv == VRT_ERR_BUFFER_SIZE) {
+                break;
+            }
+            return rv;
+        }
+
+        total += words_context + rv;
+        *words_consumed += words_body;
+        left -= words_body;
+        p->packet.header.packet_count = (uint8_t)((p->packet.header.packet_count + 1U) & 0xFU);
+        if (p->since_context >= 0) {
+            p->since_context++;
+        }
+        packetizer_advance(p, (uint64_t)(words_body / p->words_per_sample));
+    }
+
+    return total;
+}
+
+int32_t vrt_packetize(struct vrt_packetizer* packetizer,
+                      const void*            samples,
+                      int32_t                words_samples,
+                      void*                  buf,
+                      int32_t                words_buf,
+                      bool                   validate,
+                      int32_t*               words_consumed) {
+    return packetize(packetizer, samples, words_samples, buf, words_buf, validate, false, false, words_consumed);
+}
+
+int32_t vrt_packetize_be(struct vrt_packetizer* packetizer,
+                         const void*            samples,
+                         int32_t                words_samples,
+                         void*                  buf,
+                         int32_t                words_buf,
+                         bool                   validate,
+                         bool                   swap_body,
+                         int32_t*               words_consumed) {
+    return packetize(packetizer, samples, words_samples, buf, words_buf, validate, true, swap_body, words_consumed);
+}
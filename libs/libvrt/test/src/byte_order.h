@@ -0,0 +1,67 @@
+#ifndef TEST_SRC_BYTE_ORDER_H_
+#define TEST_SRC_BYTE_ORDER_H_
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <vrt/vrt_util.h>
+
+/**
+ * Byte order of the buffer a read or write test runs against.
+ */
+enum class ByteOrder { HOST, NETWORK };
+
+/**
+ * Name of a byte order, used as suffix of parameterized test names.
+ *
+ * \param info Test parameter info.
+ *
+ * \return "Host" or "Network".
+ */
+inline std::string byte_order_name(const ::testing::TestParamInfo<ByteOrder>& info) {
+    return info.param == ByteOrder::HOST ? "Host" : "Network";
+}
+
+/**
+ * Byte swap all words of a buffer between host and network order. Does nothing on big endian platforms.
+ *
+ * \param buf Buffer to swap in place.
+ */
+template <std::size_t N>
+void swap_to_network_order(std::array<uint32_t, N>* buf) {
+    if (!vrt_is_platform_little_endian()) {
+        return;
+    }
+    for (uint32_t& w : *buf) {
+        w = (w >> 24U) | ((w >> 8U) & 0x0000FF00U) | ((w << 8U) & 0x00FF0000U) | (w << 24U);
+    }
+}
+
+/**
+ * Run a read or write function in the given byte order. For network order the buffer is swapped in place before
+ * calling the big endian variant and swapped back afterwards, so both pointers into the buffer and its contents look
+ * the same to the assertions regardless of byte order.
+ *
+ * \param order   Byte order to run in.
+ * \param buf     Buffer the function reads from or writes to.
+ * \param host    Function for host order buffers.
+ * \param network Function for network order buffers.
+ *
+ * \return Return value of the function.
+ */
+template <std::size_t N, typename Host, typename Network>
+int32_t call_in_order(ByteOrder order, std::array<uint32_t, N>* buf, Host host, Network network) {
+    if (order == ByteOrder::HOST) {
+        return host();
+    }
+    swap_to_network_order(buf);
+    int32_t rv = network();
+    swap_to_network_order(buf);
+    return rv;
+}
+
+#endif
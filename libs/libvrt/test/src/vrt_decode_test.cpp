@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include <vrt/vrt_decode.hpp>
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_types.h>
+
+#include "byte_order.h"
+
+/* Layouts covering every header flag, besides the typical one */
+using ExtDataClassIdRealTime =
+    vrt::data_layout<VRT_PT_EXT_DATA_WITH_STREAM_ID, true, false, VRT_TSI_GPS, VRT_TSF_REAL_TIME>;
+using IfDataNoStreamIdTrailer =
+    vrt::data_layout<VRT_PT_IF_DATA_WITHOUT_STREAM_ID, false, true, VRT_TSI_NONE, VRT_TSF_NONE>;
+using ExtDataFreeRunning =
+    vrt::data_layout<VRT_PT_EXT_DATA_WITHOUT_STREAM_ID, true, true, VRT_TSI_OTHER, VRT_TSF_FREE_RUNNING_COUNT>;
+using IfDataIntegerOnly = vrt::data_layout<VRT_PT_IF_DATA_WITH_STREAM_ID, false, false, VRT_TSI_UTC, VRT_TSF_NONE>;
+
+template <typename Out>
+static int32_t decode(void* buf, int32_t words_buf, Out* out, bool validate);
+template <>
+int32_t decode(void* buf, int32_t words_buf, vrt_packet* out, bool validate) {
+    return vrt::read_packet<vrt::if_data_utc_sample_count, ExtDataClassIdRealTime, IfDataNoStreamIdTrailer,
+                            ExtDataFreeRunning, IfDataIntegerOnly>(buf, words_buf, out, validate);
+}
+template <>
+int32_t decode(void* buf, int32_t words_buf, vrt_packet_view* out, bool validate) {
+    return vrt::read_packet_view<vrt::if_data_utc_sample_count, ExtDataClassIdRealTime, IfDataNoStreamIdTrailer,
+                                 ExtDataFreeRunning, IfDataIntegerOnly>(buf, words_buf, out, validate);
+}
+
+template <typename Out>
+static int32_t decode_be(void* buf, int32_t words_buf, Out* out, bool validate);
+template <>
+int32_t decode_be(void* buf, int32_t words_buf, vrt_packet* out, bool validate) {
+    return vrt::read_packet_be<vrt::if_data_utc_sample_count, ExtDataClassIdRealTime, IfDataNoStreamIdTrailer,
+                               ExtDataFreeRunning, IfDataIntegerOnly>(buf, words_buf, out, validate);
+}
+template <>
+int32_t decode_be(void* buf, int32_t words_buf, vrt_packet_view* out, bool validate) {
+    return vrt::read_packet_view_be<vrt::if_data_utc_sample_count, ExtDataClassIdRealTime, IfDataNoStreamIdTrailer,
+                                    ExtDataFreeRunning, IfDataIntegerOnly>(buf, words_buf, out, validate);
+}
+
+static int32_t decode_generic(void* buf, int32_t words_buf, vrt_packet* out, bool validate) {
+    return vrt_read_packet(buf, words_buf, out, validate);
+}
+static int32_t decode_generic(void* buf, int32_t words_buf, vrt_packet_view* out, bool validate) {
+    return vrt_read_packet_view(buf, words_buf, out, validate);
+}
+static int32_t decode_generic_be(void* buf, int32_t words_buf, vrt_packet* out, bool validate) {
+    return vrt_read_packet_be(buf, words_buf, out, validate);
+}
+static int32_t decode_generic_be(void* buf, int32_t words_buf, vrt_packet_view* out, bool validate) {
+    return vrt_read_packet_view_be(buf, words_buf, out, validate);
+}
+
+class DecodeTest : public ::testing::TestWithParam<ByteOrder> {
+   protected:
+    void SetUp() override { buf_.fill(0xBAADF00D); }
+
+    /* Writes a packet with the given header bits and fields, and a body of 3 words. Returns its number of words. */
+    uint16_t write(uint32_t type, bool class_id, bool trailer, bool tsm, uint32_t tsi, uint32_t tsf) {
+        buf_.fill(0xBAADF00D);
+        uint16_t i = 1;
+        if ((type & 0x5U) != 0) {
+            buf_[i++] = 0xABABABAB;
+        }
+        if (class_id) {
+            buf_[i++] = 0x00123456;
+            buf_[i++] = 0x789ABCDE;
+        }
+        if (tsi != 0) {
+            buf_[i++] = 0x5FE3A0F4;
+        }
+        if (tsf != 0) {
+            buf_[i++] = 0x000000E8;
+            buf_[i++] = 0xD4A50FFF;
+        }
+        for (uint32_t j = 0; j < 3; ++j) {
+            buf_[i++] = 0xCE000000 + j;
+        }
+        if (trailer) {
+            buf_[i++] = 0xC0080000;
+        }
+        set_size(type << 28U | static_cast<uint32_t>(class_id) << 27U | static_cast<uint32_t>(trailer) << 26U |
+                     static_cast<uint32_t>(tsm) << 24U | tsi << 22U | tsf << 20U | 0x000A0000U,
+                 i);
+        return i;
+    }
+
+    /* Replaces header word, keeping everything but packet size, and sets packet size */
+    void set_size(uint32_t header, uint16_t size) { buf_[0] = (header & 0xFFFF0000U) | size; }
+
+    /* Reads buf_ both with the specialized decoders and the generic one, and checks that results are identical */
+    template <typename Out>
+    void assert_identical(int32_t words_buf, bool validate) {
+        Out expected;
+        Out actual;
+        std::memset(&expected, 0x5A, sizeof(expected));
+        std::memset(&actual, 0x5A, sizeof(actual));
+        int32_t rv_expected = call_in_order(
+            GetParam(), &buf_, [&] { return decode_generic(buf_.data(), words_buf, &expected, validate); },
+            [&] { return decode_generic_be(buf_.data(), words_buf, &expected, validate); });
+        int32_t rv_actual = call_in_order(
+            GetParam(), &buf_, [&] { return decode(buf_.data(), words_buf, &actual, validate); },
+            [&] { return decode_be(buf_.data(), words_buf, &actual, validate); });
+        ASSERT_EQ(rv_actual, rv_expected);
+        ASSERT_EQ(std::memcmp(&actual, &expected, sizeof(expected)), 0);
+    }
+
+    /* Same as assert_identical, for all buffer sizes up to the full buffer, with and without validation */
+    void assert_identical_all() {
+        for (int32_t words_buf = -1; words_buf <= static_cast<int32_t>(buf_.size()); ++words_buf) {
+            for (bool validate : {false, true}) {
+                SCOPED_TRACE(::testing::Message() << "words_buf = " << words_buf << ", validate = " << validate);
+                assert_identical<vrt_packet>(words_buf, validate);
+                assert_identical<vrt_packet_view>(words_buf, validate);
+            }
+        }
+    }
+
+    /* Runs f for every combination of header flags that affect the layout */
+    template <typename F>
+    static void for_each_header(F f) {
+        for (uint32_t type = 0; type < 8; ++type) {
+            for (uint32_t c = 0; c < 4; ++c) {
+                for (uint32_t tsi = 0; tsi < 4; ++tsi) {
+                    for (uint32_t tsf = 0; tsf < 4; ++tsf) {
+                        SCOPED_TRACE(::testing::Message() << "type = " << type << ", class_id = " << (c & 1U)
+                                                          << ", trailer = " << (c >> 1U) << ", tsi = " << tsi
+                                                          << ", tsf = " << tsf);
+                        f(type, (c & 1U) != 0, (c >> 1U) != 0, tsi, tsf);
+                    }
+                }
+            }
+        }
+    }
+
+    std::array<uint32_t, 16> buf_{};
+};
+
+TEST_P(DecodeTest, Valid) {
+    for_each_header([&](uint32_t type, bool class_id, bool trailer, uint32_t tsi, uint32_t tsf) {
+        for (bool tsm : {false, true}) {
+            write(type, class_id, trailer, tsm, tsi, tsf);
+            assert_identical_all();
+        }
+    });
+}
+
+TEST_P(DecodeTest, SizeMismatch) {
+    for_each_header([&](uint32_t type, bool class_id, bool trailer, uint32_t tsi, uint32_t tsf) {
+        uint16_t words = write(type, class_id, trailer, false, tsi, tsf);
+        for (uint16_t size : {0, 1, 2, 5, 7, static_cast<int>(words + 1), 0xFFFF}) {
+            SCOPED_TRACE(::testing::Message() << "size = " << size);
+            set_size(buf_[0], size);
+            assert_identical_all();
+        }
+    });
+}
+
+TEST_P(DecodeTest, InvalidFields) {
+    for_each_header([&](uint32_t type, bool class_id, bool trailer, uint32_t tsi, uint32_t tsf) {
+        write(type, class_id, trailer, false, tsi, tsf);
+        /* Reserved bits of class identifier, or real time out of bounds, depending on layout */
+        for (uint32_t& w : buf_) {
+            if (w == 0x00123456) {
+                w = 0xFF123456;
+            } else if (w == 0x000000E8) {
+                w = 0xFFFFFFFF;
+            }
+        }
+        assert_identical_all();
+    });
+}
+
+TEST_P(DecodeTest, ReservedHeaderBit) {
+    write(VRT_PT_IF_DATA_WITH_STREAM_ID, false, true, false, VRT_TSI_UTC, VRT_TSF_SAMPLE_COUNT);
+    buf_[0] |= 0x02000000U;
+    assert_identical_all();
+}
+
+INSTANTIATE_TEST_SUITE_P(ByteOrders,
+                         DecodeTest,
+                         ::testing::Values(ByteOrder::HOST, ByteOrder::NETWORK),
+                         byte_order_name);
+
+TEST(DataLayoutTest, Offsets) {
+    ASSERT_EQ(vrt::if_data_utc_sample_count::offset_integer, 2);
+    ASSERT_EQ(vrt::if_data_utc_sample_count::offset_fractional, 3);
+    ASSERT_EQ(vrt::if_data_utc_sample_count::offset_body, 5);
+    ASSERT_EQ(vrt::if_data_utc_sample_count::words_trailer, 1);
+    ASSERT_EQ(ExtDataClassIdRealTime::offset_class_id, 2);
+    ASSERT_EQ(ExtDataClassIdRealTime::offset_body, 7);
+    ASSERT_EQ(IfDataNoStreamIdTrailer::offset_body, 1);
+    ASSERT_EQ(ExtDataFreeRunning::offset_class_id, 1);
+    ASSERT_EQ(ExtDataFreeRunning::offset_body, 6);
+}
+
+TEST(DataLayoutTest, Matches) {
+    ASSERT_TRUE(vrt::if_data_utc_sample_count::matches(0x14500009));
+    /* Packet count, size, TSM, and reserved bit do not affect layout */
+    ASSERT_TRUE(vrt::if_data_utc_sample_count::matches(0x175FFFFF));
+    ASSERT_FALSE(vrt::if_data_utc_sample_count::matches(0x1C500009));
+    ASSERT_FALSE(vrt::if_data_utc_sample_count::matches(0x14600009));
+    ASSERT_FALSE(vrt::if_data_utc_sample_count::matches(0x44500009));
+    ASSERT_TRUE(IfDataNoStreamIdTrailer::matches(0x04000001));
+}
@@ -2,6 +2,8 @@
 
 #include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <vector>
 
 /* This is not nice, but whatever... */
 #include <../src/vrt_fixed_point.h>
@@ -136,3 +138,99 @@ TEST(FixedPointTest, DoubleToI64) {
     ASSERT_EQ(Hex(vrt_double_to_fixed_point_i64(-std::exp2(-20), 20)), Hex(static_cast<int64_t>(0xFFFFFFFFFFFFFFFF)));
     ASSERT_EQ(Hex(vrt_double_to_fixed_point_i64(std::exp2(-20), 20)), Hex(static_cast<int64_t>(0x0000000000000001)));
 }
+
+/* Array sizes covering empty, vector tails, and several full vectors of any width */
+static const int32_t ARRAY_SIZES[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 33};
+
+/* Runs the array tests without and with AVX2, so both vector paths are covered on an AVX2 capable machine */
+class FixedPointArrayTest : public ::testing::TestWithParam<bool> {
+   protected:
+    void SetUp() override {
+        if (vrt_fixed_point_use_avx2(GetParam()) != GetParam()) {
+            GTEST_SKIP() << "AVX2 not supported";
+        }
+    }
+
+    void TearDown() override { vrt_fixed_point_use_avx2(true); }
+};
+
+TEST_P(FixedPointArrayTest, I16ToFloatArray) {
+    for (int32_t n : ARRAY_SIZES) {
+        std::vector<int16_t> fp(n);
+        for (int32_t i = 0; i < n; ++i) {
+            fp[i] = static_cast<int16_t>(i % 2 == 0 ? 0x8000 + 4099 * i : 0x7FFF - 3011 * i);
+        }
+        for (uint32_t r : {0U, 6U, 7U, 15U}) {
+            std::vector<float> f(n + 1, -1.0F);
+            vrt_fixed_point_i16_to_float_n(fp.data(), n, r, f.data());
+            for (int32_t i = 0; i < n; ++i) {
+                float expected = vrt_fixed_point_i16_to_float(fp[i], r);
+                ASSERT_EQ(std::memcmp(&f[i], &expected, sizeof(float)), 0) << "n = " << n << ", i = " << i;
+            }
+            ASSERT_EQ(f[n], -1.0F);
+        }
+    }
+}
+
+TEST_P(FixedPointArrayTest, I32ToDoubleArray) {
+    for (int32_t n : ARRAY_SIZES) {
+        std::vector<int32_t> fp(n);
+        for (int32_t i = 0; i < n; ++i) {
+            fp[i] = static_cast<int32_t>(i % 2 == 0 ? 0x80000000U + 268435459U * i : 0x7FFFFFFFU - 197136077U * i);
+        }
+        for (uint32_t r : {0U, 5U, 20U, 22U}) {
+            std::vector<double> d(n + 1, -1.0);
+            vrt_fixed_point_i32_to_double_n(fp.data(), n, r, d.data());
+            for (int32_t i = 0; i < n; ++i) {
+                double expected = vrt_fixed_point_i32_to_double(fp[i], r);
+                ASSERT_EQ(std::memcmp(&d[i], &expected, sizeof(double)), 0) << "n = " << n << ", i = " << i;
+            }
+            ASSERT_EQ(d[n], -1.0);
+        }
+    }
+}
+
+TEST_P(FixedPointArrayTest, FloatToI16Array) {
+    for (int32_t n : ARRAY_SIZES) {
+        /* Includes exact halves, values just around them, and negative zero, where rounding differences would show */
+        std::vector<float> f(n);
+        for (int32_t i = 0; i < n; ++i) {
+            const float values[] = {0.5F, -0.5F, 2.5F, -2.5F, 0.49999997F, -0.49999997F, -0.0F, 255.99F, -256.0F};
+            f[i] = values[i % 9] + static_cast<float>(i / 9) * 1.25F;
+        }
+        for (uint32_t r : {0U, 6U}) {
+            std::vector<int16_t> fp(n + 1, 0x5A5A);
+            vrt_float_to_fixed_point_i16_n(f.data(), n, r, fp.data());
+            for (int32_t i = 0; i < n; ++i) {
+                ASSERT_EQ(Hex(fp[i]), Hex(vrt_float_to_fixed_point_i16(f[i], r))) << "n = " << n << ", i = " << i;
+            }
+            ASSERT_EQ(fp[n], 0x5A5A);
+        }
+    }
+}
+
+TEST_P(FixedPointArrayTest, DoubleToI32Array) {
+    for (int32_t n : ARRAY_SIZES) {
+        std::vector<double> d(n);
+        for (int32_t i = 0; i < n; ++i) {
+            const double values[] = {0.5, -0.5, 2.5, -2.5, 0.49999999999999994, -0.49999999999999994,
+                                     -0.0, 511.9, -512.0};
+            d[i] = values[i % 9] + static_cast<double>(i / 9) * 1.25;
+        }
+        for (uint32_t r : {0U, 5U, 20U}) {
+            std::vector<int32_t> fp(n + 1, 0x5A5A5A5A);
+            vrt_double_to_fixed_point_i32_n(d.data(), n, r, fp.data());
+            for (int32_t i = 0; i < n; ++i) {
+                ASSERT_EQ(Hex(fp[i]), Hex(vrt_double_to_fixed_point_i32(d[i], r))) << "n = " << n << ", i = " << i;
+            }
+            ASSERT_EQ(fp[n], 0x5A5A5A5A);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(InstructionSets,
+                         FixedPointArrayTest,
+                         ::testing::Values(false, true),
+                         [](const ::testing::TestParamInfo<bool>& param_info) {
+                             return param_info.param ? "Avx2" : "Sse2";
+                         });
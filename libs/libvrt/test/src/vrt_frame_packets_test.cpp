@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_types.h>
+
+#include "byte_order.h"
+#include "hex.h"
+
+class FramePacketsTest : public ::testing::TestWithParam<ByteOrder> {
+   protected:
+    void SetUp() override {
+        buf_.fill(0xBAADF00D);
+        d_.fill(vrt_packet_desc{});
+    }
+
+    /* Frames buf_ in the byte order of the test parameter */
+    int32_t frame_packets(const void* buf, int32_t words_buf, vrt_packet_desc* descs, int32_t max_descs) {
+        return call_in_order(
+            GetParam(), &buf_, [&] { return vrt_frame_packets(buf, words_buf, descs, max_descs, true); },
+            [&] { return vrt_frame_packets_be(buf, words_buf, descs, max_descs, true); });
+    }
+
+    /* Data packet with stream ID and one body word, context packet without fields, and data packet with trailer */
+    void fill_three_packets() {
+        buf_[0]  = 0x10000003;
+        buf_[1]  = 0x00000001;
+        buf_[2]  = 0xCECECECE;
+        buf_[3]  = 0x40000003;
+        buf_[4]  = 0x00000002;
+        buf_[5]  = 0x00000000;
+        buf_[6]  = 0x14000005;
+        buf_[7]  = 0x00000001;
+        buf_[8]  = 0xCECECECE;
+        buf_[9]  = 0xFEFEFEFE;
+        buf_[10] = 0x00000000;
+    }
+
+    std::array<vrt_packet_desc, 4> d_{};
+    std::array<uint32_t, 16>       buf_{};
+};
+
+TEST_P(FramePacketsTest, EmptyBuffer) {
+    ASSERT_EQ(frame_packets(buf_.data(), 0, d_.data(), d_.size()), 0);
+}
+
+TEST_P(FramePacketsTest, NoDescriptors) {
+    fill_three_packets();
+    ASSERT_EQ(frame_packets(buf_.data(), 11, d_.data(), 0), 0);
+}
+
+TEST_P(FramePacketsTest, ThreePackets) {
+    fill_three_packets();
+
+    ASSERT_EQ(frame_packets(buf_.data(), 11, d_.data(), d_.size()), 3);
+    ASSERT_EQ(d_[0].offset, 0);
+    ASSERT_EQ(d_[0].header.packet_type, VRT_PT_IF_DATA_WITH_STREAM_ID);
+    ASSERT_EQ(Hex(d_[0].stream_id), Hex(0x00000001));
+    ASSERT_EQ(d_[0].offset_body, 2);
+    ASSERT_EQ(d_[0].words_body, 1);
+    ASSERT_EQ(d_[1].offset, 3);
+    ASSERT_EQ(d_[1].header.packet_type, VRT_PT_IF_CONTEXT);
+    ASSERT_EQ(Hex(d_[1].stream_id), Hex(0x00000002));
+    ASSERT_EQ(d_[1].offset_body, 2);
+    ASSERT_EQ(d_[1].words_body, 1);
+    ASSERT_EQ(d_[2].offset, 6);
+    ASSERT_EQ(d_[2].header.packet_size, 5);
+    ASSERT_EQ(d_[2].offset_body, 2);
+    ASSERT_EQ(d_[2].words_body, 2);
+}
+
+TEST_P(FramePacketsTest, MaxDescriptors) {
+    fill_three_packets();
+
+    ASSERT_EQ(frame_packets(buf_.data(), 11, d_.data(), 2), 2);
+    ASSERT_EQ(d_[1].offset, 3);
+    ASSERT_EQ(d_[2].header.packet_size, 0);
+}
+
+TEST_P(FramePacketsTest, IncompleteLastPacket) {
+    fill_three_packets();
+
+    ASSERT_EQ(frame_packets(buf_.data(), 10, d_.data(), d_.size()), 2);
+    ASSERT_EQ(d_[1].offset, 3);
+}
+
+TEST_P(FramePacketsTest, IncompleteFirstPacket) {
+    fill_three_packets();
+
+    ASSERT_EQ(frame_packets(buf_.data(), 2, d_.data(), d_.size()), 0);
+}
+
+TEST_P(FramePacketsTest, InvalidFirstPacket) {
+    fill_three_packets();
+    buf_[0] = 0xF0000003;
+
+    ASSERT_EQ(frame_packets(buf_.data(), 11, d_.data(), d_.size()), VRT_ERR_INVALID_PACKET_TYPE);
+}
+
+TEST_P(FramePacketsTest, InvalidLaterPacket) {
+    fill_three_packets();
+    buf_[3] = 0x44000003;
+
+    ASSERT_EQ(frame_packets(buf_.data(), 11, d_.data(), d_.size()), 1);
+    ASSERT_EQ(frame_packets(buf_.data() + 3, 8, d_.data(), d_.size()), VRT_ERR_TRAILER_IN_CONTEXT);
+}
+
+INSTANTIATE_TEST_SUITE_P(ByteOrders,
+                         FramePacketsTest,
+                         ::testing::Values(ByteOrder::HOST, ByteOrder::NETWORK),
+                         byte_order_name);
@@ -249,3 +249,24 @@ TEST(InitTest, Packet) {
 
     test_packet(p);
 }
+
+TEST(InitTest, ContextCache) {
+    vrt_context_cache c{};
+    init_garbage_if_context(&c.if_context);
+    c.hash      = 0xFEDCBA9876543210;
+    c.words     = 3;
+    c.be        = true;
+    c.validated = true;
+    c.changed   = true;
+    c.hits      = 5;
+    c.misses    = 7;
+    vrt_init_context_cache(&c);
+
+    test_if_context(c.if_context);
+    ASSERT_EQ(c.words, 0);
+    ASSERT_FALSE(c.be);
+    ASSERT_FALSE(c.validated);
+    ASSERT_FALSE(c.changed);
+    ASSERT_EQ(c.hits, 0);
+    ASSERT_EQ(c.misses, 0);
+}
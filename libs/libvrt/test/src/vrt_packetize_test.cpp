@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_write.h>
+
+#include "byte_order.h"
+#include "hex.h"
+
+class PacketizeTest : public ::testing::TestWithParam<ByteOrder> {
+   protected:
+    void SetUp() override {
+        vrt_init_packet(&p_);
+        p_.header.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
+        p_.fields.stream_id   = 0xABABABAB;
+        vrt_init_packet(&c_);
+        c_.header.packet_type = VRT_PT_IF_CONTEXT;
+        c_.fields.stream_id   = 0xABABABAB;
+        for (uint32_t i = 0; i < samples_.size(); ++i) {
+            samples_[i] = 0xCE000000 + i;
+        }
+        buf_.fill(0xBAADF00D);
+    }
+
+    /* Packetizes in the byte order of the test parameter, buf_ is in host order again afterwards. Samples are held
+     * in host order, so they are swapped when written in network order. */
+    int32_t packetize(const void* samples, int32_t words_samples, int32_t words_buf, int32_t* words_consumed) {
+        return call_in_order(
+            GetParam(), &buf_,
+            [&] { return vrt_packetize(&z_, samples, words_samples, buf_.data(), words_buf, true, words_consumed); },
+            [&] {
+                return vrt_packetize_be(&z_, samples, words_samples, buf_.data(), words_buf, true, true,
+                                        words_consumed);
+            });
+    }
+
+    /* Reads the packet at offset in buf_ and returns its size */
+    int32_t read_packet(int32_t offset, vrt_packet* packet) {
+        return vrt_read_packet(buf_.data() + offset, buf_.size() - offset, packet, true);
+    }
+
+    vrt_packetizer            z_{};
+    vrt_packet                p_{};
+    vrt_packet                c_{};
+    vrt_packet                r_{};
+    std::array<uint32_t, 16>  samples_{};
+    std::array<uint32_t, 128> buf_{};
+};
+
+TEST_P(PacketizeTest, InvalidWordsPerPacket) {
+    int32_t consumed = -1;
+    vrt_packetizer_init(&z_, &p_, 0, 1, 0);
+    ASSERT_EQ(packetize(samples_.data(), 4, buf_.size(), &consumed), VRT_ERR_BOUNDS_PACKET_SIZE);
+    ASSERT_EQ(consumed, 0);
+    vrt_packetizer_init(&z_, &p_, 3, 2, 0);
+    ASSERT_EQ(packetize(samples_.data(), 4, buf_.size(), &consumed), VRT_ERR_BOUNDS_PACKET_SIZE);
+    vrt_packetizer_init(&z_, &p_, 4, 0, 0);
+    ASSERT_EQ(packetize(samples_.data(), 4, buf_.size(), &consumed), VRT_ERR_BOUNDS_PACKET_SIZE);
+    ASSERT_EQ(Hex(buf_[0]), Hex(0xBAADF00D));
+}
+
+TEST_P(PacketizeTest, WordsPerPacketOverhead) {
+    int32_t consumed = -1;
+    p_.header.has.trailer = true;
+    /* Header, stream ID, and trailer leave room for UINT16_MAX - 3 body words */
+    vrt_packetizer_init(&z_, &p_, UINT16_MAX - 2, 1, 0);
+    ASSERT_EQ(packetize(samples_.data(), 4, buf_.size(), &consumed), VRT_ERR_BOUNDS_PACKET_SIZE);
+    ASSERT_EQ(consumed, 0);
+    vrt_packetizer_init(&z_, &p_, UINT16_MAX - 3, 1, 0);
+    ASSERT_EQ(packetize(samples_.data(), 4, buf_.size(), &consumed), 7);
+    ASSERT_EQ(consumed, 4);
+}
+
+TEST_P(PacketizeTest, MissingSampleRate) {
+    int32_t consumed = -1;
+    p_.header.tsf    = VRT_TSF_SAMPLE_COUNT;
+    vrt_packetizer_init(&z_, &p_, 4, 1, 0);
+    ASSERT_EQ(packetize(samples_.data(), 4, buf_.size(), &consumed), VRT_ERR_MISSING_SAMPLE_RATE);
+    p_.header.tsf = VRT_TSF_REAL_TIME;
+    vrt_packetizer_init(&z_, &p_, 4, 1, 0);
+    ASSERT_EQ(packetize(samples_.data(), 4, buf_.size(), &consumed), VRT_ERR_MISSING_SAMPLE_RATE);
+    ASSERT_EQ(consumed, 0);
+}
+
+TEST_P(PacketizeTest, NoSamples) {
+    int32_t consumed = -1;
+    vrt_packetizer_init(&z_, &p_, 4, 1, 0);
+    ASSERT_EQ(packetize(samples_.data(), 0, buf_.size(), &consumed), 0);
+    ASSERT_EQ(consumed, 0);
+    ASSERT_EQ(Hex(buf_[0]), Hex(0xBAADF00D));
+}
+
+TEST_P(PacketizeTest, Split) {
+    int32_t consumed = -1;
+    vrt_packetizer_init(&z_, &p_, 4, 1, 0);
+    ASSERT_EQ(packetize(samples_.data(), 10, buf_.size(), &consumed), 16);
+    ASSERT_EQ(consumed, 10);
+    ASSERT_EQ(Hex(buf_[0]), Hex(0x10000006));
+    ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
+    ASSERT_EQ(Hex(buf_[2]), Hex(0xCE000000));
+    ASSERT_EQ(Hex(buf_[5]), Hex(0xCE000003));
+    ASSERT_EQ(Hex(buf_[6]), Hex(0x10010006));
+    ASSERT_EQ(Hex(buf_[8]), Hex(0xCE000004));
+    ASSERT_EQ(Hex(buf_[12]), Hex(0x10020004));
+    ASSERT_EQ(Hex(buf_[13]), Hex(0xABABABAB));
+    ASSERT_EQ(Hex(buf_[14]), Hex(0xCE000008));
+    ASSERT_EQ(Hex(buf_[15]), Hex(0xCE000009));
+    ASSERT_EQ(Hex(buf_[16]), Hex(0xBAADF00D));
+}
+
+TEST_P(PacketizeTest, PartialSample) {
+    int32_t consumed = -1;
+    vrt_packetizer_init(&z_, &p_, 4, 2, 0);
+    ASSERT_EQ(packetize(samples_.data(), 7, buf_.size(), &consumed), 10);
+    ASSERT_EQ(consumed, 6);
+    ASSERT_EQ(Hex(buf_[6]), Hex(0x10010004));
+    ASSERT_EQ(Hex(buf_[9]), Hex(0xCE000005));
+    ASSERT_EQ(Hex(buf_[10]), Hex(0xBAADF00D));
+}
+
+TEST_P(PacketizeTest, PacketCountRollOver) {
+    int32_t consumed = -1;
+    p_.header.packet_count = 14;
+    vrt_packetizer_init(&z_, &p_, 1, 1, 0);
+    ASSERT_EQ(packetize(samples_.data(), 4, buf_.size(), &consumed), 12);
+    for (int32_t i = 0; i < 4; ++i) {
+        ASSERT_EQ(read_packet(3 * i, &r_), 3);
+        ASSERT_EQ(r_.header.packet_count, (14 + i) % 16);
+    }
+    ASSERT_EQ(z_.packet.header.packet_count, 2);
+}
+
+TEST_P(PacketizeTest, SampleCount) {
+    int32_t consumed = -1;
+    p_.header.tsi                          = VRT_TSI_UTC;
+    p_.header.tsf                          = VRT_TSF_SAMPLE_COUNT;
+    p_.fields.integer_seconds_timestamp    = 100;
+    p_.fields.fractional_seconds_timestamp = 3;
+    vrt_packetizer_init(&z_, &p_, 2, 1, 5);
+    ASSERT_EQ(packetize(samples_.data(), 8, buf_.size(), &consumed), 28);
+    const std::array<uint32_t, 4> integer{100, 101, 101, 101};
+    const std::array<uint64_t, 4> fractional{3, 0, 2, 4};
+    for (int32_t i = 0; i < 4; ++i) {
+        ASSERT_EQ(read_packet(7 * i, &r_), 7);
+        ASSERT_EQ(r_.fields.integer_seconds_timestamp, integer[i]);
+        ASSERT_EQ(r_.fields.fractional_seconds_timestamp, fractional[i]);
+        ASSERT_EQ(Hex(static_cast<const uint32_t*>(r_.body)[0]), Hex(0xCE000000 + 2 * i));
+    }
+}
+
+TEST_P(PacketizeTest, RealTime) {
+    int32_t consumed = -1;
+    p_.header.tsi                          = VRT_TSI_GPS;
+    p_.header.tsf                          = VRT_TSF_REAL_TIME;
+    p_.fields.integer_seconds_timestamp    = 7;
+    p_.fields.fractional_seconds_timestamp = 0;
+    vrt_packetizer_init(&z_, &p_, 1, 1, 3);
+    ASSERT_EQ(packetize(samples_.data(), 4, buf_.size(), &consumed), 24);
+    const std::array<uint32_t, 4> integer{7, 7, 7, 8};
+    const std::array<uint64_t, 4> fractional{0, 333333333333, 666666666666, 0};
+    for (int32_t i = 0; i < 4; ++i) {
+        ASSERT_EQ(read_packet(6 * i, &r_), 6);
+        ASSERT_EQ(r_.fields.integer_seconds_timestamp, integer[i]);
+        ASSERT_EQ(r_.fields.fractional_seconds_timestamp, fractional[i]);
+    }
+}
+
+TEST_P(PacketizeTest, FreeRunningCount) {
+    int32_t consumed = -1;
+    p_.header.tsf                          = VRT_TSF_FREE_RUNNING_COUNT;
+    p_.fields.fractional_seconds_timestamp = 10;
+    vrt_packetizer_init(&z_, &p_, 4, 2, 0);
+    ASSERT_EQ(packetize(samples_.data(), 8, buf_.size(), &consumed), 16);
+    ASSERT_EQ(read_packet(0, &r_), 8);
+    ASSERT_EQ(r_.fields.fractional_seconds_timestamp, 10);
+    ASSERT_EQ(read_packet(8, &r_), 8);
+    ASSERT_EQ(r_.fields.fractional_seconds_timestamp, 12);
+}
+
+TEST_P(PacketizeTest, IntegerOnly) {
+    int32_t consumed = -1;
+    p_.header.tsi                       = VRT_TSI_UTC;
+    p_.fields.integer_seconds_timestamp = 50;
+    vrt_packetizer_init(&z_, &p_, 3, 1, 4);
+    ASSERT_EQ(packetize(samples_.data(), 9, buf_.size(), &consumed), 18);
+    const std::array<uint32_t, 3> integer{50, 50, 51};
+    for (int32_t i = 0; i < 3; ++i) {
+        ASSERT_EQ(read_packet(6 * i, &r_), 6);
+        ASSERT_EQ(r_.fields.integer_seconds_timestamp, integer[i]);
+    }
+    ASSERT_EQ(z_.remainder, 1);
+}
+
+TEST_P(PacketizeTest, Trailer) {
+    int32_t consumed = -1;
+    p_.header.has.trailer     = true;
+    p_.trailer.has.valid_data = true;
+    p_.trailer.valid_data     = true;
+    vrt_packetizer_init(&z_, &p_, 2, 1, 0);
+    ASSERT_EQ(packetize(samples_.data(), 3, buf_.size(), &consumed), 9);
+    ASSERT_EQ(read_packet(0, &r_), 5);
+    ASSERT_EQ(r_.words_body, 2);
+    ASSERT_TRUE(r_.trailer.valid_data);
+    ASSERT_EQ(read_packet(5, &r_), 4);
+    ASSERT_EQ(r_.words_body, 1);
+    ASSERT_TRUE(r_.trailer.has.valid_data);
+}
+
+TEST_P(PacketizeTest, Context) {
+    int32_t consumed = -1;
+    p_.header.tsi               = VRT_TSI_UTC;
+    p_.header.tsf               = VRT_TSF_SAMPLE_COUNT;
+    c_.header.tsi               = VRT_TSI_UTC;
+    c_.header.tsf               = VRT_TSF_SAMPLE_COUNT;
+    c_.if_context.has.bandwidth = true;
+    c_.if_context.bandwidth     = 4.0;
+    vrt_packetizer_init(&z_, &p_, 1, 1, 100);
+    z_.context          = &c_;
+    z_.context_interval = 2;
+    ASSERT_EQ(packetize(samples_.data(), 3, buf_.size(), &consumed), 34);
+    ASSERT_EQ(consumed, 3);
+
+    /* Context, data, data, context, data */
+    const std::array<int32_t, 5>  offsets{0, 8, 14, 20, 28};
+    const std::array<bool, 5>     contexts{true, false, false, true, false};
+    const std::array<uint8_t, 5>  counts{0, 0, 1, 1, 2};
+    const std::array<uint64_t, 5> fractional{0, 0, 1, 2, 2};
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        ASSERT_EQ(read_packet(offsets[i], &r_), contexts[i] ? 8 : 6);
+        ASSERT_EQ(r_.header.packet_type, contexts[i] ? VRT_PT_IF_CONTEXT : VRT_PT_IF_DATA_WITH_STREAM_ID);
+        ASSERT_EQ(r_.header.packet_count, counts[i]);
+        ASSERT_EQ(r_.fields.fractional_seconds_timestamp, fractional[i]);
+        if (contexts[i]) {
+            ASSERT_TRUE(r_.if_context.has.bandwidth);
+            ASSERT_EQ(r_.if_context.bandwidth, 4.0);
+        }
+    }
+}
+
+TEST_P(PacketizeTest, ContextOnlyFirst) {
+    int32_t consumed = -1;
+    vrt_packetizer_init(&z_, &p_, 1, 1, 0);
+    z_.context = &c_;
+    ASSERT_EQ(packetize(samples_.data(), 3, buf_.size(), &consumed), 12);
+    ASSERT_EQ(read_packet(0, &r_), 3);
+    ASSERT_EQ(r_.header.packet_type, VRT_PT_IF_CONTEXT);
+    ASSERT_EQ(read_packet(3, &r_), 3);
+    ASSERT_EQ(r_.header.packet_type, VRT_PT_IF_DATA_WITH_STREAM_ID);
+    ASSERT_EQ(read_packet(9, &r_), 3);
+    ASSERT_EQ(r_.header.packet_type, VRT_PT_IF_DATA_WITH_STREAM_ID);
+}
+
+TEST_P(PacketizeTest, SmallBuffer) {
+    int32_t consumed = -1;
+    vrt_packetizer_init(&z_, &p_, 4, 1, 0);
+    ASSERT_EQ(packetize(samples_.data(), 10, 13, &consumed), 12);
+    ASSERT_EQ(consumed, 8);
+    ASSERT_EQ(packetize(samples_.data() + consumed, 10 - consumed, buf_.size(), &consumed), 4);
+    ASSERT_EQ(consumed, 2);
+    ASSERT_EQ(Hex(buf_[0]), Hex(0x10020004));
+    ASSERT_EQ(Hex(buf_[2]), Hex(0xCE000008));
+}
+
+TEST_P(PacketizeTest, SmallBufferContext) {
+    int32_t consumed = -1;
+    vrt_packetizer_init(&z_, &p_, 1, 1, 0);
+    z_.context = &c_;
+
+    /* Context fits but the data packet after it does not */
+    ASSERT_EQ(packetize(samples_.data(), 1, 4, &consumed), 0);
+    ASSERT_EQ(consumed, 0);
+    ASSERT_EQ(packetize(samples_.data(), 1, 6, &consumed), 6);
+    ASSERT_EQ(consumed, 1);
+    ASSERT_EQ(read_packet(0, &r_), 3);
+    ASSERT_EQ(r_.header.packet_type, VRT_PT_IF_CONTEXT);
+    ASSERT_EQ(r_.header.packet_count, 0);
+    ASSERT_EQ(z_.context_count, 1);
+}
+
+TEST_P(PacketizeTest, InvalidDataContext) {
+    int32_t consumed = -1;
+    vrt_packetizer_init(&z_, &p_, 1, 1, 0);
+    z_.context          = &c_;
+    z_.context_interval = 1;
+    ASSERT_EQ(packetize(samples_.data(), 1, buf_.size(), &consumed), 6);
+
+    /* Context is due and valid, but the data packet after it is not */
+    z_.packet.header.has.class_id = true;
+    z_.packet.fields.class_id.oui = 0x01000000;
+    ASSERT_EQ(packetize(samples_.data(), 1, buf_.size(), &consumed), VRT_ERR_BOUNDS_OUI);
+    ASSERT_EQ(consumed, 0);
+    ASSERT_EQ(z_.context_count, 1);
+    ASSERT_EQ(z_.since_context, 1);
+
+    z_.packet.fields.class_id.oui = 0x00FFFFFF;
+    ASSERT_EQ(packetize(samples_.data(), 1, buf_.size(), &consumed), 8);
+    ASSERT_EQ(read_packet(0, &r_), 3);
+    ASSERT_EQ(r_.header.packet_type, VRT_PT_IF_CONTEXT);
+    ASSERT_EQ(r_.header.packet_count, 1);
+    ASSERT_EQ(z_.context_count, 2);
+}
+
+INSTANTIATE_TEST_SUITE_P(ByteOrders,
+                         PacketizeTest,
+                         ::testing::Values(ByteOrder::HOST, ByteOrder::NETWORK),
+                         byte_order_name);
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_types.h>
+
+#include "byte_order.h"
+#include "hex.h"
+
+class PeekPacketTest : public ::testing::TestWithParam<ByteOrder> {
+   protected:
+    void SetUp() override { buf_.fill(0xBAADF00D); }
+
+    /* Peeks at buf_ in the byte order of the test parameter */
+    int32_t peek_packet(const void* buf, int32_t words_buf, vrt_packet_desc* desc, bool validate) {
+        return call_in_order(
+            GetParam(), &buf_, [&] { return vrt_peek_packet(buf, words_buf, desc, validate); },
+            [&] { return vrt_peek_packet_be(buf, words_buf, desc, validate); });
+    }
+
+    vrt_packet_desc          d_{};
+    std::array<uint32_t, 16> buf_{};
+};
+
+TEST_P(PeekPacketTest, NegativeSizeBuffer) {
+    ASSERT_EQ(peek_packet(buf_.data(), -1, &d_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(peek_packet(buf_.data(), -1, &d_, false), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_P(PeekPacketTest, ZeroSizeBuffer) {
+    ASSERT_EQ(peek_packet(buf_.data(), 0, &d_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(peek_packet(buf_.data(), 0, &d_, false), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_P(PeekPacketTest, EmptyIfDataWithoutStreamId) {
+    buf_[0] = 0x00000001;
+
+    ASSERT_EQ(peek_packet(buf_.data(), 1, &d_, true), 1);
+    ASSERT_EQ(d_.header.packet_type, VRT_PT_IF_DATA_WITHOUT_STREAM_ID);
+    ASSERT_EQ(d_.header.packet_size, 1);
+    ASSERT_EQ(Hex(d_.stream_id), Hex(0x00000000));
+    ASSERT_EQ(d_.offset, 0);
+    ASSERT_EQ(d_.offset_body, 1);
+    ASSERT_EQ(d_.words_body, 0);
+}
+
+TEST_P(PeekPacketTest, BodyIfDataWithoutStreamId) {
+    buf_[0] = 0x00000003;
+    buf_[1] = 0xCECECECE;
+    buf_[2] = 0xFEFEFEFE;
+
+    ASSERT_EQ(peek_packet(buf_.data(), buf_.size(), &d_, true), 3);
+    ASSERT_EQ(d_.header.packet_type, VRT_PT_IF_DATA_WITHOUT_STREAM_ID);
+    ASSERT_EQ(d_.header.packet_size, 3);
+    ASSERT_EQ(d_.offset_body, 1);
+    ASSERT_EQ(d_.words_body, 2);
+    ASSERT_EQ(Hex(buf_[d_.offset_body]), Hex(0xCECECECE));
+}
+
+TEST_P(PeekPacketTest, BodyIfDataWithStreamIdAndTrailer) {
+    buf_[0] = 0x14000004;
+    buf_[1] = 0xABABABAB;
+    buf_[2] = 0xCECECECE;
+    buf_[3] = 0x00000000;
+
+    ASSERT_EQ(peek_packet(buf_.data(), buf_.size(), &d_, true), 4);
+    ASSERT_EQ(d_.header.packet_type, VRT_PT_IF_DATA_WITH_STREAM_ID);
+    ASSERT_TRUE(d_.header.has.trailer);
+    ASSERT_EQ(Hex(d_.stream_id), Hex(0xABABABAB));
+    ASSERT_EQ(d_.offset_body, 2);
+    ASSERT_EQ(d_.words_body, 1);
+}
+
+TEST_P(PeekPacketTest, BodyWithClassIdAndTimestamps) {
+    buf_[0] = 0x18600008;
+    buf_[1] = 0xABABABAB;
+    buf_[2] = 0x00123456;
+    buf_[3] = 0xFEDCBA98;
+    buf_[4] = 0x12345678;
+    buf_[5] = 0x00000000;
+    buf_[6] = 0x00000001;
+    buf_[7] = 0xCECECECE;
+
+    ASSERT_EQ(peek_packet(buf_.data(), buf_.size(), &d_, true), 8);
+    ASSERT_EQ(d_.header.tsi, VRT_TSI_UTC);
+    ASSERT_EQ(d_.header.tsf, VRT_TSF_REAL_TIME);
+    ASSERT_EQ(Hex(d_.stream_id), Hex(0xABABABAB));
+    ASSERT_EQ(d_.offset_body, 7);
+    ASSERT_EQ(d_.words_body, 1);
+}
+
+TEST_P(PeekPacketTest, IfContext) {
+    buf_[0] = 0x41000003;
+    buf_[1] = 0xABABABAB;
+    buf_[2] = 0x00000000;
+
+    ASSERT_EQ(peek_packet(buf_.data(), buf_.size(), &d_, true), 3);
+    ASSERT_EQ(d_.header.packet_type, VRT_PT_IF_CONTEXT);
+    ASSERT_EQ(Hex(d_.stream_id), Hex(0xABABABAB));
+    ASSERT_EQ(d_.offset_body, 2);
+    ASSERT_EQ(d_.words_body, 1);
+}
+
+TEST_P(PeekPacketTest, IncompletePacket) {
+    buf_[0] = 0x10000004;
+    buf_[1] = 0xABABABAB;
+
+    ASSERT_EQ(peek_packet(buf_.data(), 3, &d_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(peek_packet(buf_.data(), 3, &d_, false), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(peek_packet(buf_.data(), 1, &d_, true), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_P(PeekPacketTest, PacketSizeTooSmall) {
+    buf_[0] = 0x14000002;
+    buf_[1] = 0xABABABAB;
+
+    ASSERT_EQ(peek_packet(buf_.data(), buf_.size(), &d_, true), VRT_ERR_MISMATCH_PACKET_SIZE);
+    ASSERT_EQ(peek_packet(buf_.data(), buf_.size(), &d_, false), VRT_ERR_MISMATCH_PACKET_SIZE);
+}
+
+TEST_P(PeekPacketTest, ValidationHeader) {
+    buf_[0] = 0xF0000002;
+
+    ASSERT_EQ(peek_packet(buf_.data(), buf_.size(), &d_, true), VRT_ERR_INVALID_PACKET_TYPE);
+    ASSERT_EQ(peek_packet(buf_.data(), buf_.size(), &d_, false), 2);
+}
+
+TEST_P(PeekPacketTest, ValidationFields) {
+    buf_[0] = 0x10200005;
+    buf_[1] = 0xABABABAB;
+    buf_[2] = 0xFFFFFFFF;
+    buf_[3] = 0xFFFFFFFF;
+    buf_[4] = 0xCECECECE;
+
+    ASSERT_EQ(peek_packet(buf_.data(), buf_.size(), &d_, true), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(peek_packet(buf_.data(), buf_.size(), &d_, false), 5);
+}
+
+INSTANTIATE_TEST_SUITE_P(ByteOrders,
+                         PeekPacketTest,
+                         ::testing::Values(ByteOrder::HOST, ByteOrder::NETWORK),
+                         byte_order_name);
@@ -10,10 +10,11 @@
 #include <vrt/vrt_read.h>
 #include <vrt/vrt_types.h>
 
+#include "byte_order.h"
 #include "init_garbage.h"
 #include "read_assertions.h"
 
-class ReadFieldsTest : public ::testing::Test {
+class ReadFieldsTest : public ::testing::TestWithParam<ByteOrder> {
    protected:
     void SetUp() override {
         vrt_init_header(&h_);
@@ -21,149 +22,160 @@ class ReadFieldsTest : public ::testing::Test {
         buf_.fill(0xBAADF00D);
     }
 
+    /* Reads buf_ in the byte order of the test parameter */
+    int32_t read_fields(const vrt_header* header,
+                        const void*       buf,
+                        int32_t           words_buf,
+                        vrt_fields*       fields,
+                        bool              validate) {
+        return call_in_order(
+            GetParam(), &buf_, [&] { return vrt_read_fields(header, buf, words_buf, fields, validate); },
+            [&] { return vrt_read_fields_be(header, buf, words_buf, fields, validate); });
+    }
+
     vrt_header              h_{};
     vrt_fields              f_{};
     std::array<uint32_t, 8> buf_{};
 };
 
-TEST_F(ReadFieldsTest, NegativeSizeBuffer) {
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), -1, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), -1, &f_, false), VRT_ERR_BUFFER_SIZE);
+TEST_P(ReadFieldsTest, NegativeSizeBuffer) {
+    ASSERT_EQ(read_fields(&h_, buf_.data(), -1, &f_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), -1, &f_, false), VRT_ERR_BUFFER_SIZE);
 }
 
-TEST_F(ReadFieldsTest, None) {
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, true), 0);
+TEST_P(ReadFieldsTest, None) {
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 0, &f_, true), 0);
 }
 
-TEST_F(ReadFieldsTest, IfDataWithStreamId) {
+TEST_P(ReadFieldsTest, IfDataWithStreamId) {
     h_.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
     buf_[0]        = 0xFEFEBEBE;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, true), 1);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 1, &f_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"stream_id", static_cast<uint32_t>(0xFEFEBEBE)}});
 }
 
-TEST_F(ReadFieldsTest, ExtDataWithoutStreamId) {
+TEST_P(ReadFieldsTest, ExtDataWithoutStreamId) {
     h_.packet_type = VRT_PT_EXT_DATA_WITHOUT_STREAM_ID;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, true), 0);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 0, &f_, true), 0);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {});
 }
 
-TEST_F(ReadFieldsTest, ExtDataWithStreamId) {
+TEST_P(ReadFieldsTest, ExtDataWithStreamId) {
     h_.packet_type = VRT_PT_EXT_DATA_WITH_STREAM_ID;
     buf_[0]        = 0xFEFEBEBE;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, true), 1);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 0, &f_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 1, &f_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"stream_id", static_cast<uint32_t>(0xFEFEBEBE)}});
 }
 
-TEST_F(ReadFieldsTest, IfContext) {
+TEST_P(ReadFieldsTest, IfContext) {
     h_.packet_type = VRT_PT_IF_CONTEXT;
     buf_[0]        = 0xFEFEBEBE;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, true), 1);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 0, &f_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 1, &f_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"stream_id", static_cast<uint32_t>(0xFEFEBEBE)}});
 }
 
-TEST_F(ReadFieldsTest, ExtContext) {
+TEST_P(ReadFieldsTest, ExtContext) {
     h_.packet_type = VRT_PT_EXT_CONTEXT;
     buf_[0]        = 0xFEFEBEBE;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, true), 1);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 0, &f_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 1, &f_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"stream_id", static_cast<uint32_t>(0xFEFEBEBE)}});
 }
 
-TEST_F(ReadFieldsTest, ClassIdOui) {
+TEST_P(ReadFieldsTest, ClassIdOui) {
     h_.has.class_id = true;
     buf_[0]         = 0x00FEDCBA;
     buf_[1]         = 0x00000000;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, true), 2);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 2, &f_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"class_id.oui", static_cast<uint32_t>(0x00FEDCBA)}});
 }
 
-TEST_F(ReadFieldsTest, ClassIdInformationClassCode) {
+TEST_P(ReadFieldsTest, ClassIdInformationClassCode) {
     h_.has.class_id = true;
     buf_[0]         = 0x00000000;
     buf_[1]         = 0xABAB0000;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, true), 2);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 2, &f_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"class_id.information_class_code", static_cast<uint16_t>(0xABAB)}});
 }
 
-TEST_F(ReadFieldsTest, ClassIdPacketClassCode) {
+TEST_P(ReadFieldsTest, ClassIdPacketClassCode) {
     h_.has.class_id = true;
     buf_[0]         = 0x00000000;
     buf_[1]         = 0x0000CBCB;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, true), 2);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 2, &f_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"class_id.packet_class_code", static_cast<uint16_t>(0xCBCB)}});
 }
 
-TEST_F(ReadFieldsTest, ClassIdReserved) {
+TEST_P(ReadFieldsTest, ClassIdReserved) {
     h_.has.class_id = true;
     buf_[0]         = 0xFF000000;
     buf_[1]         = 0x00000000;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, false), 2);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 2, &f_, true), VRT_ERR_RESERVED);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 2, &f_, false), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {});
 }
 
-TEST_F(ReadFieldsTest, IntegerSecondsTimestamp) {
+TEST_P(ReadFieldsTest, IntegerSecondsTimestamp) {
     h_.tsi  = VRT_TSI_OTHER;
     buf_[0] = 0x12345678;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, true), 1);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 0, &f_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 1, &f_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"integer_seconds_timestamp", static_cast<uint32_t>(0x12345678)}});
 }
 
-TEST_F(ReadFieldsTest, FractionalSecondsTimestamp) {
+TEST_P(ReadFieldsTest, FractionalSecondsTimestamp) {
     h_.tsf  = VRT_TSF_REAL_TIME;
     buf_[0] = 0x000000E8;
     buf_[1] = 0xD4A50FFF;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, true), 2);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 1, &f_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 2, &f_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"fractional_seconds_timestamp", static_cast<uint64_t>(0x000000E8D4A50FFF)}});
 }
 
-TEST_F(ReadFieldsTest, FractionalSecondsTimestampInvalid) {
+TEST_P(ReadFieldsTest, FractionalSecondsTimestampInvalid) {
     h_.tsf  = VRT_TSF_REAL_TIME;
     buf_[0] = 0x000000E8;
     buf_[1] = 0xD4A51000;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, false), 2);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 2, &f_, true), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 2, &f_, false), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"fractional_seconds_timestamp", static_cast<uint64_t>(0x000000E8D4A51000)}});
 }
 
-TEST_F(ReadFieldsTest, EveryOther1) {
+TEST_P(ReadFieldsTest, EveryOther1) {
     h_.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
     h_.tsi         = VRT_TSI_UTC;
     buf_[0]        = 0xABABCBCB;
     buf_[1]        = 0xCECEBEBE;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, true), 2);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 1, &f_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 2, &f_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"stream_id", static_cast<uint32_t>(0xABABCBCB)},
                        {"integer_seconds_timestamp", static_cast<uint32_t>(0xCECEBEBE)}});
 }
 
-TEST_F(ReadFieldsTest, EveryOther2) {
+TEST_P(ReadFieldsTest, EveryOther2) {
     h_.has.class_id = true;
     h_.tsf          = VRT_TSF_FREE_RUNNING_COUNT;
     buf_[0]         = 0x00FEDCBA;
     buf_[1]         = 0xABABCBCB;
     buf_[2]         = 0xCECEBEBE;
     buf_[3]         = 0xBABBA011;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 3, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 4, &f_, true), 4);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 3, &f_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 4, &f_, true), 4);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"class_id.oui", static_cast<uint32_t>(0x00FEDCBA)},
                        {"class_id.information_class_code", static_cast<uint16_t>(0xABAB)},
@@ -171,7 +183,7 @@ TEST_F(ReadFieldsTest, EveryOther2) {
                        {"fractional_seconds_timestamp", static_cast<uint64_t>(0xCECEBEBEBABBA011)}});
 }
 
-TEST_F(ReadFieldsTest, All) {
+TEST_P(ReadFieldsTest, All) {
     h_.packet_type  = VRT_PT_IF_DATA_WITH_STREAM_ID;
     h_.has.class_id = true;
     h_.tsi          = VRT_TSI_GPS;
@@ -182,8 +194,8 @@ TEST_F(ReadFieldsTest, All) {
     buf_[3]         = 0xCECEBEBE;
     buf_[4]         = 0xADDABEBB;
     buf_[5]         = 0xEFEFEF01;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 5, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 6, &f_, true), 6);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 5, &f_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_fields(&h_, buf_.data(), 6, &f_, true), 6);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"stream_id", static_cast<uint32_t>(0xCECEBEBE)},
                        {"class_id.oui", static_cast<uint32_t>(0x00FEDCBA)},
@@ -192,3 +204,8 @@ TEST_F(ReadFieldsTest, All) {
                        {"integer_seconds_timestamp", static_cast<uint32_t>(0xCECEBEBE)},
                        {"fractional_seconds_timestamp", static_cast<uint64_t>(0xADDABEBBEFEFEF01)}});
 }
+
+INSTANTIATE_TEST_SUITE_P(ByteOrders,
+                         ReadFieldsTest,
+                         ::testing::Values(ByteOrder::HOST, ByteOrder::NETWORK),
+                         byte_order_name);
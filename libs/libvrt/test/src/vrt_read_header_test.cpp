@@ -9,129 +9,137 @@
 #include <vrt/vrt_read.h>
 #include <vrt/vrt_types.h>
 
+#include "byte_order.h"
 #include "init_garbage.h"
 #include "read_assertions.h"
 
-class ReadHeaderTest : public ::testing::Test {
+class ReadHeaderTest : public ::testing::TestWithParam<ByteOrder> {
    protected:
     void SetUp() override {
         init_garbage_header(&h_);
         buf_.fill(0xBAADF00D);
     }
 
+    /* Reads buf_ in the byte order of the test parameter */
+    int32_t read_header(const void* buf, int32_t words_buf, vrt_header* header, bool validate) {
+        return call_in_order(
+            GetParam(), &buf_, [&] { return vrt_read_header(buf, words_buf, header, validate); },
+            [&] { return vrt_read_header_be(buf, words_buf, header, validate); });
+    }
+
     vrt_header              h_{};
     std::array<uint32_t, 2> buf_{};
 };
 
-TEST_F(ReadHeaderTest, NegativeSizeBuffer) {
-    ASSERT_EQ(vrt_read_header(buf_.data(), -1, &h_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_header(buf_.data(), -1, &h_, false), VRT_ERR_BUFFER_SIZE);
+TEST_P(ReadHeaderTest, NegativeSizeBuffer) {
+    ASSERT_EQ(read_header(buf_.data(), -1, &h_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_header(buf_.data(), -1, &h_, false), VRT_ERR_BUFFER_SIZE);
 }
 
-TEST_F(ReadHeaderTest, ZeroSizeBuffer) {
-    ASSERT_EQ(vrt_read_header(buf_.data(), 0, &h_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_header(buf_.data(), 0, &h_, false), VRT_ERR_BUFFER_SIZE);
+TEST_P(ReadHeaderTest, ZeroSizeBuffer) {
+    ASSERT_EQ(read_header(buf_.data(), 0, &h_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_header(buf_.data(), 0, &h_, false), VRT_ERR_BUFFER_SIZE);
 }
 
-TEST_F(ReadHeaderTest, PacketType) {
+TEST_P(ReadHeaderTest, PacketType) {
     buf_[0] = 0x00000000;
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, true), 1);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(h_, {});
 }
 
-TEST_F(ReadHeaderTest, PacketTypeInvalid) {
+TEST_P(ReadHeaderTest, PacketTypeInvalid) {
     buf_[0] = 0x60000000;
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, true), VRT_ERR_INVALID_PACKET_TYPE);
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, false), 1);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, true), VRT_ERR_INVALID_PACKET_TYPE);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, false), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(h_, {{"packet_type", static_cast<vrt_packet_type>(0x6)}});
 }
 
-TEST_F(ReadHeaderTest, HasClassId) {
+TEST_P(ReadHeaderTest, HasClassId) {
     buf_[0] = 0x08000000;
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, true), 1);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(h_, {{"has.class_id", true}});
 }
 
-TEST_F(ReadHeaderTest, HasTrailer) {
+TEST_P(ReadHeaderTest, HasTrailer) {
     buf_[0] = 0x04000000;
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, true), 1);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(h_, {{"has.trailer", true}});
 }
 
-TEST_F(ReadHeaderTest, HasTrailerInvalid) {
+TEST_P(ReadHeaderTest, HasTrailerInvalid) {
     buf_[0] = 0x44000000;
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, true), VRT_ERR_TRAILER_IN_CONTEXT);
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, false), 1);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, true), VRT_ERR_TRAILER_IN_CONTEXT);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, false), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(h_, {{"packet_type", VRT_PT_IF_CONTEXT}, {"has.trailer", true}});
 }
 
-TEST_F(ReadHeaderTest, Tsm) {
+TEST_P(ReadHeaderTest, Tsm) {
     buf_[0] = 0x41000000;
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, true), 1);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(h_, {{"packet_type", VRT_PT_IF_CONTEXT}, {"tsm", VRT_TSM_COARSE}});
 }
 
-TEST_F(ReadHeaderTest, TsmInvalid) {
+TEST_P(ReadHeaderTest, TsmInvalid) {
     buf_[0] = 0x01000000;
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, true), VRT_ERR_TSM_IN_DATA);
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, false), 1);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, true), VRT_ERR_TSM_IN_DATA);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, false), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(h_, {{"tsm", VRT_TSM_COARSE}});
 }
 
-TEST_F(ReadHeaderTest, Tsi) {
+TEST_P(ReadHeaderTest, Tsi) {
     buf_[0] = 0x00C00000;
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, true), 1);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(h_, {{"tsi", VRT_TSI_OTHER}});
 }
 
-TEST_F(ReadHeaderTest, Tsf) {
+TEST_P(ReadHeaderTest, Tsf) {
     buf_[0] = 0x00300000;
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, true), 1);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(h_, {{"tsf", VRT_TSF_FREE_RUNNING_COUNT}});
 }
 
-TEST_F(ReadHeaderTest, PacketCount) {
+TEST_P(ReadHeaderTest, PacketCount) {
     buf_[0] = 0x000A0000;
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, true), 1);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(h_, {{"packet_count", static_cast<uint8_t>(0xA)}});
 }
 
-TEST_F(ReadHeaderTest, PacketSize) {
+TEST_P(ReadHeaderTest, PacketSize) {
     buf_[0] = 0x0000FEDC;
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, true), 1);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(h_, {{"packet_size", static_cast<uint16_t>(0xFEDC)}});
 }
 
-TEST_F(ReadHeaderTest, Reserved) {
+TEST_P(ReadHeaderTest, Reserved) {
     buf_[0] = 0x02000000;
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, false), 1);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, true), VRT_ERR_RESERVED);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, false), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(h_, {});
 }
 
-TEST_F(ReadHeaderTest, EveryOther1) {
+TEST_P(ReadHeaderTest, EveryOther1) {
     buf_[0] = 0x0810ABCD;
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, true), 1);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(
         h_, {{"has.class_id", true}, {"tsf", VRT_TSF_SAMPLE_COUNT}, {"packet_size", static_cast<uint16_t>(0xABCD)}});
 }
 
-TEST_F(ReadHeaderTest, EveryOther2) {
+TEST_P(ReadHeaderTest, EveryOther2) {
     buf_[0] = 0x14850000;
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, true), 1);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(h_, {{"packet_type", VRT_PT_IF_DATA_WITH_STREAM_ID},
                        {"has.trailer", true},
@@ -139,9 +147,9 @@ TEST_F(ReadHeaderTest, EveryOther2) {
                        {"packet_count", static_cast<uint8_t>(0x5)}});
 }
 
-TEST_F(ReadHeaderTest, All) {
+TEST_P(ReadHeaderTest, All) {
     buf_[0] = 0x597FBEDE;
-    ASSERT_EQ(vrt_read_header(buf_.data(), 1, &h_, true), 1);
+    ASSERT_EQ(read_header(buf_.data(), 1, &h_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(h_, {{"packet_type", VRT_PT_EXT_CONTEXT},
                        {"has.class_id", true},
@@ -151,3 +159,8 @@ TEST_F(ReadHeaderTest, All) {
                        {"packet_count", static_cast<uint8_t>(0xF)},
                        {"packet_size", static_cast<uint16_t>(0xBEDE)}});
 }
+
+INSTANTIATE_TEST_SUITE_P(ByteOrders,
+                         ReadHeaderTest,
+                         ::testing::Values(ByteOrder::HOST, ByteOrder::NETWORK),
+                         byte_order_name);
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <any>
+#include <array>
+#include <cstdint>
+
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_types.h>
+
+#include "byte_order.h"
+#include "read_assertions.h"
+
+class ReadIfContextCachedTest : public ::testing::TestWithParam<ByteOrder> {
+   protected:
+    void SetUp() override {
+        vrt_init_context_cache(&c_);
+        buf_.fill(0xBAADF00D);
+    }
+
+    /* Reads buf_ in the byte order of the test parameter */
+    int32_t read_if_context_cached(const void* buf, int32_t words_buf, vrt_context_cache* cache, bool validate) {
+        return call_in_order(
+            GetParam(), &buf_, [&] { return vrt_read_if_context_cached(buf, words_buf, cache, validate); },
+            [&] { return vrt_read_if_context_cached_be(buf, words_buf, cache, validate); });
+    }
+
+    vrt_context_cache        c_{};
+    std::array<uint32_t, 16> buf_{};
+};
+
+TEST_P(ReadIfContextCachedTest, NegativeSizeBuffer) {
+    ASSERT_EQ(read_if_context_cached(buf_.data(), -1, &c_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_if_context_cached(buf_.data(), -1, &c_, false), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_P(ReadIfContextCachedTest, ZeroSizeBuffer) {
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 0, &c_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 0, &c_, false), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_P(ReadIfContextCachedTest, Miss) {
+    buf_[0] = 0x20000000;
+    buf_[1] = 0x00000001;
+    buf_[2] = 0x00100000;
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), 3);
+    ASSERT_TRUE(c_.changed);
+    ASSERT_EQ(c_.hits, 0);
+    ASSERT_EQ(c_.misses, 1);
+    SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
+    assert_if_context(c_.if_context, {{"has.bandwidth", true}, {"bandwidth", 4097.0}});
+}
+
+TEST_P(ReadIfContextCachedTest, Hit) {
+    buf_[0] = 0x20000000;
+    buf_[1] = 0x00000001;
+    buf_[2] = 0x00100000;
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, false), 3);
+    ASSERT_FALSE(c_.changed);
+    ASSERT_EQ(c_.hits, 2);
+    ASSERT_EQ(c_.misses, 1);
+    SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
+    assert_if_context(c_.if_context, {{"has.bandwidth", true}, {"bandwidth", 4097.0}});
+}
+
+TEST_P(ReadIfContextCachedTest, ChangedField) {
+    buf_[0] = 0x20000000;
+    buf_[1] = 0x00000001;
+    buf_[2] = 0x00100000;
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), 3);
+    buf_[1] = 0x00000000;
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), 3);
+    ASSERT_TRUE(c_.changed);
+    ASSERT_EQ(c_.hits, 0);
+    ASSERT_EQ(c_.misses, 2);
+    SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
+    assert_if_context(c_.if_context, {{"has.bandwidth", true}, {"bandwidth", 1.0}});
+}
+
+TEST_P(ReadIfContextCachedTest, ChangedIndicators) {
+    buf_[0] = 0x20000000;
+    buf_[1] = 0x00000001;
+    buf_[2] = 0x00100000;
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), 3);
+    buf_[0] = 0x10000000;
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), 3);
+    ASSERT_TRUE(c_.changed);
+    ASSERT_EQ(c_.misses, 2);
+    SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
+    assert_if_context(c_.if_context, {{"has.if_reference_frequency", true}, {"if_reference_frequency", 4097.0}});
+}
+
+TEST_P(ReadIfContextCachedTest, HashCollision) {
+    buf_[0] = 0x20000000;
+    buf_[1] = 0x00000001;
+    buf_[2] = 0x00100000;
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), 3);
+    uint64_t hash = c_.hash;
+    buf_[1] = 0x00000000;
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), 3);
+    /* Pretend the second section hashes like the first, reading the first again must still decode it */
+    c_.hash = hash;
+    buf_[1] = 0x00000001;
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), 3);
+    ASSERT_TRUE(c_.changed);
+    ASSERT_EQ(c_.hits, 0);
+    ASSERT_EQ(c_.misses, 3);
+    SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
+    assert_if_context(c_.if_context, {{"has.bandwidth", true}, {"bandwidth", 4097.0}});
+}
+
+TEST_P(ReadIfContextCachedTest, ValidateAfterNoValidate) {
+    buf_[0] = 0x20000000;
+    buf_[1] = 0x00000001;
+    buf_[2] = 0x00100000;
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), 3);
+    ASSERT_TRUE(c_.changed);
+    ASSERT_EQ(c_.misses, 2);
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), 3);
+    ASSERT_FALSE(c_.changed);
+    ASSERT_EQ(c_.hits, 1);
+}
+
+TEST_P(ReadIfContextCachedTest, InvalidIsNotCached) {
+    buf_[0] = 0x20000000;
+    buf_[1] = 0xFFFFFFFF;
+    buf_[2] = 0xFFF00000;
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), VRT_ERR_BOUNDS_BANDWIDTH);
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), VRT_ERR_BOUNDS_BANDWIDTH);
+    ASSERT_EQ(c_.hits, 0);
+    ASSERT_EQ(c_.misses, 2);
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), VRT_ERR_BOUNDS_BANDWIDTH);
+}
+
+TEST_P(ReadIfContextCachedTest, BufferTooSmall) {
+    buf_[0] = 0x20000000;
+    buf_[1] = 0x00000001;
+    buf_[2] = 0x00100000;
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 2, &c_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 3, &c_, true), 3);
+    ASSERT_TRUE(c_.changed);
+    ASSERT_EQ(c_.hits, 0);
+}
+
+TEST_P(ReadIfContextCachedTest, GpsAsciiIsNotCached) {
+    buf_[0] = 0x00000200;
+    buf_[1] = 0x00000000;
+    buf_[2] = 0x00000001;
+    buf_[3] = 0x61626300;
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 4, &c_, true), 4);
+    ASSERT_EQ(read_if_context_cached(buf_.data(), 4, &c_, true), 4);
+    ASSERT_TRUE(c_.changed);
+    ASSERT_EQ(c_.hits, 0);
+    ASSERT_EQ(c_.misses, 2);
+    ASSERT_EQ(c_.if_context.gps_ascii.ascii, reinterpret_cast<const char*>(buf_.data() + 3));
+}
+
+INSTANTIATE_TEST_SUITE_P(ByteOrders,
+                         ReadIfContextCachedTest,
+                         ::testing::Values(ByteOrder::HOST, ByteOrder::NETWORK),
+                         byte_order_name);
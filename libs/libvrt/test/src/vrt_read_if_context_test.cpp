@@ -10,650 +10,658 @@
 #include <vrt/vrt_read.h>
 #include <vrt/vrt_types.h>
 
+#include "byte_order.h"
 #include "init_garbage.h"
 #include "read_assertions.h"
 
-class ReadIfContextTest : public ::testing::Test {
+class ReadIfContextTest : public ::testing::TestWithParam<ByteOrder> {
    protected:
     void SetUp() override {
         init_garbage_if_context(&c_);
         buf_.fill(0xBAADF00D);
     }
 
+    /* Reads buf_ in the byte order of the test parameter */
+    int32_t read_if_context(const void* buf, int32_t words_buf, vrt_if_context* if_context, bool validate) {
+        return call_in_order(
+            GetParam(), &buf_, [&] { return vrt_read_if_context(buf, words_buf, if_context, validate); },
+            [&] { return vrt_read_if_context_be(buf, words_buf, if_context, validate); });
+    }
+
     vrt_if_context            c_{};
     std::array<uint32_t, 128> buf_{};
 };
 
-TEST_F(ReadIfContextTest, NegativeSizeBuffer) {
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), -1, &c_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), -1, &c_, false), VRT_ERR_BUFFER_SIZE);
+TEST_P(ReadIfContextTest, NegativeSizeBuffer) {
+    ASSERT_EQ(read_if_context(buf_.data(), -1, &c_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_if_context(buf_.data(), -1, &c_, false), VRT_ERR_BUFFER_SIZE);
 }
 
-TEST_F(ReadIfContextTest, ZeroSizeBuffer) {
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 0, &c_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 0, &c_, false), VRT_ERR_BUFFER_SIZE);
+TEST_P(ReadIfContextTest, ZeroSizeBuffer) {
+    ASSERT_EQ(read_if_context(buf_.data(), 0, &c_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_if_context(buf_.data(), 0, &c_, false), VRT_ERR_BUFFER_SIZE);
 }
 
-TEST_F(ReadIfContextTest, None) {
+TEST_P(ReadIfContextTest, None) {
     buf_[0] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 1, &c_, true), 1);
+    ASSERT_EQ(read_if_context(buf_.data(), 1, &c_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {});
 }
 
-TEST_F(ReadIfContextTest, ContextFieldChangeIndicator) {
+TEST_P(ReadIfContextTest, ContextFieldChangeIndicator) {
     buf_[0] = 0x80000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 1, &c_, true), 1);
+    ASSERT_EQ(read_if_context(buf_.data(), 1, &c_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"context_field_change_indicator", true}});
 }
 
-TEST_F(ReadIfContextTest, ContextIndicatorsReserved) {
+TEST_P(ReadIfContextTest, ContextIndicatorsReserved) {
     buf_[0] = 0x000000FF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 1, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 1, &c_, false), 1);
+    ASSERT_EQ(read_if_context(buf_.data(), 1, &c_, true), VRT_ERR_RESERVED);
+    ASSERT_EQ(read_if_context(buf_.data(), 1, &c_, false), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {});
 }
 
-TEST_F(ReadIfContextTest, ReferencePointIdentifier) {
+TEST_P(ReadIfContextTest, ReferencePointIdentifier) {
     buf_[0] = 0x40000000;
     buf_[1] = 0xFEDCBA98;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.reference_point_identifier", true}, {"reference_point_identifier", 0xFEDCBA98}});
 }
 
-TEST_F(ReadIfContextTest, Bandwidth) {
+TEST_P(ReadIfContextTest, Bandwidth) {
     buf_[0] = 0x20000000;
     buf_[1] = 0x00000001;
     buf_[2] = 0x00100000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.bandwidth", true}, {"bandwidth", 4097.0}});
 }
 
-TEST_F(ReadIfContextTest, BandwidthInvalid) {
+TEST_P(ReadIfContextTest, BandwidthInvalid) {
     buf_[0] = 0x20000000;
     buf_[1] = 0xFFFFFFFF;
     buf_[2] = 0xFFF00000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_BOUNDS_BANDWIDTH);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_BOUNDS_BANDWIDTH);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, false), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.bandwidth", true}, {"bandwidth", -1.0}});
 }
 
-TEST_F(ReadIfContextTest, IfReferenceFrequency) {
+TEST_P(ReadIfContextTest, IfReferenceFrequency) {
     buf_[0] = 0x10000000;
     buf_[1] = 0x00000001;
     buf_[2] = 0x00100000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.if_reference_frequency", true}, {"if_reference_frequency", 4097.0}});
 }
 
-TEST_F(ReadIfContextTest, RfReferenceFrequency) {
+TEST_P(ReadIfContextTest, RfReferenceFrequency) {
     buf_[0] = 0x08000000;
     buf_[1] = 0x00000001;
     buf_[2] = 0x00100000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.rf_reference_frequency", true}, {"rf_reference_frequency", 4097.0}});
 }
 
-TEST_F(ReadIfContextTest, RfReferenceFrequencyOffset) {
+TEST_P(ReadIfContextTest, RfReferenceFrequencyOffset) {
     buf_[0] = 0x04000000;
     buf_[1] = 0x00000001;
     buf_[2] = 0x00100000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.rf_reference_frequency_offset", true}, {"rf_reference_frequency_offset", 4097.0}});
 }
 
-TEST_F(ReadIfContextTest, IfBandOffset) {
+TEST_P(ReadIfContextTest, IfBandOffset) {
     buf_[0] = 0x02000000;
     buf_[1] = 0x00000001;
     buf_[2] = 0x00100000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.if_band_offset", true}, {"if_band_offset", 4097.0}});
 }
 
-TEST_F(ReadIfContextTest, ReferenceLevel) {
+TEST_P(ReadIfContextTest, ReferenceLevel) {
     buf_[0] = 0x01000000;
     buf_[1] = 0x0000FF80;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.reference_level", true}, {"reference_level", -1.0F}});
 }
 
-TEST_F(ReadIfContextTest, ReferenceLevelReserved) {
+TEST_P(ReadIfContextTest, ReferenceLevelReserved) {
     buf_[0] = 0x01000000;
     buf_[1] = 0xFFFFFF80;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, false), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), VRT_ERR_RESERVED);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, false), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.reference_level", true}, {"reference_level", -1.0F}});
 }
 
-TEST_F(ReadIfContextTest, Gain1) {
+TEST_P(ReadIfContextTest, Gain1) {
     buf_[0] = 0x00800000;
     buf_[1] = 0xFF80FF80;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.gain", true}, {"gain.stage2", -1.0F}, {"gain.stage1", -1.0F}});
 }
 
-TEST_F(ReadIfContextTest, Gain2) {
+TEST_P(ReadIfContextTest, Gain2) {
     buf_[0] = 0x00800000;
     buf_[1] = 0x0000FF80;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.gain", true}, {"gain.stage2", 0.0F}, {"gain.stage1", -1.0F}});
 }
 
-TEST_F(ReadIfContextTest, GainInvalid) {
+TEST_P(ReadIfContextTest, GainInvalid) {
     buf_[0] = 0x00800000;
     buf_[1] = 0xFF800000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), VRT_ERR_GAIN_STAGE2_SET);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, false), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), VRT_ERR_GAIN_STAGE2_SET);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, false), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.gain", true}, {"gain.stage2", -1.0F}, {"gain.stage1", 0.0F}});
 }
 
-TEST_F(ReadIfContextTest, OverRangeCount) {
+TEST_P(ReadIfContextTest, OverRangeCount) {
     buf_[0] = 0x00400000;
     buf_[1] = 0xFFEEDDCC;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.over_range_count", true}, {"over_range_count", static_cast<uint32_t>(0xFFEEDDCC)}});
 }
 
-TEST_F(ReadIfContextTest, SampleRate) {
+TEST_P(ReadIfContextTest, SampleRate) {
     buf_[0] = 0x00200000;
     buf_[1] = 0x00000001;
     buf_[2] = 0x00100000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.sample_rate", true}, {"sample_rate", 4097.0}});
 }
 
-TEST_F(ReadIfContextTest, SampleRateInvalid) {
+TEST_P(ReadIfContextTest, SampleRateInvalid) {
     buf_[0] = 0x00200000;
     buf_[1] = 0xFFFFFFFF;
     buf_[2] = 0xFFF00000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_BOUNDS_SAMPLE_RATE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_BOUNDS_SAMPLE_RATE);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, false), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.sample_rate", true}, {"sample_rate", -1.0}});
 }
 
-TEST_F(ReadIfContextTest, TimestampAdjustment) {
+TEST_P(ReadIfContextTest, TimestampAdjustment) {
     buf_[0] = 0x00100000;
     buf_[1] = 0xABCDEFAB;
     buf_[2] = 0xBABBABBA;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.timestamp_adjustment", true}, {"timestamp_adjustment", static_cast<uint64_t>(0xABCDEFABBABBABBA)}});
 }
 
-TEST_F(ReadIfContextTest, TimestampCalibrationTime) {
+TEST_P(ReadIfContextTest, TimestampCalibrationTime) {
     buf_[0] = 0x00080000;
     buf_[1] = 0xABCDEFAB;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.timestamp_calibration_time", true},
                            {"timestamp_calibration_time", static_cast<uint32_t>(0xABCDEFAB)}});
 }
 
-TEST_F(ReadIfContextTest, Temperature) {
+TEST_P(ReadIfContextTest, Temperature) {
     buf_[0] = 0x00040000;
     buf_[1] = 0x0000FFC0;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.temperature", true}, {"temperature", -1.0F}});
 }
 
-TEST_F(ReadIfContextTest, TemperatureInvalid) {
+TEST_P(ReadIfContextTest, TemperatureInvalid) {
     buf_[0] = 0x00040000;
     buf_[1] = 0x0000BB80;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), VRT_ERR_BOUNDS_TEMPERATURE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, false), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), VRT_ERR_BOUNDS_TEMPERATURE);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, false), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.temperature", true}, {"temperature", -274.0F}});
 }
 
-TEST_F(ReadIfContextTest, TemperatureReserved) {
+TEST_P(ReadIfContextTest, TemperatureReserved) {
     buf_[0] = 0x00040000;
     buf_[1] = 0xFFFFBBC0;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, false), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), VRT_ERR_RESERVED);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, false), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.temperature", true}, {"temperature", -273.0F}});
 }
 
-TEST_F(ReadIfContextTest, DeviceIdentifierOui) {
+TEST_P(ReadIfContextTest, DeviceIdentifierOui) {
     buf_[0] = 0x00020000;
     buf_[1] = 0x00ABCDEF;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.device_identifier", true}, {"device_identifier.oui", static_cast<uint32_t>(0x00ABCDEF)}});
 }
 
-TEST_F(ReadIfContextTest, DeviceIdentifierOuiInvalid) {
+TEST_P(ReadIfContextTest, DeviceIdentifierOuiInvalid) {
     buf_[0] = 0x00020000;
     buf_[1] = 0xFFABCDEF;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_RESERVED);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, false), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.device_identifier", true}, {"device_identifier.oui", static_cast<uint32_t>(0x00ABCDEF)}});
 }
 
-TEST_F(ReadIfContextTest, DeviceIdentifierDeviceCode) {
+TEST_P(ReadIfContextTest, DeviceIdentifierDeviceCode) {
     buf_[0] = 0x00020000;
     buf_[1] = 0x00000000;
     buf_[2] = 0x0000ABCD;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.device_identifier", true}, {"device_identifier.device_code", static_cast<uint16_t>(0xABCD)}});
 }
 
-TEST_F(ReadIfContextTest, DeviceIdentifierDeviceCodeInvalid) {
+TEST_P(ReadIfContextTest, DeviceIdentifierDeviceCodeInvalid) {
     buf_[0] = 0x00020000;
     buf_[1] = 0x00000000;
     buf_[2] = 0xFFFFABCD;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_RESERVED);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, false), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.device_identifier", true}, {"device_identifier.device_code", static_cast<uint16_t>(0xABCD)}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasCalibratedTime) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsHasCalibratedTime) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x80000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.state_and_event_indicators", true}, {"state_and_event_indicators.has.calibrated_time", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasValidData) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsHasValidData) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x40000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.state_and_event_indicators", true}, {"state_and_event_indicators.has.valid_data", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasReferenceLock) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsHasReferenceLock) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x20000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.state_and_event_indicators", true}, {"state_and_event_indicators.has.reference_lock", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasAgcOrMgc) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsHasAgcOrMgc) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x10000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.state_and_event_indicators", true}, {"state_and_event_indicators.has.agc_or_mgc", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasDetectedSignal) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsHasDetectedSignal) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x08000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.state_and_event_indicators", true}, {"state_and_event_indicators.has.detected_signal", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasSpectralInversion) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsHasSpectralInversion) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x04000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.state_and_event_indicators", true}, {"state_and_event_indicators.has.spectral_inversion", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasOverRange) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsHasOverRange) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x02000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.state_and_event_indicators", true}, {"state_and_event_indicators.has.over_range", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasSampleLoss) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsHasSampleLoss) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x01000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.state_and_event_indicators", true}, {"state_and_event_indicators.has.sample_loss", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsCalibratedTime) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsCalibratedTime) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00080000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsValidData) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsValidData) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00040000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsReferenceLock) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsReferenceLock) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00020000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsAgcOrMgc) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsAgcOrMgc) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00010000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsDetectedSignal) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsDetectedSignal) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00008000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsSpectralInversion) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsSpectralInversion) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00004000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsOverRange) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsOverRange) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00002000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsSampleLoss) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsSampleLoss) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00001000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothCalibratedTime) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsBothCalibratedTime) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x80080000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true},
                            {"state_and_event_indicators.has.calibrated_time", true},
                            {"state_and_event_indicators.calibrated_time", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothValidData) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsBothValidData) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x40040000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true},
                            {"state_and_event_indicators.has.valid_data", true},
                            {"state_and_event_indicators.valid_data", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothReferenceLock) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsBothReferenceLock) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x20020000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true},
                            {"state_and_event_indicators.has.reference_lock", true},
                            {"state_and_event_indicators.reference_lock", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothAgcOrMgc) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsBothAgcOrMgc) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x10010000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true},
                            {"state_and_event_indicators.has.agc_or_mgc", true},
                            {"state_and_event_indicators.agc_or_mgc", VRT_AOM_AGC}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothDetectedSignal) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsBothDetectedSignal) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x08008000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true},
                            {"state_and_event_indicators.has.detected_signal", true},
                            {"state_and_event_indicators.detected_signal", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothSpectralInversion) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsBothSpectralInversion) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x04004000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true},
                            {"state_and_event_indicators.has.spectral_inversion", true},
                            {"state_and_event_indicators.spectral_inversion", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothOverRange) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsBothOverRange) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x02002000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true},
                            {"state_and_event_indicators.has.over_range", true},
                            {"state_and_event_indicators.over_range", true}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsUserDefined) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsUserDefined) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x000000FF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true},
                            {"state_and_event_indicators.user_defined", static_cast<uint8_t>(0xFF)}});
 }
 
-TEST_F(ReadIfContextTest, StateAndEventIndicatorsReserved) {
+TEST_P(ReadIfContextTest, StateAndEventIndicatorsReserved) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00F00F00;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, false), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), VRT_ERR_RESERVED);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, false), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
 
-TEST_F(ReadIfContextTest, DataPacketPayloadFormatPackingMethod) {
+TEST_P(ReadIfContextTest, DataPacketPayloadFormatPackingMethod) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x80000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.packing_method", VRT_PM_LINK_EFFICIENT}});
 }
 
-TEST_F(ReadIfContextTest, DataPacketPayloadFormatRealOrComplex) {
+TEST_P(ReadIfContextTest, DataPacketPayloadFormatRealOrComplex) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x40000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.real_or_complex", VRT_ROC_COMPLEX_POLAR}});
 }
 
-TEST_F(ReadIfContextTest, DataPacketPayloadFormatRealOrComplexInvalid) {
+TEST_P(ReadIfContextTest, DataPacketPayloadFormatRealOrComplexInvalid) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x60000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_INVALID_REAL_OR_COMPLEX);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_INVALID_REAL_OR_COMPLEX);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, false), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.real_or_complex", static_cast<vrt_real_complex>(3)}});
 }
 
-TEST_F(ReadIfContextTest, DataPacketPayloadFormatDataItemFormat) {
+TEST_P(ReadIfContextTest, DataPacketPayloadFormatDataItemFormat) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x16000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.data_item_format", VRT_DIF_UNSIGNED_VRT_6_BIT_EXPONENT}});
 }
 
-TEST_F(ReadIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid1) {
+TEST_P(ReadIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid1) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x07000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, false), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.data_item_format", static_cast<vrt_data_item_format>(0x07)}});
 }
 
-TEST_F(ReadIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid2) {
+TEST_P(ReadIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid2) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x0D000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, false), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.data_item_format", static_cast<vrt_data_item_format>(0x0D)}});
 }
 
-TEST_F(ReadIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid3) {
+TEST_P(ReadIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid3) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x17000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, false), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.data_item_format", static_cast<vrt_data_item_format>(0x17)}});
 }
 
-TEST_F(ReadIfContextTest, DataPacketPayloadFormatSampleComponentRepeat) {
+TEST_P(ReadIfContextTest, DataPacketPayloadFormatSampleComponentRepeat) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x00800000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.data_packet_payload_format", true}, {"data_packet_payload_format.sample_component_repeat", true}});
 }
 
-TEST_F(ReadIfContextTest, DataPacketPayloadFormatEventTagSize) {
+TEST_P(ReadIfContextTest, DataPacketPayloadFormatEventTagSize) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x00700000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.event_tag_size", static_cast<uint8_t>(0x7)}});
 }
 
-TEST_F(ReadIfContextTest, DataPacketPayloadFormatChannelTagSize) {
+TEST_P(ReadIfContextTest, DataPacketPayloadFormatChannelTagSize) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x000F0000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.channel_tag_size", static_cast<uint8_t>(0xF)}});
 }
 
-TEST_F(ReadIfContextTest, DataPacketPayloadFormatItemPackingFieldSize) {
+TEST_P(ReadIfContextTest, DataPacketPayloadFormatItemPackingFieldSize) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x00000FC0;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.item_packing_field_size", static_cast<uint8_t>(0x3F)}});
 }
 
-TEST_F(ReadIfContextTest, DataPacketPayloadFormatDataItemSize) {
+TEST_P(ReadIfContextTest, DataPacketPayloadFormatDataItemSize) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x0000003F;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.data_item_size", static_cast<uint8_t>(0x3F)}});
 }
 
-TEST_F(ReadIfContextTest, DataPacketPayloadFormatRepeatCount) {
+TEST_P(ReadIfContextTest, DataPacketPayloadFormatRepeatCount) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x00000000;
     buf_[2] = 0xFFFF0000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.repeat_count", static_cast<uint16_t>(0xFFFF)}});
 }
 
-TEST_F(ReadIfContextTest, DataPacketPayloadFormatVectorSize) {
+TEST_P(ReadIfContextTest, DataPacketPayloadFormatVectorSize) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x00000000;
     buf_[2] = 0x0000FFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.vector_size", static_cast<uint16_t>(0xFFFF)}});
 }
 
-TEST_F(ReadIfContextTest, DataPacketPayloadFormatReserved) {
+TEST_P(ReadIfContextTest, DataPacketPayloadFormatReserved) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x0000F000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_RESERVED);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, false), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationTsi) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationTsi) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x0C000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -666,12 +674,12 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationTsi) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true}, {"formatted_gps_geolocation.tsi", VRT_TSI_OTHER}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationTsf) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationTsf) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x03000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -684,13 +692,13 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationTsf) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.formatted_gps_geolocation", true}, {"formatted_gps_geolocation.tsf", VRT_TSF_FREE_RUNNING_COUNT}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationOui) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationOui) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00FFFFFF;
     buf_[2]  = 0xFFFFFFFF;
@@ -703,13 +711,13 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationOui) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.oui", static_cast<uint32_t>(0x00FFFFFF)}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationIntegerSecondTimestamp) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationIntegerSecondTimestamp) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x04000000;
     buf_[2]  = 0xABABABAB;
@@ -722,14 +730,14 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationIntegerSecondTimestamp) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.tsi", VRT_TSI_UTC},
                            {"formatted_gps_geolocation.integer_second_timestamp", static_cast<uint32_t>(0xABABABAB)}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationIntegerSecondTimestampInvalid) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationIntegerSecondTimestampInvalid) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xABABABAB;
@@ -742,14 +750,14 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationIntegerSecondTimestampInvalid)
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.integer_second_timestamp", static_cast<uint32_t>(0xABABABAB)}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationFractionalSecondTimestamp) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationFractionalSecondTimestamp) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x01000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -762,7 +770,7 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationFractionalSecondTimestamp) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.formatted_gps_geolocation", true},
@@ -770,7 +778,7 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationFractionalSecondTimestamp) {
              {"formatted_gps_geolocation.fractional_second_timestamp", static_cast<uint64_t>(0x000000E8D4A50FFF)}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInvalid1) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInvalid1) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -783,15 +791,15 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInvali
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.formatted_gps_geolocation", true},
              {"formatted_gps_geolocation.fractional_second_timestamp", static_cast<uint64_t>(0x000000E8D4A50FFF)}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInvalid2) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInvalid2) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x02000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -804,8 +812,8 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInvali
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.formatted_gps_geolocation", true},
@@ -813,7 +821,7 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInvali
              {"formatted_gps_geolocation.fractional_second_timestamp", static_cast<uint64_t>(0x000000E8D4A51000)}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationLatitude) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationLatitude) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -826,14 +834,14 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationLatitude) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.latitude", true},
                            {"formatted_gps_geolocation.latitude", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationLatitudeInvalidSmall) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationLatitudeInvalidSmall) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -846,15 +854,15 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationLatitudeInvalidSmall) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LATITUDE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LATITUDE);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.latitude", true},
                            {"formatted_gps_geolocation.latitude", -91.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationLatitudeInvalidLarge) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationLatitudeInvalidLarge) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -867,15 +875,15 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationLatitudeInvalidLarge) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LATITUDE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LATITUDE);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.latitude", true},
                            {"formatted_gps_geolocation.latitude", 91.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationLongitude) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationLongitude) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -888,14 +896,14 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationLongitude) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.longitude", true},
                            {"formatted_gps_geolocation.longitude", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationLongitudeInvalidSmall) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationLongitudeInvalidSmall) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -908,15 +916,15 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationLongitudeInvalidSmall) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LONGITUDE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LONGITUDE);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.longitude", true},
                            {"formatted_gps_geolocation.longitude", -181.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationLongitudeInvalidLarge) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationLongitudeInvalidLarge) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -929,15 +937,15 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationLongitudeInvalidLarge) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LONGITUDE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LONGITUDE);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.longitude", true},
                            {"formatted_gps_geolocation.longitude", 181.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationAltitude) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationAltitude) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -950,14 +958,14 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationAltitude) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.altitude", true},
                            {"formatted_gps_geolocation.altitude", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationSpeedOverGround) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationSpeedOverGround) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -970,14 +978,14 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationSpeedOverGround) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.speed_over_ground", true},
                            {"formatted_gps_geolocation.speed_over_ground", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationHeadingAngle) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationHeadingAngle) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -990,14 +998,14 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationHeadingAngle) {
     buf_[9]  = 0x00400000;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.heading_angle", true},
                            {"formatted_gps_geolocation.heading_angle", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationHeadingAngleInvalidSmall) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationHeadingAngleInvalidSmall) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1010,15 +1018,15 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationHeadingAngleInvalidSmall) {
     buf_[9]  = 0xFFC00000;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.heading_angle", true},
                            {"formatted_gps_geolocation.heading_angle", -1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationHeadingAngleInvalidLarge) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationHeadingAngleInvalidLarge) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1031,15 +1039,15 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationHeadingAngleInvalidLarge) {
     buf_[9]  = 0x5A000000;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.heading_angle", true},
                            {"formatted_gps_geolocation.heading_angle", 360.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationTrackAngle) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationTrackAngle) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1052,14 +1060,14 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationTrackAngle) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x00400000;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.track_angle", true},
                            {"formatted_gps_geolocation.track_angle", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationTrackAngleInvalidSmall) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationTrackAngleInvalidSmall) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1072,15 +1080,15 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationTrackAngleInvalidSmall) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0xFFC00000;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.track_angle", true},
                            {"formatted_gps_geolocation.track_angle", -1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationTrackAngleInvalidLarge) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationTrackAngleInvalidLarge) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1093,15 +1101,15 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationTrackAngleInvalidLarge) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x5A000000;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.track_angle", true},
                            {"formatted_gps_geolocation.track_angle", 360.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationMagneticVariation) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationMagneticVariation) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1114,14 +1122,14 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationMagneticVariation) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x00400000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.magnetic_variation", true},
                            {"formatted_gps_geolocation.magnetic_variation", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationMagneticVariationInvalidSmall) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationMagneticVariationInvalidSmall) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1134,15 +1142,15 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationMagneticVariationInvalidSmall)
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0xD2C00000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.magnetic_variation", true},
                            {"formatted_gps_geolocation.magnetic_variation", -181.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationMagneticVariationInvalidLarge) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationMagneticVariationInvalidLarge) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1155,15 +1163,15 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationMagneticVariationInvalidLarge)
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x2D400000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.magnetic_variation", true},
                            {"formatted_gps_geolocation.magnetic_variation", 181.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedGpsGeolocationReserved) {
+TEST_P(ReadIfContextTest, FormattedGpsGeolocationReserved) {
     buf_[0]  = 0x00004000;
     buf_[1]  = 0xF0000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1176,13 +1184,13 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationReserved) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_RESERVED);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationTsi) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationTsi) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x0C000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1195,12 +1203,12 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationTsi) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true}, {"formatted_ins_geolocation.tsi", VRT_TSI_OTHER}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationTsf) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationTsf) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x03000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1213,13 +1221,13 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationTsf) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.formatted_ins_geolocation", true}, {"formatted_ins_geolocation.tsf", VRT_TSF_FREE_RUNNING_COUNT}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationOui) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationOui) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00FFFFFF;
     buf_[2]  = 0xFFFFFFFF;
@@ -1232,13 +1240,13 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationOui) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.oui", static_cast<uint32_t>(0x00FFFFFF)}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationIntegerSecondTimestamp) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationIntegerSecondTimestamp) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x04000000;
     buf_[2]  = 0xABABABAB;
@@ -1251,14 +1259,14 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationIntegerSecondTimestamp) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.tsi", VRT_TSI_UTC},
                            {"formatted_ins_geolocation.integer_second_timestamp", static_cast<uint32_t>(0xABABABAB)}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationIntegerSecondTimestampInvalid) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationIntegerSecondTimestampInvalid) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xABABABAB;
@@ -1271,14 +1279,14 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationIntegerSecondTimestampInvalid)
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.integer_second_timestamp", static_cast<uint32_t>(0xABABABAB)}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationFractionalSecondTimestamp) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationFractionalSecondTimestamp) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x01000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1291,7 +1299,7 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationFractionalSecondTimestamp) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.formatted_ins_geolocation", true},
@@ -1299,7 +1307,7 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationFractionalSecondTimestamp) {
              {"formatted_ins_geolocation.fractional_second_timestamp", static_cast<uint64_t>(0x000000E8D4A50FFF)}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInvalid1) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInvalid1) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1312,15 +1320,15 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInvali
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.formatted_ins_geolocation", true},
              {"formatted_ins_geolocation.fractional_second_timestamp", static_cast<uint64_t>(0x000000E8D4A50FFF)}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInvalid2) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInvalid2) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x02000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1333,8 +1341,8 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInvali
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.formatted_ins_geolocation", true},
@@ -1342,7 +1350,7 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInvali
              {"formatted_ins_geolocation.fractional_second_timestamp", static_cast<uint64_t>(0x000000E8D4A51000)}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationLatitude) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationLatitude) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1355,14 +1363,14 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationLatitude) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.latitude", true},
                            {"formatted_ins_geolocation.latitude", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationLatitudeInvalidSmall) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationLatitudeInvalidSmall) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1375,15 +1383,15 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationLatitudeInvalidSmall) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LATITUDE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LATITUDE);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.latitude", true},
                            {"formatted_ins_geolocation.latitude", -91.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationLatitudeInvalidLarge) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationLatitudeInvalidLarge) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1396,15 +1404,15 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationLatitudeInvalidLarge) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LATITUDE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LATITUDE);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.latitude", true},
                            {"formatted_ins_geolocation.latitude", 91.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationLongitude) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationLongitude) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1417,14 +1425,14 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationLongitude) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.longitude", true},
                            {"formatted_ins_geolocation.longitude", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationLongitudeInvalidSmall) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationLongitudeInvalidSmall) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1437,15 +1445,15 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationLongitudeInvalidSmall) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LONGITUDE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LONGITUDE);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.longitude", true},
                            {"formatted_ins_geolocation.longitude", -181.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationLongitudeInvalidLarge) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationLongitudeInvalidLarge) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1458,15 +1466,15 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationLongitudeInvalidLarge) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LONGITUDE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LONGITUDE);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.longitude", true},
                            {"formatted_ins_geolocation.longitude", 181.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationAltitude) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationAltitude) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1479,14 +1487,14 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationAltitude) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.altitude", true},
                            {"formatted_ins_geolocation.altitude", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationSpeedOverGround) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationSpeedOverGround) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1499,14 +1507,14 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationSpeedOverGround) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.speed_over_ground", true},
                            {"formatted_ins_geolocation.speed_over_ground", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationHeadingAngle) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationHeadingAngle) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1519,14 +1527,14 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationHeadingAngle) {
     buf_[9]  = 0x00400000;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.heading_angle", true},
                            {"formatted_ins_geolocation.heading_angle", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationHeadingAngleSmall) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationHeadingAngleSmall) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1539,15 +1547,15 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationHeadingAngleSmall) {
     buf_[9]  = 0xFFC00000;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.heading_angle", true},
                            {"formatted_ins_geolocation.heading_angle", -1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationHeadingAngleInvalidLarge) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationHeadingAngleInvalidLarge) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1560,15 +1568,15 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationHeadingAngleInvalidLarge) {
     buf_[9]  = 0x5A000000;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.heading_angle", true},
                            {"formatted_ins_geolocation.heading_angle", 360.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationTrackAngle) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationTrackAngle) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1581,14 +1589,14 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationTrackAngle) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x00400000;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.track_angle", true},
                            {"formatted_ins_geolocation.track_angle", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationTrackAngleInvalidSmall) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationTrackAngleInvalidSmall) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1601,15 +1609,15 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationTrackAngleInvalidSmall) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0xFFC00000;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.track_angle", true},
                            {"formatted_ins_geolocation.track_angle", -1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationTrackAngleInvalidLarge) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationTrackAngleInvalidLarge) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1622,15 +1630,15 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationTrackAngleInvalidLarge) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x5A000000;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.track_angle", true},
                            {"formatted_ins_geolocation.track_angle", 360.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationMagneticVariation) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationMagneticVariation) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1643,14 +1651,14 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationMagneticVariation) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x00400000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.magnetic_variation", true},
                            {"formatted_ins_geolocation.magnetic_variation", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationMagneticVariationInvalidSmall) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationMagneticVariationInvalidSmall) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1663,15 +1671,15 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationMagneticVariationInvalidSmall)
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0xD2C00000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.magnetic_variation", true},
                            {"formatted_ins_geolocation.magnetic_variation", -181.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationMagneticVariationInvalidLarge) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationMagneticVariationInvalidLarge) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1684,15 +1692,15 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationMagneticVariationInvalidLarge)
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x2D400000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.magnetic_variation", true},
                            {"formatted_ins_geolocation.magnetic_variation", 181.0}});
 }
 
-TEST_F(ReadIfContextTest, FormattedInsGeolocationReserved) {
+TEST_P(ReadIfContextTest, FormattedInsGeolocationReserved) {
     buf_[0]  = 0x00002000;
     buf_[1]  = 0xF0000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1705,13 +1713,13 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationReserved) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_RESERVED);
+    ASSERT_EQ(read_if_context(buf_.data(), 12, &c_, false), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisTsi) {
+TEST_P(ReadIfContextTest, EcefEphemerisTsi) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x0C000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1726,12 +1734,12 @@ TEST_F(ReadIfContextTest, EcefEphemerisTsi) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true}, {"ecef_ephemeris.tsi", VRT_TSI_OTHER}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisTsf) {
+TEST_P(ReadIfContextTest, EcefEphemerisTsf) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x03000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1746,12 +1754,12 @@ TEST_F(ReadIfContextTest, EcefEphemerisTsf) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true}, {"ecef_ephemeris.tsf", VRT_TSF_FREE_RUNNING_COUNT}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisEcefOui) {
+TEST_P(ReadIfContextTest, EcefEphemerisEcefOui) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x00FFFFFF;
     buf_[2]  = 0xFFFFFFFF;
@@ -1766,12 +1774,12 @@ TEST_F(ReadIfContextTest, EcefEphemerisEcefOui) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true}, {"ecef_ephemeris.oui", static_cast<uint32_t>(0x00FFFFFF)}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisIntegerSecondTimestamp) {
+TEST_P(ReadIfContextTest, EcefEphemerisIntegerSecondTimestamp) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x04000000;
     buf_[2]  = 0xABABABAB;
@@ -1786,14 +1794,14 @@ TEST_F(ReadIfContextTest, EcefEphemerisIntegerSecondTimestamp) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true},
                            {"ecef_ephemeris.tsi", VRT_TSI_UTC},
                            {"ecef_ephemeris.integer_second_timestamp", static_cast<uint32_t>(0xABABABAB)}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisIntegerSecondTimestampInvalid) {
+TEST_P(ReadIfContextTest, EcefEphemerisIntegerSecondTimestampInvalid) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xABABABAB;
@@ -1808,14 +1816,14 @@ TEST_F(ReadIfContextTest, EcefEphemerisIntegerSecondTimestampInvalid) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, false), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, false), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true},
                            {"ecef_ephemeris.integer_second_timestamp", static_cast<uint32_t>(0xABABABAB)}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisFractionalSecondTimestamp) {
+TEST_P(ReadIfContextTest, EcefEphemerisFractionalSecondTimestamp) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x01000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1830,14 +1838,14 @@ TEST_F(ReadIfContextTest, EcefEphemerisFractionalSecondTimestamp) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true},
                            {"ecef_ephemeris.tsf", VRT_TSF_SAMPLE_COUNT},
                            {"ecef_ephemeris.fractional_second_timestamp", static_cast<uint64_t>(0x000000E8D4A50FFF)}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid1) {
+TEST_P(ReadIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid1) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1852,14 +1860,14 @@ TEST_F(ReadIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid1) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, false), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, false), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true},
                            {"ecef_ephemeris.fractional_second_timestamp", static_cast<uint64_t>(0x000000E8D4A50FFF)}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid2) {
+TEST_P(ReadIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid2) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x02000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1874,15 +1882,15 @@ TEST_F(ReadIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid2) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, false), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, false), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true},
                            {"ecef_ephemeris.tsf", VRT_TSF_REAL_TIME},
                            {"ecef_ephemeris.fractional_second_timestamp", static_cast<uint64_t>(0x000000E8D4A51000)}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisPositionX) {
+TEST_P(ReadIfContextTest, EcefEphemerisPositionX) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1897,14 +1905,14 @@ TEST_F(ReadIfContextTest, EcefEphemerisPositionX) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_,
         {{"has.ecef_ephemeris", true}, {"ecef_ephemeris.has.position_x", true}, {"ecef_ephemeris.position_x", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisPositionY) {
+TEST_P(ReadIfContextTest, EcefEphemerisPositionY) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1919,14 +1927,14 @@ TEST_F(ReadIfContextTest, EcefEphemerisPositionY) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_,
         {{"has.ecef_ephemeris", true}, {"ecef_ephemeris.has.position_y", true}, {"ecef_ephemeris.position_y", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisPositionZ) {
+TEST_P(ReadIfContextTest, EcefEphemerisPositionZ) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1941,14 +1949,14 @@ TEST_F(ReadIfContextTest, EcefEphemerisPositionZ) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_,
         {{"has.ecef_ephemeris", true}, {"ecef_ephemeris.has.position_z", true}, {"ecef_ephemeris.position_z", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisAttitudeAlpha) {
+TEST_P(ReadIfContextTest, EcefEphemerisAttitudeAlpha) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1963,14 +1971,14 @@ TEST_F(ReadIfContextTest, EcefEphemerisAttitudeAlpha) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true},
                            {"ecef_ephemeris.has.attitude_alpha", true},
                            {"ecef_ephemeris.attitude_alpha", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisAttitudeBeta) {
+TEST_P(ReadIfContextTest, EcefEphemerisAttitudeBeta) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -1985,14 +1993,14 @@ TEST_F(ReadIfContextTest, EcefEphemerisAttitudeBeta) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true},
                            {"ecef_ephemeris.has.attitude_beta", true},
                            {"ecef_ephemeris.attitude_beta", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisAttitudePhi) {
+TEST_P(ReadIfContextTest, EcefEphemerisAttitudePhi) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2007,14 +2015,14 @@ TEST_F(ReadIfContextTest, EcefEphemerisAttitudePhi) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true},
                            {"ecef_ephemeris.has.attitude_phi", true},
                            {"ecef_ephemeris.attitude_phi", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisVelocityDx) {
+TEST_P(ReadIfContextTest, EcefEphemerisVelocityDx) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2029,14 +2037,14 @@ TEST_F(ReadIfContextTest, EcefEphemerisVelocityDx) {
     buf_[11] = 0x00010000;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_,
         {{"has.ecef_ephemeris", true}, {"ecef_ephemeris.has.velocity_dx", true}, {"ecef_ephemeris.velocity_dx", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisVelocityDy) {
+TEST_P(ReadIfContextTest, EcefEphemerisVelocityDy) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2051,14 +2059,14 @@ TEST_F(ReadIfContextTest, EcefEphemerisVelocityDy) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x00010000;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_,
         {{"has.ecef_ephemeris", true}, {"ecef_ephemeris.has.velocity_dy", true}, {"ecef_ephemeris.velocity_dy", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisVelocityDz) {
+TEST_P(ReadIfContextTest, EcefEphemerisVelocityDz) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2073,14 +2081,14 @@ TEST_F(ReadIfContextTest, EcefEphemerisVelocityDz) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x00010000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_,
         {{"has.ecef_ephemeris", true}, {"ecef_ephemeris.has.velocity_dz", true}, {"ecef_ephemeris.velocity_dz", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, EcefEphemerisReserved) {
+TEST_P(ReadIfContextTest, EcefEphemerisReserved) {
     buf_[0]  = 0x00001000;
     buf_[1]  = 0xF0000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2095,13 +2103,13 @@ TEST_F(ReadIfContextTest, EcefEphemerisReserved) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, false), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_RESERVED);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, false), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisTsi) {
+TEST_P(ReadIfContextTest, RelativeEphemerisTsi) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x0C000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2116,12 +2124,12 @@ TEST_F(ReadIfContextTest, RelativeEphemerisTsi) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true}, {"relative_ephemeris.tsi", VRT_TSI_OTHER}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisTsf) {
+TEST_P(ReadIfContextTest, RelativeEphemerisTsf) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x03000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2136,12 +2144,12 @@ TEST_F(ReadIfContextTest, RelativeEphemerisTsf) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true}, {"relative_ephemeris.tsf", VRT_TSF_FREE_RUNNING_COUNT}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisEcefOui) {
+TEST_P(ReadIfContextTest, RelativeEphemerisEcefOui) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x00FFFFFF;
     buf_[2]  = 0xFFFFFFFF;
@@ -2156,13 +2164,13 @@ TEST_F(ReadIfContextTest, RelativeEphemerisEcefOui) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.relative_ephemeris", true}, {"relative_ephemeris.oui", static_cast<uint32_t>(0x00FFFFFF)}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisIntegerSecondTimestamp) {
+TEST_P(ReadIfContextTest, RelativeEphemerisIntegerSecondTimestamp) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x04000000;
     buf_[2]  = 0xABABABAB;
@@ -2177,14 +2185,14 @@ TEST_F(ReadIfContextTest, RelativeEphemerisIntegerSecondTimestamp) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.tsi", VRT_TSI_UTC},
                            {"relative_ephemeris.integer_second_timestamp", static_cast<uint32_t>(0xABABABAB)}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisIntegerSecondTimestampInvalid) {
+TEST_P(ReadIfContextTest, RelativeEphemerisIntegerSecondTimestampInvalid) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xABABABAB;
@@ -2199,14 +2207,14 @@ TEST_F(ReadIfContextTest, RelativeEphemerisIntegerSecondTimestampInvalid) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, false), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, false), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.integer_second_timestamp", static_cast<uint32_t>(0xABABABAB)}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisFractionalSecondTimestamp) {
+TEST_P(ReadIfContextTest, RelativeEphemerisFractionalSecondTimestamp) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x01000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2221,7 +2229,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisFractionalSecondTimestamp) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.relative_ephemeris", true},
@@ -2229,7 +2237,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisFractionalSecondTimestamp) {
                        {"relative_ephemeris.fractional_second_timestamp", static_cast<uint64_t>(0x000000E8D4A50FFF)}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid1) {
+TEST_P(ReadIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid1) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2244,15 +2252,15 @@ TEST_F(ReadIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid1) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, false), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, false), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.relative_ephemeris", true},
                        {"relative_ephemeris.fractional_second_timestamp", static_cast<uint64_t>(0x000000E8D4A50FFF)}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid2) {
+TEST_P(ReadIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid2) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x02000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2267,8 +2275,8 @@ TEST_F(ReadIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid2) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, false), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, false), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.relative_ephemeris", true},
@@ -2276,7 +2284,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid2) {
                        {"relative_ephemeris.fractional_second_timestamp", static_cast<uint64_t>(0x000000E8D4A51000)}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisPositionX) {
+TEST_P(ReadIfContextTest, RelativeEphemerisPositionX) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2291,14 +2299,14 @@ TEST_F(ReadIfContextTest, RelativeEphemerisPositionX) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.position_x", true},
                            {"relative_ephemeris.position_x", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisPositionY) {
+TEST_P(ReadIfContextTest, RelativeEphemerisPositionY) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2313,14 +2321,14 @@ TEST_F(ReadIfContextTest, RelativeEphemerisPositionY) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.position_y", true},
                            {"relative_ephemeris.position_y", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisPositionZ) {
+TEST_P(ReadIfContextTest, RelativeEphemerisPositionZ) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2335,14 +2343,14 @@ TEST_F(ReadIfContextTest, RelativeEphemerisPositionZ) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.position_z", true},
                            {"relative_ephemeris.position_z", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisAttitudeAlpha) {
+TEST_P(ReadIfContextTest, RelativeEphemerisAttitudeAlpha) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2357,14 +2365,14 @@ TEST_F(ReadIfContextTest, RelativeEphemerisAttitudeAlpha) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.attitude_alpha", true},
                            {"relative_ephemeris.attitude_alpha", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisAttitudeBeta) {
+TEST_P(ReadIfContextTest, RelativeEphemerisAttitudeBeta) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2379,14 +2387,14 @@ TEST_F(ReadIfContextTest, RelativeEphemerisAttitudeBeta) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.attitude_beta", true},
                            {"relative_ephemeris.attitude_beta", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisAttitudePhi) {
+TEST_P(ReadIfContextTest, RelativeEphemerisAttitudePhi) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2401,14 +2409,14 @@ TEST_F(ReadIfContextTest, RelativeEphemerisAttitudePhi) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.attitude_phi", true},
                            {"relative_ephemeris.attitude_phi", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisVelocityDx) {
+TEST_P(ReadIfContextTest, RelativeEphemerisVelocityDx) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2423,14 +2431,14 @@ TEST_F(ReadIfContextTest, RelativeEphemerisVelocityDx) {
     buf_[11] = 0x00010000;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.velocity_dx", true},
                            {"relative_ephemeris.velocity_dx", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisVelocityDy) {
+TEST_P(ReadIfContextTest, RelativeEphemerisVelocityDy) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2445,14 +2453,14 @@ TEST_F(ReadIfContextTest, RelativeEphemerisVelocityDy) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x00010000;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.velocity_dy", true},
                            {"relative_ephemeris.velocity_dy", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisVelocityDz) {
+TEST_P(ReadIfContextTest, RelativeEphemerisVelocityDz) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0x00000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2467,14 +2475,14 @@ TEST_F(ReadIfContextTest, RelativeEphemerisVelocityDz) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x00010000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.velocity_dz", true},
                            {"relative_ephemeris.velocity_dz", 1.0}});
 }
 
-TEST_F(ReadIfContextTest, RelativeEphemerisReserved) {
+TEST_P(ReadIfContextTest, RelativeEphemerisReserved) {
     buf_[0]  = 0x00000800;
     buf_[1]  = 0xF0000000;
     buf_[2]  = 0xFFFFFFFF;
@@ -2489,37 +2497,37 @@ TEST_F(ReadIfContextTest, RelativeEphemerisReserved) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, false), 14);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_RESERVED);
+    ASSERT_EQ(read_if_context(buf_.data(), 14, &c_, false), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true}});
 }
 
-TEST_F(ReadIfContextTest, EphemerisReferenceIdentifier) {
+TEST_P(ReadIfContextTest, EphemerisReferenceIdentifier) {
     buf_[0] = 0x00000400;
     buf_[1] = 0xFFFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(read_if_context(buf_.data(), 2, &c_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.ephemeris_reference_identifier", true}, {"ephemeris_reference_identifier", 0xFFFFFFFF}});
 }
 
-TEST_F(ReadIfContextTest, GpsAsciiOui) {
+TEST_P(ReadIfContextTest, GpsAsciiOui) {
     buf_[0] = 0x00000200;
     buf_[1] = 0x00FFFFFF;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.gps_ascii", true}, {"gps_ascii.oui", static_cast<uint32_t>(0x00FFFFFF)}});
 }
 
-TEST_F(ReadIfContextTest, GpsAsciiAscii) {
+TEST_P(ReadIfContextTest, GpsAsciiAscii) {
     buf_[0] = 0x00000200;
     buf_[1] = 0x00000000;
     buf_[2] = 0x00000003;
     std::string str("Raspberry c");
     std::memcpy(buf_.data() + 3, str.c_str(), 3 * 4);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 6, &c_, true), 6);
+    ASSERT_EQ(read_if_context(buf_.data(), 6, &c_, true), 6);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.gps_ascii", true},
                            {"gps_ascii.number_of_words", static_cast<uint32_t>(0x00000003)},
@@ -2527,30 +2535,30 @@ TEST_F(ReadIfContextTest, GpsAsciiAscii) {
     ASSERT_STREQ(str.c_str(), reinterpret_cast<const char*>(buf_.data() + 3));
 }
 
-TEST_F(ReadIfContextTest, GpsAsciiReserved) {
+TEST_P(ReadIfContextTest, GpsAsciiReserved) {
     buf_[0] = 0x00000200;
     buf_[1] = 0xFF000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_RESERVED);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, false), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.gps_ascii", true}});
 }
 
-TEST_F(ReadIfContextTest, ContextAssocationListsEmpty) {
+TEST_P(ReadIfContextTest, ContextAssocationListsEmpty) {
     buf_[0] = 0x00000100;
     buf_[1] = 0x00000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.context_association_lists", true}});
 }
 
-TEST_F(ReadIfContextTest, ContextAssocationListsSource) {
+TEST_P(ReadIfContextTest, ContextAssocationListsSource) {
     buf_[0] = 0x00000100;
     buf_[1] = 0xFFFF0000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 514, &c_, true), 514);
+    ASSERT_EQ(read_if_context(buf_.data(), 514, &c_, true), 514);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.context_association_lists", true},
                            {"context_association_lists.source_list_size", static_cast<uint16_t>(0x01FF)},
@@ -2558,11 +2566,11 @@ TEST_F(ReadIfContextTest, ContextAssocationListsSource) {
                             const_cast<const uint32_t*>(buf_.data() + 3)}});
 }
 
-TEST_F(ReadIfContextTest, ContextAssocationListsSystem) {
+TEST_P(ReadIfContextTest, ContextAssocationListsSystem) {
     buf_[0] = 0x00000100;
     buf_[1] = 0x0000FFFF;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 514, &c_, true), 514);
+    ASSERT_EQ(read_if_context(buf_.data(), 514, &c_, true), 514);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.context_association_lists", true},
                            {"context_association_lists.system_list_size", static_cast<uint16_t>(0x01FF)},
@@ -2570,11 +2578,11 @@ TEST_F(ReadIfContextTest, ContextAssocationListsSystem) {
                             const_cast<const uint32_t*>(buf_.data() + 3)}});
 }
 
-TEST_F(ReadIfContextTest, ContextAssocationListsVectorComponent) {
+TEST_P(ReadIfContextTest, ContextAssocationListsVectorComponent) {
     buf_[0] = 0x00000100;
     buf_[1] = 0x00000000;
     buf_[2] = 0xFFFF0000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 65538, &c_, true), 65538);
+    ASSERT_EQ(read_if_context(buf_.data(), 65538, &c_, true), 65538);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.context_association_lists", true},
                            {"context_association_lists.vector_component_list_size", static_cast<uint16_t>(0xFFFF)},
@@ -2582,21 +2590,21 @@ TEST_F(ReadIfContextTest, ContextAssocationListsVectorComponent) {
                             const_cast<const uint32_t*>(buf_.data() + 3)}});
 }
 
-TEST_F(ReadIfContextTest, ContextAssocationListsHasChannelTag) {
+TEST_P(ReadIfContextTest, ContextAssocationListsHasChannelTag) {
     buf_[0] = 0x00000100;
     buf_[1] = 0x00000000;
     buf_[2] = 0x00008000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(read_if_context(buf_.data(), 3, &c_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.context_association_lists", true},
                            {"context_association_lists.has.asynchronous_channel_tag_list", true}});
 }
 
-TEST_F(ReadIfContextTest, ContextAssocationListsContextAssociation) {
+TEST_P(ReadIfContextTest, ContextAssocationListsContextAssociation) {
     buf_[0] = 0x00000100;
     buf_[1] = 0x00000000;
     buf_[2] = 0x00007FFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 32770, &c_, true), 32770);
+    ASSERT_EQ(read_if_context(buf_.data(), 32770, &c_, true), 32770);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.context_association_lists", true},
                            {"context_association_lists.asynchronous_channel_list_size", static_cast<uint16_t>(0x7FFF)},
@@ -2604,11 +2612,11 @@ TEST_F(ReadIfContextTest, ContextAssocationListsContextAssociation) {
                             const_cast<const uint32_t*>(buf_.data() + 3)}});
 }
 
-TEST_F(ReadIfContextTest, ContextAssocationListsContextChannelTag) {
+TEST_P(ReadIfContextTest, ContextAssocationListsContextChannelTag) {
     buf_[0] = 0x00000100;
     buf_[1] = 0x00000000;
     buf_[2] = 0x00008003;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 9, &c_, true), 9);
+    ASSERT_EQ(read_if_context(buf_.data(), 9, &c_, true), 9);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.context_association_lists", true},
                            {"context_association_lists.has.asynchronous_channel_tag_list", true},
@@ -2619,7 +2627,7 @@ TEST_F(ReadIfContextTest, ContextAssocationListsContextChannelTag) {
                             const_cast<const uint32_t*>(buf_.data() + 6)}});
 }
 
-TEST_F(ReadIfContextTest, EveryOther1) {
+TEST_P(ReadIfContextTest, EveryOther1) {
     buf_[0]  = 0xAAAAAA00; /* Context indicator field */
     buf_[1]  = 0x00000000;
     buf_[2]  = 0x00100000; /* Bandwidth */
@@ -2665,7 +2673,7 @@ TEST_F(ReadIfContextTest, EveryOther1) {
     buf_[42] = 0x5A5A5A5A;
     buf_[43] = 0x5A5A5A5A; /* GPS ASCII */
 
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 44, &c_, true), 44);
+    ASSERT_EQ(read_if_context(buf_.data(), 44, &c_, true), 44);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"context_field_change_indicator", true},
                            {"has.bandwidth", true},
@@ -2751,7 +2759,7 @@ TEST_F(ReadIfContextTest, EveryOther1) {
                            {"gps_ascii.ascii", reinterpret_cast<const char*>(buf_.data() + 41)}});
 }
 
-TEST_F(ReadIfContextTest, EveryOther2) {
+TEST_P(ReadIfContextTest, EveryOther2) {
     buf_[0]  = 0x55555500; /* Context indicator field */
     buf_[1]  = 0xFFFFFFFF; /* Reference point identifier */
     buf_[2]  = 0x00000000;
@@ -2797,7 +2805,7 @@ TEST_F(ReadIfContextTest, EveryOther2) {
     buf_[42] = 0x5A5A5A5A;
     buf_[43] = 0x5A5A5A5A; /* Context association lists */
 
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 44, &c_, true), 44);
+    ASSERT_EQ(read_if_context(buf_.data(), 44, &c_, true), 44);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_,
@@ -2900,7 +2908,7 @@ TEST_F(ReadIfContextTest, EveryOther2) {
          {"context_association_lists.asynchronous_channel_tag_list", const_cast<const uint32_t*>(buf_.data() + 43)}});
 }
 
-TEST_F(ReadIfContextTest, All) {
+TEST_P(ReadIfContextTest, All) {
     buf_[0]  = 0xFFFFFF00; /* Context indicator field */
     buf_[1]  = 0xFFFFFFFF; /* Reference point identifier */
     buf_[2]  = 0x00000000;
@@ -2989,7 +2997,7 @@ TEST_F(ReadIfContextTest, All) {
     buf_[85] = 0x5A5A5A5A;
     buf_[86] = 0x5A5A5A5A; /* Context association lists */
 
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 87, &c_, true), 87);
+    ASSERT_EQ(read_if_context(buf_.data(), 87, &c_, true), 87);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_,
@@ -3172,3 +3180,8 @@ TEST_F(ReadIfContextTest, All) {
           const_cast<const uint32_t*>(buf_.data() + 85)},
          {"context_association_lists.asynchronous_channel_tag_list", const_cast<const uint32_t*>(buf_.data() + 86)}});
 }
+
+INSTANTIATE_TEST_SUITE_P(ByteOrders,
+                         ReadIfContextTest,
+                         ::testing::Values(ByteOrder::HOST, ByteOrder::NETWORK),
+                         byte_order_name);
@@ -10,34 +10,42 @@
 #include <vrt/vrt_types.h>
 
 #include "hex.h"
+#include "byte_order.h"
 #include "init_garbage.h"
 #include "read_assertions.h"
 
-class ReadPacketTest : public ::testing::Test {
+class ReadPacketTest : public ::testing::TestWithParam<ByteOrder> {
    protected:
     void SetUp() override {
         init_garbage_packet(&p_);
         buf_.fill(0xBAADF00D);
     }
 
+    /* Reads buf_ in the byte order of the test parameter */
+    int32_t read_packet(void* buf, int32_t words_buf, vrt_packet* packet, bool validate) {
+        return call_in_order(
+            GetParam(), &buf_, [&] { return vrt_read_packet(buf, words_buf, packet, validate); },
+            [&] { return vrt_read_packet_be(buf, words_buf, packet, validate); });
+    }
+
     vrt_packet               p_{};
     std::array<uint32_t, 16> buf_{};
 };
 
-TEST_F(ReadPacketTest, NegativeSizeBuffer) {
-    ASSERT_EQ(vrt_read_packet(buf_.data(), -1, &p_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), -1, &p_, false), VRT_ERR_BUFFER_SIZE);
+TEST_P(ReadPacketTest, NegativeSizeBuffer) {
+    ASSERT_EQ(read_packet(buf_.data(), -1, &p_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_packet(buf_.data(), -1, &p_, false), VRT_ERR_BUFFER_SIZE);
 }
 
-TEST_F(ReadPacketTest, ZeroSizeBuffer) {
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 0, &p_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 0, &p_, false), VRT_ERR_BUFFER_SIZE);
+TEST_P(ReadPacketTest, ZeroSizeBuffer) {
+    ASSERT_EQ(read_packet(buf_.data(), 0, &p_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_packet(buf_.data(), 0, &p_, false), VRT_ERR_BUFFER_SIZE);
 }
 
-TEST_F(ReadPacketTest, EmptyIfDataWithoutStreamId) {
+TEST_P(ReadPacketTest, EmptyIfDataWithoutStreamId) {
     buf_[0] = 0x00000001;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 1, &p_, true), 1);
+    ASSERT_EQ(read_packet(buf_.data(), 1, &p_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_size", static_cast<uint16_t>(1)}});
     assert_fields(p_.fields, {});
@@ -45,11 +53,11 @@ TEST_F(ReadPacketTest, EmptyIfDataWithoutStreamId) {
     ASSERT_EQ(p_.body, nullptr);
 }
 
-TEST_F(ReadPacketTest, EmptyIfDataWithStreamId) {
+TEST_P(ReadPacketTest, EmptyIfDataWithStreamId) {
     buf_[0] = 0x10000002;
     buf_[1] = 0xABABABAB;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, true), 2);
+    ASSERT_EQ(read_packet(buf_.data(), 2, &p_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header,
                   {{"packet_type", VRT_PT_IF_DATA_WITH_STREAM_ID}, {"packet_size", static_cast<uint16_t>(2)}});
@@ -58,10 +66,10 @@ TEST_F(ReadPacketTest, EmptyIfDataWithStreamId) {
     ASSERT_EQ(p_.body, nullptr);
 }
 
-TEST_F(ReadPacketTest, EmptyExtDataWithoutStreamId) {
+TEST_P(ReadPacketTest, EmptyExtDataWithoutStreamId) {
     buf_[0] = 0x20000001;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 1, &p_, true), 1);
+    ASSERT_EQ(read_packet(buf_.data(), 1, &p_, true), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header,
                   {{"packet_type", VRT_PT_EXT_DATA_WITHOUT_STREAM_ID}, {"packet_size", static_cast<uint16_t>(1)}});
@@ -70,11 +78,11 @@ TEST_F(ReadPacketTest, EmptyExtDataWithoutStreamId) {
     ASSERT_EQ(p_.body, nullptr);
 }
 
-TEST_F(ReadPacketTest, EmptyExtDataWithStreamId) {
+TEST_P(ReadPacketTest, EmptyExtDataWithStreamId) {
     buf_[0] = 0x30000002;
     buf_[1] = 0xABABABAB;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, true), 2);
+    ASSERT_EQ(read_packet(buf_.data(), 2, &p_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header,
                   {{"packet_type", VRT_PT_EXT_DATA_WITH_STREAM_ID}, {"packet_size", static_cast<uint16_t>(2)}});
@@ -83,12 +91,12 @@ TEST_F(ReadPacketTest, EmptyExtDataWithStreamId) {
     ASSERT_EQ(p_.body, nullptr);
 }
 
-TEST_F(ReadPacketTest, EmptyIfContext) {
+TEST_P(ReadPacketTest, EmptyIfContext) {
     buf_[0] = 0x40000003;
     buf_[1] = 0xABABABAB;
     buf_[2] = 0x00000000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, true), 3);
+    ASSERT_EQ(read_packet(buf_.data(), 3, &p_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_type", VRT_PT_IF_CONTEXT}, {"packet_size", static_cast<uint16_t>(3)}});
     assert_fields(p_.fields, {{"stream_id", 0xABABABAB}});
@@ -97,11 +105,11 @@ TEST_F(ReadPacketTest, EmptyIfContext) {
     assert_if_context(p_.if_context, {});
 }
 
-TEST_F(ReadPacketTest, EmptyExtContext) {
+TEST_P(ReadPacketTest, EmptyExtContext) {
     buf_[0] = 0x50000002;
     buf_[1] = 0xABABABAB;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, true), 2);
+    ASSERT_EQ(read_packet(buf_.data(), 2, &p_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_type", VRT_PT_EXT_CONTEXT}, {"packet_size", static_cast<uint16_t>(2)}});
     assert_fields(p_.fields, {{"stream_id", 0xABABABAB}});
@@ -109,13 +117,13 @@ TEST_F(ReadPacketTest, EmptyExtContext) {
     ASSERT_EQ(p_.body, nullptr);
 }
 
-TEST_F(ReadPacketTest, BodyIfDataWithoutStreamId) {
+TEST_P(ReadPacketTest, BodyIfDataWithoutStreamId) {
     buf_[0] = 0x00000004;
     buf_[1] = 0xCECECECE;
     buf_[2] = 0xFEFEFEFE;
     buf_[3] = 0xDEDEDEDE;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 4, &p_, true), 4);
+    ASSERT_EQ(read_packet(buf_.data(), 4, &p_, true), 4);
     assert_header(p_.header, {{"packet_size", static_cast<uint16_t>(4)}});
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(p_.fields, {});
@@ -126,14 +134,14 @@ TEST_F(ReadPacketTest, BodyIfDataWithoutStreamId) {
     ASSERT_EQ(Hex(b[2]), Hex(0xDEDEDEDE));
 }
 
-TEST_F(ReadPacketTest, BodyIfDataWithStreamId) {
+TEST_P(ReadPacketTest, BodyIfDataWithStreamId) {
     buf_[0] = 0x10000005;
     buf_[1] = 0xABABABAB;
     buf_[2] = 0xCECECECE;
     buf_[3] = 0xFEFEFEFE;
     buf_[4] = 0xDEDEDEDE;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 5, &p_, true), 5);
+    ASSERT_EQ(read_packet(buf_.data(), 5, &p_, true), 5);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header,
                   {{"packet_type", VRT_PT_IF_DATA_WITH_STREAM_ID}, {"packet_size", static_cast<uint16_t>(5)}});
@@ -145,13 +153,13 @@ TEST_F(ReadPacketTest, BodyIfDataWithStreamId) {
     ASSERT_EQ(Hex(b[2]), Hex(0xDEDEDEDE));
 }
 
-TEST_F(ReadPacketTest, BodyExtDataWithoutStreamId) {
+TEST_P(ReadPacketTest, BodyExtDataWithoutStreamId) {
     buf_[0] = 0x20000004;
     buf_[1] = 0xCECECECE;
     buf_[2] = 0xFEFEFEFE;
     buf_[3] = 0xDEDEDEDE;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 4, &p_, true), 4);
+    ASSERT_EQ(read_packet(buf_.data(), 4, &p_, true), 4);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header,
                   {{"packet_type", VRT_PT_EXT_DATA_WITHOUT_STREAM_ID}, {"packet_size", static_cast<uint16_t>(4)}});
@@ -163,14 +171,14 @@ TEST_F(ReadPacketTest, BodyExtDataWithoutStreamId) {
     ASSERT_EQ(Hex(b[2]), Hex(0xDEDEDEDE));
 }
 
-TEST_F(ReadPacketTest, BodyExtDataWithStreamId) {
+TEST_P(ReadPacketTest, BodyExtDataWithStreamId) {
     buf_[0] = 0x30000005;
     buf_[1] = 0xABABABAB;
     buf_[2] = 0xCECECECE;
     buf_[3] = 0xFEFEFEFE;
     buf_[4] = 0xDEDEDEDE;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 5, &p_, true), 5);
+    ASSERT_EQ(read_packet(buf_.data(), 5, &p_, true), 5);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header,
                   {{"packet_type", VRT_PT_EXT_DATA_WITH_STREAM_ID}, {"packet_size", static_cast<uint16_t>(5)}});
@@ -182,12 +190,12 @@ TEST_F(ReadPacketTest, BodyExtDataWithStreamId) {
     ASSERT_EQ(Hex(b[2]), Hex(0xDEDEDEDE));
 }
 
-TEST_F(ReadPacketTest, BodyIfContext) {
+TEST_P(ReadPacketTest, BodyIfContext) {
     buf_[0] = 0x40000003;
     buf_[1] = 0xABABABAB;
     buf_[2] = 0x00000000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, true), 3);
+    ASSERT_EQ(read_packet(buf_.data(), 3, &p_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_type", VRT_PT_IF_CONTEXT}, {"packet_size", static_cast<uint16_t>(3)}});
     assert_fields(p_.fields, {{"stream_id", 0xABABABAB}});
@@ -196,14 +204,14 @@ TEST_F(ReadPacketTest, BodyIfContext) {
     assert_if_context(p_.if_context, {});
 }
 
-TEST_F(ReadPacketTest, BodyExtContext) {
+TEST_P(ReadPacketTest, BodyExtContext) {
     buf_[0] = 0x50000005;
     buf_[1] = 0xABABABAB;
     buf_[2] = 0xCECECECE;
     buf_[3] = 0xFEFEFEFE;
     buf_[4] = 0xDEDEDEDE;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 5, &p_, true), 5);
+    ASSERT_EQ(read_packet(buf_.data(), 5, &p_, true), 5);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_type", VRT_PT_EXT_CONTEXT}, {"packet_size", static_cast<uint16_t>(5)}});
     assert_fields(p_.fields, {{"stream_id", 0xABABABAB}});
@@ -214,20 +222,20 @@ TEST_F(ReadPacketTest, BodyExtContext) {
     ASSERT_EQ(Hex(b[2]), Hex(0xDEDEDEDE));
 }
 
-TEST_F(ReadPacketTest, BodyErrBufferSize) {
+TEST_P(ReadPacketTest, BodyErrBufferSize) {
     buf_[0] = 0x20000003;
     buf_[1] = 0xCECECECE;
     buf_[2] = 0xFEFEFEFE;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, false), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_packet(buf_.data(), 2, &p_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_packet(buf_.data(), 2, &p_, false), VRT_ERR_BUFFER_SIZE);
 }
 
-TEST_F(ReadPacketTest, TrailerIfDataWithoutStreamId) {
+TEST_P(ReadPacketTest, TrailerIfDataWithoutStreamId) {
     buf_[0] = 0x04000002;
     buf_[1] = 0x01001000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, true), 2);
+    ASSERT_EQ(read_packet(buf_.data(), 2, &p_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"has.trailer", true}, {"packet_size", static_cast<uint16_t>(2)}});
     assert_fields(p_.fields, {});
@@ -236,12 +244,12 @@ TEST_F(ReadPacketTest, TrailerIfDataWithoutStreamId) {
     assert_trailer(p_.trailer, {{"has.sample_loss", true}, {"sample_loss", true}});
 }
 
-TEST_F(ReadPacketTest, TrailerIfDataWithStreamId) {
+TEST_P(ReadPacketTest, TrailerIfDataWithStreamId) {
     buf_[0] = 0x14000003;
     buf_[1] = 0xABABABAB;
     buf_[2] = 0x01001000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, true), 3);
+    ASSERT_EQ(read_packet(buf_.data(), 3, &p_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_type", VRT_PT_IF_DATA_WITH_STREAM_ID},
                               {"has.trailer", true},
@@ -252,11 +260,11 @@ TEST_F(ReadPacketTest, TrailerIfDataWithStreamId) {
     assert_trailer(p_.trailer, {{"has.sample_loss", true}, {"sample_loss", true}});
 }
 
-TEST_F(ReadPacketTest, TrailerExtDataWithoutStreamId) {
+TEST_P(ReadPacketTest, TrailerExtDataWithoutStreamId) {
     buf_[0] = 0x24000002;
     buf_[1] = 0x01001000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, true), 2);
+    ASSERT_EQ(read_packet(buf_.data(), 2, &p_, true), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_type", VRT_PT_EXT_DATA_WITHOUT_STREAM_ID},
                               {"has.trailer", true},
@@ -266,12 +274,12 @@ TEST_F(ReadPacketTest, TrailerExtDataWithoutStreamId) {
     assert_trailer(p_.trailer, {{"has.sample_loss", true}, {"sample_loss", true}});
 }
 
-TEST_F(ReadPacketTest, TrailerExtDataWithStreamId) {
+TEST_P(ReadPacketTest, TrailerExtDataWithStreamId) {
     buf_[0] = 0x34000003;
     buf_[1] = 0xABABABAB;
     buf_[2] = 0x01001000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, true), 3);
+    ASSERT_EQ(read_packet(buf_.data(), 3, &p_, true), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_type", VRT_PT_EXT_DATA_WITH_STREAM_ID},
                               {"has.trailer", true},
@@ -282,13 +290,13 @@ TEST_F(ReadPacketTest, TrailerExtDataWithStreamId) {
     assert_trailer(p_.trailer, {{"has.sample_loss", true}, {"sample_loss", true}});
 }
 
-TEST_F(ReadPacketTest, TrailerIfContext) {
+TEST_P(ReadPacketTest, TrailerIfContext) {
     buf_[0] = 0x44000003;
     buf_[1] = 0xABABABAB;
     buf_[2] = 0x00000000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, true), VRT_ERR_TRAILER_IN_CONTEXT);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, false), 3);
+    ASSERT_EQ(read_packet(buf_.data(), 3, &p_, true), VRT_ERR_TRAILER_IN_CONTEXT);
+    ASSERT_EQ(read_packet(buf_.data(), 3, &p_, false), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(
         p_.header,
@@ -299,12 +307,12 @@ TEST_F(ReadPacketTest, TrailerIfContext) {
     assert_if_context(p_.if_context, {});
 }
 
-TEST_F(ReadPacketTest, TrailerExtContext) {
+TEST_P(ReadPacketTest, TrailerExtContext) {
     buf_[0] = 0x54000002;
     buf_[1] = 0xABABABAB;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, true), VRT_ERR_TRAILER_IN_CONTEXT);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, false), 2);
+    ASSERT_EQ(read_packet(buf_.data(), 2, &p_, true), VRT_ERR_TRAILER_IN_CONTEXT);
+    ASSERT_EQ(read_packet(buf_.data(), 2, &p_, false), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(
         p_.header,
@@ -314,23 +322,23 @@ TEST_F(ReadPacketTest, TrailerExtContext) {
     ASSERT_EQ(p_.body, nullptr);
 }
 
-TEST_F(ReadPacketTest, ValidationHeader) {
+TEST_P(ReadPacketTest, ValidationHeader) {
     buf_[0] = 0x02000001;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 1, &p_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 1, &p_, false), 1);
+    ASSERT_EQ(read_packet(buf_.data(), 1, &p_, true), VRT_ERR_RESERVED);
+    ASSERT_EQ(read_packet(buf_.data(), 1, &p_, false), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_size", static_cast<uint16_t>(1)}});
     ASSERT_EQ(p_.words_body, 0);
     ASSERT_EQ(p_.body, nullptr);
 }
 
-TEST_F(ReadPacketTest, ValidationFields) {
+TEST_P(ReadPacketTest, ValidationFields) {
     buf_[0] = 0x00200003;
     buf_[1] = 0xFFFFFFFF;
     buf_[2] = 0xFFFFFFFF;
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, false), 3);
+    ASSERT_EQ(read_packet(buf_.data(), 3, &p_, true), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(read_packet(buf_.data(), 3, &p_, false), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     ASSERT_EQ(Hex(p_.header.packet_type), Hex(VRT_PT_IF_DATA_WITHOUT_STREAM_ID));
 
@@ -340,14 +348,14 @@ TEST_F(ReadPacketTest, ValidationFields) {
     ASSERT_EQ(p_.body, nullptr);
 }
 
-TEST_F(ReadPacketTest, ValidationIfContext) {
+TEST_P(ReadPacketTest, ValidationIfContext) {
     buf_[0] = 0x40000005;
     buf_[1] = 0xABABABAB;
     buf_[2] = 0x00200000;
     buf_[3] = 0xFFFFFFFF;
     buf_[4] = 0xFFF00000;
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 5, &p_, true), VRT_ERR_BOUNDS_SAMPLE_RATE);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 5, &p_, false), 5);
+    ASSERT_EQ(read_packet(buf_.data(), 5, &p_, true), VRT_ERR_BOUNDS_SAMPLE_RATE);
+    ASSERT_EQ(read_packet(buf_.data(), 5, &p_, false), 5);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     ASSERT_TRUE(p_.if_context.has.sample_rate);
     ASSERT_DOUBLE_EQ(p_.if_context.sample_rate, -1.0);
@@ -359,23 +367,28 @@ TEST_F(ReadPacketTest, ValidationIfContext) {
     assert_if_context(p_.if_context, {{"has.sample_rate", true}, {"sample_rate", -1.0}});
 }
 
-TEST_F(ReadPacketTest, ValidationPacketSizeMismatch1) {
+TEST_P(ReadPacketTest, ValidationPacketSizeMismatch1) {
     buf_[0] = 0x04000001;
     buf_[1] = 0x01001000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, true), VRT_ERR_MISMATCH_PACKET_SIZE);
+    ASSERT_EQ(read_packet(buf_.data(), 3, &p_, true), VRT_ERR_MISMATCH_PACKET_SIZE);
 }
 
-TEST_F(ReadPacketTest, ValidationPacketSizeMismatch2) {
+TEST_P(ReadPacketTest, ValidationPacketSizeMismatch2) {
     buf_[0] = 0x40000004;
     buf_[1] = 0xABABABAB;
     buf_[2] = 0x00000000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, true), VRT_ERR_MISMATCH_PACKET_SIZE);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, false), 3);
+    ASSERT_EQ(read_packet(buf_.data(), 3, &p_, true), VRT_ERR_MISMATCH_PACKET_SIZE);
+    ASSERT_EQ(read_packet(buf_.data(), 3, &p_, false), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_type", VRT_PT_IF_CONTEXT}, {"packet_size", static_cast<uint16_t>(4)}});
     assert_fields(p_.fields, {{"stream_id", 0xABABABAB}});
     ASSERT_EQ(p_.words_body, 0);
     ASSERT_EQ(p_.body, nullptr);
 }
+
+INSTANTIATE_TEST_SUITE_P(ByteOrders,
+                         ReadPacketTest,
+                         ::testing::Values(ByteOrder::HOST, ByteOrder::NETWORK),
+                         byte_order_name);
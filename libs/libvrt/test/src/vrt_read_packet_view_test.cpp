@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <any>
+#include <array>
+#include <cstdint>
+
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_types.h>
+
+#include "byte_order.h"
+#include "hex.h"
+#include "init_garbage.h"
+#include "read_assertions.h"
+
+class ReadPacketViewTest : public ::testing::TestWithParam<ByteOrder> {
+   protected:
+    void SetUp() override {
+        init_garbage_if_context(&c_);
+        buf_.fill(0xBAADF00D);
+    }
+
+    /* Reads buf_ in the byte order of the test parameter */
+    int32_t read_packet_view(void* buf, int32_t words_buf, vrt_packet_view* view, bool validate) {
+        return call_in_order(
+            GetParam(), &buf_, [&] { return vrt_read_packet_view(buf, words_buf, view, validate); },
+            [&] { return vrt_read_packet_view_be(buf, words_buf, view, validate); });
+    }
+
+    /* Decodes the IF context of a view of buf_ in the byte order of the test parameter */
+    int32_t read_view_if_context(const vrt_packet_view* view, vrt_if_context* if_context, bool validate) {
+        return call_in_order(
+            GetParam(), &buf_, [&] { return vrt_read_view_if_context(view, if_context, validate); },
+            [&] { return vrt_read_view_if_context_be(view, if_context, validate); });
+    }
+
+    vrt_packet_view          v_{};
+    vrt_if_context           c_{};
+    std::array<uint32_t, 16> buf_{};
+};
+
+TEST_P(ReadPacketViewTest, NegativeSizeBuffer) {
+    ASSERT_EQ(read_packet_view(buf_.data(), -1, &v_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_packet_view(buf_.data(), -1, &v_, false), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_P(ReadPacketViewTest, ZeroSizeBuffer) {
+    ASSERT_EQ(read_packet_view(buf_.data(), 0, &v_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_packet_view(buf_.data(), 0, &v_, false), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_P(ReadPacketViewTest, EmptyIfDataWithoutStreamId) {
+    buf_[0] = 0x00000001;
+
+    ASSERT_EQ(read_packet_view(buf_.data(), 1, &v_, true), 1);
+    SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
+    assert_header(v_.header, {{"packet_size", static_cast<uint16_t>(1)}});
+    assert_fields(v_.fields, {});
+    ASSERT_EQ(v_.words_body, 0);
+    ASSERT_EQ(v_.body, nullptr);
+}
+
+TEST_P(ReadPacketViewTest, BodyIfDataWithStreamIdAndTrailer) {
+    buf_[0] = 0x14000004;
+    buf_[1] = 0xABABABAB;
+    buf_[2] = 0xCECECECE;
+    buf_[3] = 0x80080000;
+
+    ASSERT_EQ(read_packet_view(buf_.data(), buf_.size(), &v_, true), 4);
+    SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
+    assert_header(v_.header, {{"packet_type", VRT_PT_IF_DATA_WITH_STREAM_ID},
+                              {"has.trailer", true},
+                              {"packet_size", static_cast<uint16_t>(4)}});
+    assert_fields(v_.fields, {{"stream_id", static_cast<uint32_t>(0xABABABAB)}});
+    ASSERT_EQ(v_.words_body, 1);
+    ASSERT_EQ(v_.body, buf_.data() + 2);
+    ASSERT_EQ(Hex(buf_[2]), Hex(0xCECECECE));
+    assert_trailer(v_.trailer, {{"has.calibrated_time", true}, {"calibrated_time", true}});
+}
+
+TEST_P(ReadPacketViewTest, IfContextIsNotDecoded) {
+    buf_[0] = 0x40000005;
+    buf_[1] = 0xABABABAB;
+    buf_[2] = 0x20000000;
+    buf_[3] = 0x00000001;
+    buf_[4] = 0x00100000;
+
+    ASSERT_EQ(read_packet_view(buf_.data(), buf_.size(), &v_, true), 5);
+    ASSERT_EQ(v_.header.packet_type, VRT_PT_IF_CONTEXT);
+    ASSERT_EQ(v_.words_body, 3);
+    ASSERT_EQ(v_.body, buf_.data() + 2);
+
+    ASSERT_EQ(read_view_if_context(&v_, &c_, true), 3);
+    SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
+    assert_if_context(c_, {{"has.bandwidth", true}, {"bandwidth", 4097.0}});
+}
+
+TEST_P(ReadPacketViewTest, IfContextMismatch) {
+    buf_[0] = 0x40000006;
+    buf_[1] = 0xABABABAB;
+    buf_[2] = 0x20000000;
+    buf_[3] = 0x00000001;
+    buf_[4] = 0x00100000;
+
+    ASSERT_EQ(read_packet_view(buf_.data(), buf_.size(), &v_, true), 6);
+    ASSERT_EQ(read_view_if_context(&v_, &c_, true), VRT_ERR_MISMATCH_PACKET_SIZE);
+    ASSERT_EQ(read_view_if_context(&v_, &c_, false), 3);
+}
+
+TEST_P(ReadPacketViewTest, IfContextOfDataPacket) {
+    buf_[0] = 0x10000003;
+    buf_[1] = 0xABABABAB;
+    buf_[2] = 0x20000000;
+
+    ASSERT_EQ(read_packet_view(buf_.data(), buf_.size(), &v_, true), 3);
+    ASSERT_EQ(read_view_if_context(&v_, &c_, true), VRT_ERR_INVALID_PACKET_TYPE);
+}
+
+TEST_P(ReadPacketViewTest, IncompletePacket) {
+    buf_[0] = 0x14000004;
+    buf_[1] = 0xABABABAB;
+
+    ASSERT_EQ(read_packet_view(buf_.data(), 3, &v_, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(read_packet_view(buf_.data(), 2, &v_, false), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_P(ReadPacketViewTest, PacketSizeTooSmall) {
+    buf_[0] = 0x14000002;
+    buf_[1] = 0xABABABAB;
+
+    ASSERT_EQ(read_packet_view(buf_.data(), buf_.size(), &v_, true), VRT_ERR_MISMATCH_PACKET_SIZE);
+    ASSERT_EQ(read_packet_view(buf_.data(), buf_.size(), &v_, false), VRT_ERR_MISMATCH_PACKET_SIZE);
+}
+
+TEST_P(ReadPacketViewTest, ValidationHeader) {
+    buf_[0] = 0x41000002;
+    buf_[1] = 0xABABABAB;
+
+    ASSERT_EQ(read_packet_view(buf_.data(), buf_.size(), &v_, true), 2);
+    buf_[0] = 0x05000002;
+    ASSERT_EQ(read_packet_view(buf_.data(), buf_.size(), &v_, true), VRT_ERR_TSM_IN_DATA);
+}
+
+INSTANTIATE_TEST_SUITE_P(ByteOrders,
+                         ReadPacketViewTest,
+                         ::testing::Values(ByteOrder::HOST, ByteOrder::NETWORK),
+                         byte_order_name);
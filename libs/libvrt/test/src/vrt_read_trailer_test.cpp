@@ -9,312 +9,320 @@
 #include <vrt/vrt_read.h>
 #include <vrt/vrt_types.h>
 
+#include "byte_order.h"
 #include "init_garbage.h"
 #include "read_assertions.h"
 
-class ReadTrailerTest : public ::testing::Test {
+class ReadTrailerTest : public ::testing::TestWithParam<ByteOrder> {
    protected:
     void SetUp() override {
         init_garbage_trailer(&t_);
         buf_.fill(0xBAADF00D);
     }
 
+    /* Reads buf_ in the byte order of the test parameter */
+    int32_t read_trailer(const void* buf, int32_t words_buf, vrt_trailer* trailer) {
+        return call_in_order(
+            GetParam(), &buf_, [&] { return vrt_read_trailer(buf, words_buf, trailer); },
+            [&] { return vrt_read_trailer_be(buf, words_buf, trailer); });
+    }
+
     vrt_trailer             t_{};
     std::array<uint32_t, 2> buf_{};
 };
 
-TEST_F(ReadTrailerTest, NegativeSizeBuffer) {
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), -1, &t_), VRT_ERR_BUFFER_SIZE);
+TEST_P(ReadTrailerTest, NegativeSizeBuffer) {
+    ASSERT_EQ(read_trailer(buf_.data(), -1, &t_), VRT_ERR_BUFFER_SIZE);
 }
 
-TEST_F(ReadTrailerTest, ZeroSizeBuffer) {
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 0, &t_), VRT_ERR_BUFFER_SIZE);
+TEST_P(ReadTrailerTest, ZeroSizeBuffer) {
+    ASSERT_EQ(read_trailer(buf_.data(), 0, &t_), VRT_ERR_BUFFER_SIZE);
 }
 
-TEST_F(ReadTrailerTest, None) {
+TEST_P(ReadTrailerTest, None) {
     buf_[0] = 0x00000000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {});
 }
 
-TEST_F(ReadTrailerTest, HasCalibratedTime) {
+TEST_P(ReadTrailerTest, HasCalibratedTime) {
     buf_[0] = 0x80000000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.calibrated_time", true}});
 }
 
-TEST_F(ReadTrailerTest, HasValidData) {
+TEST_P(ReadTrailerTest, HasValidData) {
     buf_[0] = 0x40000000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.valid_data", true}});
 }
 
-TEST_F(ReadTrailerTest, HasReferenceLock) {
+TEST_P(ReadTrailerTest, HasReferenceLock) {
     buf_[0] = 0x20000000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.reference_lock", true}});
 }
 
-TEST_F(ReadTrailerTest, HasAgcOrMgc) {
+TEST_P(ReadTrailerTest, HasAgcOrMgc) {
     buf_[0] = 0x10000000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.agc_or_mgc", true}});
 }
 
-TEST_F(ReadTrailerTest, HasDetectedSignal) {
+TEST_P(ReadTrailerTest, HasDetectedSignal) {
     buf_[0] = 0x08000000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.detected_signal", true}});
 }
 
-TEST_F(ReadTrailerTest, HasSpectralInversion) {
+TEST_P(ReadTrailerTest, HasSpectralInversion) {
     buf_[0] = 0x04000000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.spectral_inversion", true}});
 }
 
-TEST_F(ReadTrailerTest, hasOverRange) {
+TEST_P(ReadTrailerTest, hasOverRange) {
     buf_[0] = 0x02000000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.over_range", true}});
 }
 
-TEST_F(ReadTrailerTest, HasSampleLoss) {
+TEST_P(ReadTrailerTest, HasSampleLoss) {
     buf_[0] = 0x01000000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.sample_loss", true}});
 }
 
-TEST_F(ReadTrailerTest, HasUserDefined11) {
+TEST_P(ReadTrailerTest, HasUserDefined11) {
     buf_[0] = 0x00800000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.user_defined11", true}});
 }
 
-TEST_F(ReadTrailerTest, HasUserDefined10) {
+TEST_P(ReadTrailerTest, HasUserDefined10) {
     buf_[0] = 0x00400000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.user_defined10", true}});
 }
 
-TEST_F(ReadTrailerTest, HasUserDefined9) {
+TEST_P(ReadTrailerTest, HasUserDefined9) {
     buf_[0] = 0x00200000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.user_defined9", true}});
 }
 
-TEST_F(ReadTrailerTest, HasUserDefined8) {
+TEST_P(ReadTrailerTest, HasUserDefined8) {
     buf_[0] = 0x00100000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.user_defined8", true}});
 }
 
-TEST_F(ReadTrailerTest, CalibratedTime) {
+TEST_P(ReadTrailerTest, CalibratedTime) {
     buf_[0] = 0x00080000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {});
 }
 
-TEST_F(ReadTrailerTest, ValidData) {
+TEST_P(ReadTrailerTest, ValidData) {
     buf_[0] = 0x00040000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {});
 }
 
-TEST_F(ReadTrailerTest, ReferenceLock) {
+TEST_P(ReadTrailerTest, ReferenceLock) {
     buf_[0] = 0x00020000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {});
 }
 
-TEST_F(ReadTrailerTest, AgcOrMgc) {
+TEST_P(ReadTrailerTest, AgcOrMgc) {
     buf_[0] = 0x00010000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {});
 }
 
-TEST_F(ReadTrailerTest, DetectedSignal) {
+TEST_P(ReadTrailerTest, DetectedSignal) {
     buf_[0] = 0x00008000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {});
 }
 
-TEST_F(ReadTrailerTest, SpectralInversion) {
+TEST_P(ReadTrailerTest, SpectralInversion) {
     buf_[0] = 0x00004000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {});
 }
 
-TEST_F(ReadTrailerTest, OverRange) {
+TEST_P(ReadTrailerTest, OverRange) {
     buf_[0] = 0x00002000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {});
 }
 
-TEST_F(ReadTrailerTest, SampleLoss) {
+TEST_P(ReadTrailerTest, SampleLoss) {
     buf_[0] = 0x00001000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {});
 }
 
-TEST_F(ReadTrailerTest, UserDefined11) {
+TEST_P(ReadTrailerTest, UserDefined11) {
     buf_[0] = 0x00000800;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {});
 }
 
-TEST_F(ReadTrailerTest, UserDefined10) {
+TEST_P(ReadTrailerTest, UserDefined10) {
     buf_[0] = 0x00000400;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {});
 }
 
-TEST_F(ReadTrailerTest, UserDefined9) {
+TEST_P(ReadTrailerTest, UserDefined9) {
     buf_[0] = 0x00000200;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {});
 }
 
-TEST_F(ReadTrailerTest, UserDefined8) {
+TEST_P(ReadTrailerTest, UserDefined8) {
     buf_[0] = 0x00000100;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {});
 }
 
-TEST_F(ReadTrailerTest, BothCalibratedTime) {
+TEST_P(ReadTrailerTest, BothCalibratedTime) {
     buf_[0] = 0x80080000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.calibrated_time", true}, {"calibrated_time", true}});
 }
 
-TEST_F(ReadTrailerTest, BothValidData) {
+TEST_P(ReadTrailerTest, BothValidData) {
     buf_[0] = 0x40040000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.valid_data", true}, {"valid_data", true}});
 }
 
-TEST_F(ReadTrailerTest, BothReferenceLock) {
+TEST_P(ReadTrailerTest, BothReferenceLock) {
     buf_[0] = 0x20020000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.reference_lock", true}, {"reference_lock", true}});
 }
 
-TEST_F(ReadTrailerTest, BothAgcOrMgc) {
+TEST_P(ReadTrailerTest, BothAgcOrMgc) {
     buf_[0] = 0x10010000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.agc_or_mgc", true}, {"agc_or_mgc", VRT_AOM_AGC}});
 }
 
-TEST_F(ReadTrailerTest, BothDetectedSignal) {
+TEST_P(ReadTrailerTest, BothDetectedSignal) {
     buf_[0] = 0x08008000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.detected_signal", true}, {"detected_signal", true}});
 }
 
-TEST_F(ReadTrailerTest, BothSpectralInversion) {
+TEST_P(ReadTrailerTest, BothSpectralInversion) {
     buf_[0] = 0x04004000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.spectral_inversion", true}, {"spectral_inversion", true}});
 }
 
-TEST_F(ReadTrailerTest, BothOverRange) {
+TEST_P(ReadTrailerTest, BothOverRange) {
     buf_[0] = 0x02002000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.over_range", true}, {"over_range", true}});
 }
 
-TEST_F(ReadTrailerTest, BothSampleLoss) {
+TEST_P(ReadTrailerTest, BothSampleLoss) {
     buf_[0] = 0x01001000;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.sample_loss", true}, {"sample_loss", true}});
 }
 
-TEST_F(ReadTrailerTest, BothUserDefined11) {
+TEST_P(ReadTrailerTest, BothUserDefined11) {
     buf_[0] = 0x00800800;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.user_defined11", true}, {"user_defined11", true}});
 }
 
-TEST_F(ReadTrailerTest, BothUserDefined10) {
+TEST_P(ReadTrailerTest, BothUserDefined10) {
     buf_[0] = 0x00400400;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.user_defined10", true}, {"user_defined10", true}});
 }
 
-TEST_F(ReadTrailerTest, BothUserDefined9) {
+TEST_P(ReadTrailerTest, BothUserDefined9) {
     buf_[0] = 0x00200200;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.user_defined9", true}, {"user_defined9", true}});
 }
 
-TEST_F(ReadTrailerTest, BothUserDefined8) {
+TEST_P(ReadTrailerTest, BothUserDefined8) {
     buf_[0] = 0x00100100;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.user_defined8", true}, {"user_defined8", true}});
 }
 
-TEST_F(ReadTrailerTest, HasAssociatedContextPacketCount) {
+TEST_P(ReadTrailerTest, HasAssociatedContextPacketCount) {
     buf_[0] = 0x00000080;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.associated_context_packet_count", true}});
 }
 
-TEST_F(ReadTrailerTest, AssociatedContextPacketCount) {
+TEST_P(ReadTrailerTest, AssociatedContextPacketCount) {
     buf_[0] = 0x0000007E;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {});
 }
 
-TEST_F(ReadTrailerTest, BothAssociatedContextPacketCount) {
+TEST_P(ReadTrailerTest, BothAssociatedContextPacketCount) {
     buf_[0] = 0x000000FF;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.associated_context_packet_count", true},
                         {"associated_context_packet_count", static_cast<uint8_t>(0x7F)}});
 }
 
-TEST_F(ReadTrailerTest, EveryOther1) {
+TEST_P(ReadTrailerTest, EveryOther1) {
     buf_[0] = 0x55555555;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.valid_data", true},
                         {"valid_data", true},
@@ -330,9 +338,9 @@ TEST_F(ReadTrailerTest, EveryOther1) {
                         {"user_defined8", true}});
 }
 
-TEST_F(ReadTrailerTest, EveryOther2) {
+TEST_P(ReadTrailerTest, EveryOther2) {
     buf_[0] = 0xAAAAAAAA;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.calibrated_time", true},
                         {"calibrated_time", true},
@@ -350,9 +358,9 @@ TEST_F(ReadTrailerTest, EveryOther2) {
                         {"associated_context_packet_count", static_cast<uint8_t>(0x2A)}});
 }
 
-TEST_F(ReadTrailerTest, All) {
+TEST_P(ReadTrailerTest, All) {
     buf_[0] = 0xFFFFFFFE;
-    ASSERT_EQ(vrt_read_trailer(buf_.data(), 1, &t_), 1);
+    ASSERT_EQ(read_trailer(buf_.data(), 1, &t_), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_trailer(t_, {{"has.calibrated_time", true},
                         {"calibrated_time", true},
@@ -381,3 +389,8 @@ TEST_F(ReadTrailerTest, All) {
                         {"has.associated_context_packet_count", true},
                         {"associated_context_packet_count", static_cast<uint8_t>(0x7E)}});
 }
+
+INSTANTIATE_TEST_SUITE_P(ByteOrders,
+                         ReadTrailerTest,
+                         ::testing::Values(ByteOrder::HOST, ByteOrder::NETWORK),
+                         byte_order_name);
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_time.h>
+#include <vrt/vrt_types.h>
+
+class TimeCalendarFieldsNTest : public ::testing::Test {
+   protected:
+    void SetUp() override { vrt_init_header(&h_); }
+
+    /* Adds a fields section with the given timestamps */
+    void add(uint32_t integer, uint64_t fractional) {
+        vrt_fields f{};
+        vrt_init_fields(&f);
+        f.integer_seconds_timestamp    = integer;
+        f.fractional_seconds_timestamp = fractional;
+        f_.push_back(f);
+    }
+
+    /* Converts all fields sections and compares each with the single element conversion */
+    void assert_same_as_single(double sample_rate) {
+        std::vector<vrt_calendar_time> cal(f_.size() + 1);
+        cal.back().year = -1;
+        ASSERT_EQ(vrt_time_calendar_fields_n(&h_, f_.data(), static_cast<int32_t>(f_.size()), sample_rate, cal.data()),
+                  0);
+        for (size_t i = 0; i < f_.size(); ++i) {
+            SCOPED_TRACE(i);
+            vrt_calendar_time expected{};
+            ASSERT_EQ(vrt_time_calendar_fields(&h_, &f_[i], sample_rate, &expected), 0);
+            ASSERT_EQ(cal[i].year, expected.year);
+            ASSERT_EQ(cal[i].mday, expected.mday);
+            ASSERT_EQ(cal[i].yday, expected.yday);
+            ASSERT_EQ(cal[i].sec, expected.sec);
+            ASSERT_EQ(cal[i].min, expected.min);
+            ASSERT_EQ(cal[i].hour, expected.hour);
+            ASSERT_EQ(cal[i].mon, expected.mon);
+            ASSERT_EQ(cal[i].wday, expected.wday);
+            ASSERT_EQ(cal[i].ps, expected.ps);
+        }
+        ASSERT_EQ(cal.back().year, -1);
+    }
+
+    vrt_header              h_{};
+    std::vector<vrt_fields> f_;
+};
+
+TEST_F(TimeCalendarFieldsNTest, Empty) {
+    h_.tsi = VRT_TSI_UTC;
+    ASSERT_EQ(vrt_time_calendar_fields_n(&h_, nullptr, 0, 0.0, nullptr), 0);
+}
+
+TEST_F(TimeCalendarFieldsNTest, TsiNone) {
+    add(0, 0);
+    vrt_calendar_time cal{};
+    ASSERT_EQ(vrt_time_calendar_fields_n(&h_, f_.data(), 1, 0.0, &cal), VRT_ERR_INVALID_TSI);
+}
+
+TEST_F(TimeCalendarFieldsNTest, TsiUtcAcrossMidnight) {
+    h_.tsi = VRT_TSI_UTC;
+    /* 2020-12-31 23:59:58 and onwards, i.e. crossing both day, month, and year */
+    for (uint32_t t = 1609459198; t < 1609459203; ++t) {
+        add(t, 0);
+    }
+    assert_same_as_single(0.0);
+}
+
+TEST_F(TimeCalendarFieldsNTest, TsiUtcOutOfOrder) {
+    h_.tsi = VRT_TSI_UTC;
+    add(1608751092, 0);
+    add(1608751092 + 3600, 0);
+    add(1608751092 - 86400, 0);
+    add(1608751092 - 86399, 0);
+    add(0, 0);
+    add(86399, 0);
+    add(86400, 0);
+    add(UINT32_MAX, 0);
+    add(1608751092, 0);
+    assert_same_as_single(0.0);
+}
+
+TEST_F(TimeCalendarFieldsNTest, TsiGpsTsfRealTime) {
+    h_.tsi = VRT_TSI_GPS;
+    h_.tsf = VRT_TSF_REAL_TIME;
+    for (uint32_t t = 0; t < 200000; t += 997) {
+        add(1293000000 + t, t * 1000003ULL);
+    }
+    assert_same_as_single(0.0);
+}
+
+TEST_F(TimeCalendarFieldsNTest, TsiUtcTsfSampleCount) {
+    h_.tsi = VRT_TSI_UTC;
+    h_.tsf = VRT_TSF_SAMPLE_COUNT;
+    for (uint32_t i = 0; i < 100; ++i) {
+        add(1608768000 - 50 + i, (i * 123457) % 16000000);
+    }
+    assert_same_as_single(16e6);
+}
+
+TEST_F(TimeCalendarFieldsNTest, MissingSampleRate) {
+    h_.tsi = VRT_TSI_UTC;
+    h_.tsf = VRT_TSF_SAMPLE_COUNT;
+    add(1608751092, 0);
+    std::vector<vrt_calendar_time> cal(1);
+    ASSERT_EQ(vrt_time_calendar_fields_n(&h_, f_.data(), 1, 0.0, cal.data()), VRT_ERR_MISSING_SAMPLE_RATE);
+}
+
+TEST_F(TimeCalendarFieldsNTest, BoundsRealTime) {
+    h_.tsi = VRT_TSI_UTC;
+    h_.tsf = VRT_TSF_REAL_TIME;
+    add(1608751092, 0);
+    add(1608751093, 1000000000000);
+    std::vector<vrt_calendar_time> cal(2);
+    ASSERT_EQ(vrt_time_calendar_fields_n(&h_, f_.data(), 2, 0.0, cal.data()), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(cal[0].sec, 12);
+}
+
+TEST_F(TimeCalendarFieldsNTest, TsfFreeRunningCount) {
+    h_.tsi = VRT_TSI_UTC;
+    h_.tsf = VRT_TSF_FREE_RUNNING_COUNT;
+    add(1608751092, 0);
+    std::vector<vrt_calendar_time> cal(1);
+    ASSERT_EQ(vrt_time_calendar_fields_n(&h_, f_.data(), 1, 1e6, cal.data()), VRT_ERR_INVALID_TSF);
+}
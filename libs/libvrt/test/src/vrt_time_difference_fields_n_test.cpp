@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_time.h>
+#include <vrt/vrt_types.h>
+
+class TimeDifferenceFieldsNTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vrt_init_header(&h_);
+        vrt_init_fields(&ref_);
+    }
+
+    /* Adds a fields section with the given timestamps */
+    void add(uint32_t integer, uint64_t fractional) {
+        vrt_fields f{};
+        vrt_init_fields(&f);
+        f.integer_seconds_timestamp    = integer;
+        f.fractional_seconds_timestamp = fractional;
+        f_.push_back(f);
+    }
+
+    /* Calculates all differences and compares each with the single element calculation */
+    void assert_same_as_single(double sample_rate) {
+        std::vector<vrt_time> diff(f_.size());
+        ASSERT_EQ(vrt_time_difference_fields_n(&h_, f_.data(), static_cast<int32_t>(f_.size()), &ref_, sample_rate,
+                                               diff.data()),
+                  0);
+        for (size_t i = 0; i < f_.size(); ++i) {
+            SCOPED_TRACE(i);
+            vrt_time expected{};
+            ASSERT_EQ(vrt_time_difference_fields(&h_, &f_[i], &h_, &ref_, sample_rate, &expected), 0);
+            ASSERT_EQ(diff[i].s, expected.s);
+            ASSERT_EQ(diff[i].ps, expected.ps);
+        }
+    }
+
+    vrt_header              h_{};
+    vrt_fields              ref_{};
+    std::vector<vrt_fields> f_;
+};
+
+TEST_F(TimeDifferenceFieldsNTest, Empty) {
+    ASSERT_EQ(vrt_time_difference_fields_n(&h_, nullptr, 0, &ref_, 0.0, nullptr), 0);
+}
+
+TEST_F(TimeDifferenceFieldsNTest, None) {
+    add(1, 2);
+    add(3, 4);
+    assert_same_as_single(0.0);
+}
+
+TEST_F(TimeDifferenceFieldsNTest, TsiUtc) {
+    h_.tsi                         = VRT_TSI_UTC;
+    ref_.integer_seconds_timestamp = 1000;
+    add(1000, 0);
+    add(999, 0);
+    add(2000, 0);
+    assert_same_as_single(0.0);
+}
+
+TEST_F(TimeDifferenceFieldsNTest, TsiUtcTsfRealTime) {
+    h_.tsi                            = VRT_TSI_UTC;
+    h_.tsf                            = VRT_TSF_REAL_TIME;
+    ref_.integer_seconds_timestamp    = 1608751092;
+    ref_.fractional_seconds_timestamp = 500000000000;
+    for (uint32_t i = 0; i < 50; ++i) {
+        add(1608751092 - 5 + i / 5, (i * 234567890123ULL) % 1000000000000);
+    }
+    assert_same_as_single(0.0);
+}
+
+TEST_F(TimeDifferenceFieldsNTest, TsiUtcTsfSampleCount) {
+    h_.tsi                            = VRT_TSI_UTC;
+    h_.tsf                            = VRT_TSF_SAMPLE_COUNT;
+    ref_.integer_seconds_timestamp    = 1608751092;
+    ref_.fractional_seconds_timestamp = 8000000;
+    for (uint32_t i = 0; i < 50; ++i) {
+        add(1608751092 - 5 + i / 5, (i * 1234567) % 16000000);
+    }
+    assert_same_as_single(16e6);
+}
+
+TEST_F(TimeDifferenceFieldsNTest, TsfFreeRunningCount) {
+    h_.tsf                            = VRT_TSF_FREE_RUNNING_COUNT;
+    ref_.fractional_seconds_timestamp = 100000000;
+    for (uint32_t i = 0; i < 50; ++i) {
+        add(0, 100000000 - 5000000 + i * 1234567);
+    }
+    assert_same_as_single(1e6);
+}
+
+TEST_F(TimeDifferenceFieldsNTest, TsfRealTime) {
+    h_.tsf                            = VRT_TSF_REAL_TIME;
+    ref_.fractional_seconds_timestamp = 500000000000;
+    for (uint32_t i = 0; i < 10; ++i) {
+        add(0, (i * 234567890123ULL) % 1000000000000);
+    }
+    assert_same_as_single(0.0);
+}
+
+TEST_F(TimeDifferenceFieldsNTest, MissingSampleRate) {
+    add(0, 0);
+    std::vector<vrt_time> diff(1);
+    for (vrt_tsf tsf : {VRT_TSF_SAMPLE_COUNT, VRT_TSF_FREE_RUNNING_COUNT}) {
+        h_.tsf = tsf;
+        ASSERT_EQ(vrt_time_difference_fields_n(&h_, f_.data(), 1, &ref_, 0.0, diff.data()),
+                  VRT_ERR_MISSING_SAMPLE_RATE);
+        ASSERT_EQ(vrt_time_difference_fields_n(&h_, f_.data(), 1, &ref_, -1.0, diff.data()),
+                  VRT_ERR_MISSING_SAMPLE_RATE);
+    }
+}
+
+TEST_F(TimeDifferenceFieldsNTest, BoundsSampleCount) {
+    h_.tsf = VRT_TSF_SAMPLE_COUNT;
+    add(0, 10);
+    add(0, 100);
+    std::vector<vrt_time> diff(2);
+    ASSERT_EQ(vrt_time_difference_fields_n(&h_, f_.data(), 2, &ref_, 100.0, diff.data()), VRT_ERR_BOUNDS_SAMPLE_COUNT);
+    ASSERT_EQ(diff[0].ps, 100000000000);
+}
@@ -232,3 +232,29 @@ TEST_F(WordsIfContextTest, All) {
 
     ASSERT_EQ(vrt_words_if_context(&c_), 108);
 }
+
+TEST_F(WordsIfContextTest, MaxCached) {
+    c_.has.reference_point_identifier     = true;
+    c_.has.bandwidth                      = true;
+    c_.has.if_reference_frequency         = true;
+    c_.has.rf_reference_frequency         = true;
+    c_.has.rf_reference_frequency_offset  = true;
+    c_.has.if_band_offset                 = true;
+    c_.has.reference_level                = true;
+    c_.has.gain                           = true;
+    c_.has.over_range_count               = true;
+    c_.has.sample_rate                    = true;
+    c_.has.timestamp_adjustment           = true;
+    c_.has.timestamp_calibration_time     = true;
+    c_.has.temperature                    = true;
+    c_.has.device_identifier              = true;
+    c_.has.state_and_event_indicators     = true;
+    c_.has.data_packet_payload_format     = true;
+    c_.has.formatted_gps_geolocation      = true;
+    c_.has.formatted_ins_geolocation      = true;
+    c_.has.ecef_ephemeris                 = true;
+    c_.has.relative_ephemeris             = true;
+    c_.has.ephemeris_reference_identifier = true;
+
+    ASSERT_EQ(vrt_words_if_context(&c_), VRT_WORDS_MAX_CACHED_IF_CONTEXT);
+}
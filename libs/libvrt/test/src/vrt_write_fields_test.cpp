@@ -8,9 +8,10 @@
 #include <vrt/vrt_types.h>
 #include <vrt/vrt_write.h>
 
+#include "byte_order.h"
 #include "hex.h"
 
-class WriteFieldsTest : public ::testing::Test {
+class WriteFieldsTest : public ::testing::TestWithParam<ByteOrder> {
    protected:
     void SetUp() override {
         vrt_init_header(&h_);
@@ -18,120 +19,131 @@ class WriteFieldsTest : public ::testing::Test {
         buf_.fill(0xBAADF00D);
     }
 
+    /* Writes in the byte order of the test parameter, buf_ is in host order again afterwards */
+    int32_t write_fields(const vrt_header* header,
+                         const vrt_fields* fields,
+                         void*             buf,
+                         int32_t           words_buf,
+                         bool              validate) {
+        return call_in_order(
+            GetParam(), &buf_, [&] { return vrt_write_fields(header, fields, buf, words_buf, validate); },
+            [&] { return vrt_write_fields_be(header, fields, buf, words_buf, validate); });
+    }
+
     vrt_header              h_{};
     vrt_fields              f_{};
     std::array<uint32_t, 8> buf_{};
 };
 
-TEST_F(WriteFieldsTest, NegativeSizeBuffer) {
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), -1, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), -1, false), VRT_ERR_BUFFER_SIZE);
+TEST_P(WriteFieldsTest, NegativeSizeBuffer) {
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), -1, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), -1, false), VRT_ERR_BUFFER_SIZE);
 }
 
-TEST_F(WriteFieldsTest, None) {
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 0, true), 0);
+TEST_P(WriteFieldsTest, None) {
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 0, true), 0);
 }
 
-TEST_F(WriteFieldsTest, IfDataWithoutStreamId) {
+TEST_P(WriteFieldsTest, IfDataWithoutStreamId) {
     h_.packet_type = VRT_PT_IF_DATA_WITHOUT_STREAM_ID;
     f_.stream_id   = 0xFEDCBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), 0);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 1, true), 0);
 }
 
-TEST_F(WriteFieldsTest, IfDataWithStreamId) {
+TEST_P(WriteFieldsTest, IfDataWithStreamId) {
     h_.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
     f_.stream_id   = 0xFEDCBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), 1);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 1, true), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteFieldsTest, ExtDataWithoutStreamId) {
+TEST_P(WriteFieldsTest, ExtDataWithoutStreamId) {
     h_.packet_type = VRT_PT_EXT_DATA_WITHOUT_STREAM_ID;
     f_.stream_id   = 0xFEDCBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), 0);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 1, true), 0);
 }
 
-TEST_F(WriteFieldsTest, ExtDataWithStreamId) {
+TEST_P(WriteFieldsTest, ExtDataWithStreamId) {
     h_.packet_type = VRT_PT_EXT_DATA_WITH_STREAM_ID;
     f_.stream_id   = 0xFEDCBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), 1);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 1, true), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteFieldsTest, IfContext) {
+TEST_P(WriteFieldsTest, IfContext) {
     h_.packet_type = VRT_PT_IF_CONTEXT;
     f_.stream_id   = 0xFEDCBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), 1);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 1, true), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteFieldsTest, ExtContext) {
+TEST_P(WriteFieldsTest, ExtContext) {
     h_.packet_type = VRT_PT_EXT_CONTEXT;
     f_.stream_id   = 0xFEDCBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), 1);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 1, true), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteFieldsTest, ClassId) {
+TEST_P(WriteFieldsTest, ClassId) {
     h_.has.class_id                    = true;
     f_.class_id.oui                    = 0x00FEDCBA;
     f_.class_id.information_class_code = 0xFEDC;
     f_.class_id.packet_class_code      = 0xBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 1, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00FEDCBA));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteFieldsTest, ClassIdInvalid) {
+TEST_P(WriteFieldsTest, ClassIdInvalid) {
     h_.has.class_id                    = true;
     f_.class_id.oui                    = 0xFFFEDCBA;
     f_.class_id.information_class_code = 0xFEDC;
     f_.class_id.packet_class_code      = 0xBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, true), VRT_ERR_BOUNDS_OUI);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 2, true), VRT_ERR_BOUNDS_OUI);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 2, false), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00FEDCBA));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteFieldsTest, IntegerSecondsTimestamp) {
+TEST_P(WriteFieldsTest, IntegerSecondsTimestamp) {
     h_.tsi                       = VRT_TSI_OTHER;
     f_.integer_seconds_timestamp = 0xFEDCBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), 1);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 1, true), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteFieldsTest, FractionalSecondsTimestamp) {
+TEST_P(WriteFieldsTest, FractionalSecondsTimestamp) {
     h_.tsf                          = VRT_TSF_REAL_TIME;
     f_.fractional_seconds_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x000000E8));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xD4A50FFF));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteFieldsTest, FractionalSecondsTimestampInvalid) {
+TEST_P(WriteFieldsTest, FractionalSecondsTimestampInvalid) {
     h_.tsf                          = VRT_TSF_REAL_TIME;
     f_.fractional_seconds_timestamp = 0x000000E8D4A51000;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 2, true), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 2, false), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x000000E8));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xD4A51000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteFieldsTest, EveryOther1) {
+TEST_P(WriteFieldsTest, EveryOther1) {
     h_.packet_type               = VRT_PT_EXT_DATA_WITH_STREAM_ID;
     h_.has.class_id              = false;
     h_.tsi                       = VRT_TSI_OTHER;
@@ -139,14 +151,14 @@ TEST_F(WriteFieldsTest, EveryOther1) {
     h_.packet_count              = 0xF;
     f_.stream_id                 = 0xDEADBEEF;
     f_.integer_seconds_timestamp = 0xFEDCBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 1, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xDEADBEEF));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteFieldsTest, EveryOther2) {
+TEST_P(WriteFieldsTest, EveryOther2) {
     h_.packet_type                     = VRT_PT_IF_DATA_WITHOUT_STREAM_ID;
     h_.has.class_id                    = true;
     h_.tsi                             = VRT_TSI_NONE;
@@ -156,8 +168,8 @@ TEST_F(WriteFieldsTest, EveryOther2) {
     f_.class_id.information_class_code = 0xFEDC;
     f_.class_id.packet_class_code      = 0xBA98;
     f_.fractional_seconds_timestamp    = 0xFEDCBA987654321F;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 3, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 4, true), 4);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 3, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 4, true), 4);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00FEDCBA));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xFEDCBA98));
@@ -165,7 +177,7 @@ TEST_F(WriteFieldsTest, EveryOther2) {
     ASSERT_EQ(Hex(buf_[4]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteFieldsTest, All) {
+TEST_P(WriteFieldsTest, All) {
     h_.packet_type                     = VRT_PT_EXT_DATA_WITH_STREAM_ID;
     h_.has.class_id                    = true;
     h_.tsi                             = VRT_TSI_OTHER;
@@ -177,8 +189,8 @@ TEST_F(WriteFieldsTest, All) {
     f_.class_id.packet_class_code      = 0xBA98;
     f_.integer_seconds_timestamp       = 0xFEDCBA98;
     f_.fractional_seconds_timestamp    = 0xFEDCBA987654321F;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 5, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 6, true), 6);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 5, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_fields(&h_, &f_, buf_.data(), 6, true), 6);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xDEADBEEF));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FEDCBA));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xFEDCBA98));
@@ -187,3 +199,8 @@ TEST_F(WriteFieldsTest, All) {
     ASSERT_EQ(Hex(buf_[5]), Hex(0x7654321F));
     ASSERT_EQ(Hex(buf_[6]), Hex(0xBAADF00D));
 }
+
+INSTANTIATE_TEST_SUITE_P(ByteOrders,
+                         WriteFieldsTest,
+                         ::testing::Values(ByteOrder::HOST, ByteOrder::NETWORK),
+                         byte_order_name);
@@ -10,15 +10,23 @@
 #include <vrt/vrt_types.h>
 #include <vrt/vrt_write.h>
 
+#include "byte_order.h"
 #include "hex.h"
 
-class WriteIfContextTest : public ::testing::Test {
+class WriteIfContextTest : public ::testing::TestWithParam<ByteOrder> {
    protected:
     void SetUp() override {
         vrt_init_if_context(&c_);
         buf_.fill(0xBAADF00D);
     }
 
+    /* Writes in the byte order of the test parameter, buf_ is in host order again afterwards */
+    int32_t write_if_context(const vrt_if_context* if_context, void* buf, int32_t words_buf, bool validate) {
+        return call_in_order(
+            GetParam(), &buf_, [&] { return vrt_write_if_context(if_context, buf, words_buf, validate); },
+            [&] { return vrt_write_if_context_be(if_context, buf, words_buf, validate); });
+    }
+
     vrt_if_context             c_{};
     std::array<uint32_t, 1024> buf_{};
 };
@@ -79,73 +87,73 @@ static void buf_cmp_geolocation_ephemeris(const std::array<uint32_t, 1024>& buf,
     ASSERT_EQ(Hex(buf[use11 ? 12 : 14]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, NegativeSizeBuffer) {
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), -1, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), -1, false), VRT_ERR_BUFFER_SIZE);
+TEST_P(WriteIfContextTest, NegativeSizeBuffer) {
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), -1, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), -1, false), VRT_ERR_BUFFER_SIZE);
 }
 
-TEST_F(WriteIfContextTest, ZeroSizeBuffer) {
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0, false), VRT_ERR_BUFFER_SIZE);
+TEST_P(WriteIfContextTest, ZeroSizeBuffer) {
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 0, false), VRT_ERR_BUFFER_SIZE);
 }
 
-TEST_F(WriteIfContextTest, None) {
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 1, true), 1);
+TEST_P(WriteIfContextTest, None) {
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 1, true), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, ContextFieldChange) {
+TEST_P(WriteIfContextTest, ContextFieldChange) {
     c_.context_field_change_indicator = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 1, true), 1);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 1, true), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x80000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, ReferencePointIdentifier) {
+TEST_P(WriteIfContextTest, ReferencePointIdentifier) {
     c_.has.reference_point_identifier = true;
     c_.reference_point_identifier     = 0xFEFEFEFE;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x40000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFEFEFEFE));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, Bandwidth) {
+TEST_P(WriteIfContextTest, Bandwidth) {
     c_.has.bandwidth = true;
     c_.bandwidth     = 4097.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x20000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000001));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00100000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, BandwidthSmall) {
+TEST_P(WriteIfContextTest, BandwidthSmall) {
     c_.has.bandwidth = true;
     c_.bandwidth     = 0.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x20000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, BandwidthLarge) {
+TEST_P(WriteIfContextTest, BandwidthLarge) {
     c_.has.bandwidth = true;
     c_.bandwidth     = 8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x20000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x7FE94D3D));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xC0000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, BandwidthInvalidSmall) {
+TEST_P(WriteIfContextTest, BandwidthInvalidSmall) {
     c_.has.bandwidth = true;
     c_.bandwidth     = -1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_BANDWIDTH);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_BANDWIDTH);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x20000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFFFFFFFF));
     /* Due to low precision of double when converting to fixed point, don't do the comparison below */
@@ -153,357 +161,357 @@ TEST_F(WriteIfContextTest, BandwidthInvalidSmall) {
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, BandwidthInvalidLarge) {
+TEST_P(WriteIfContextTest, BandwidthInvalidLarge) {
     c_.has.bandwidth = true;
     c_.bandwidth     = 8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_BANDWIDTH);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_BANDWIDTH);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
 }
 
-TEST_F(WriteIfContextTest, IfReferenceFrequency) {
+TEST_P(WriteIfContextTest, IfReferenceFrequency) {
     c_.has.if_reference_frequency = true;
     c_.if_reference_frequency     = 4097.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x10000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000001));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00100000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, IfReferenceFrequencySmall) {
+TEST_P(WriteIfContextTest, IfReferenceFrequencySmall) {
     c_.has.if_reference_frequency = true;
     c_.if_reference_frequency     = -8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x10000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x8016B2C2));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x40000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, IfReferenceFrequencyLarge) {
+TEST_P(WriteIfContextTest, IfReferenceFrequencyLarge) {
     c_.has.if_reference_frequency = true;
     c_.if_reference_frequency     = 8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x10000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x7FE94D3D));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xC0000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, IfReferenceFrequencyInvalidSmall) {
+TEST_P(WriteIfContextTest, IfReferenceFrequencyInvalidSmall) {
     c_.has.if_reference_frequency = true;
     c_.if_reference_frequency     = -8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_IF_REFERENCE_FREQUENCY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_IF_REFERENCE_FREQUENCY);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
 }
 
-TEST_F(WriteIfContextTest, IfReferenceFrequencyInvalidLarge) {
+TEST_P(WriteIfContextTest, IfReferenceFrequencyInvalidLarge) {
     c_.has.if_reference_frequency = true;
     c_.if_reference_frequency     = 8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_IF_REFERENCE_FREQUENCY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_IF_REFERENCE_FREQUENCY);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
 }
 
-TEST_F(WriteIfContextTest, RfReferenceFrequency) {
+TEST_P(WriteIfContextTest, RfReferenceFrequency) {
     c_.has.rf_reference_frequency = true;
     c_.rf_reference_frequency     = 4097.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x08000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000001));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00100000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, RfReferenceFrequencySmall) {
+TEST_P(WriteIfContextTest, RfReferenceFrequencySmall) {
     c_.has.rf_reference_frequency = true;
     c_.rf_reference_frequency     = -8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x08000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x8016B2C2));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x40000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, RfReferenceFrequencyLarge) {
+TEST_P(WriteIfContextTest, RfReferenceFrequencyLarge) {
     c_.has.rf_reference_frequency = true;
     c_.rf_reference_frequency     = 8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x08000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x7FE94D3D));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xC0000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, RfReferenceFrequencyInvalidSmall) {
+TEST_P(WriteIfContextTest, RfReferenceFrequencyInvalidSmall) {
     c_.has.rf_reference_frequency = true;
     c_.rf_reference_frequency     = -8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
 }
 
-TEST_F(WriteIfContextTest, RfReferenceFrequencyInvalidLarge) {
+TEST_P(WriteIfContextTest, RfReferenceFrequencyInvalidLarge) {
     c_.has.rf_reference_frequency = true;
     c_.rf_reference_frequency     = 8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
 }
 
-TEST_F(WriteIfContextTest, RfReferenceFrequencyOffset) {
+TEST_P(WriteIfContextTest, RfReferenceFrequencyOffset) {
     c_.has.rf_reference_frequency_offset = true;
     c_.rf_reference_frequency_offset     = 4097.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x04000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000001));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00100000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, RfReferenceFrequencyOffsetSmall) {
+TEST_P(WriteIfContextTest, RfReferenceFrequencyOffsetSmall) {
     c_.has.rf_reference_frequency_offset = true;
     c_.rf_reference_frequency_offset     = -8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x04000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x8016B2C2));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x40000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, RfReferenceFrequencyOffsetLarge) {
+TEST_P(WriteIfContextTest, RfReferenceFrequencyOffsetLarge) {
     c_.has.rf_reference_frequency_offset = true;
     c_.rf_reference_frequency_offset     = 8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x04000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x7FE94D3D));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xC0000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, RfReferenceFrequencyOffsetInvalidSmall) {
+TEST_P(WriteIfContextTest, RfReferenceFrequencyOffsetInvalidSmall) {
     c_.has.rf_reference_frequency_offset = true;
     c_.rf_reference_frequency_offset     = -8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY_OFFSET);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY_OFFSET);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
 }
 
-TEST_F(WriteIfContextTest, RfReferenceFrequencyOffsetInvalidLarge) {
+TEST_P(WriteIfContextTest, RfReferenceFrequencyOffsetInvalidLarge) {
     c_.has.rf_reference_frequency_offset = true;
     c_.rf_reference_frequency_offset     = 8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY_OFFSET);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY_OFFSET);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
 }
 
-TEST_F(WriteIfContextTest, IfBandOffset) {
+TEST_P(WriteIfContextTest, IfBandOffset) {
     c_.has.if_band_offset = true;
     c_.if_band_offset     = 4097.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x02000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000001));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00100000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, IfBandOffsetSmall) {
+TEST_P(WriteIfContextTest, IfBandOffsetSmall) {
     c_.has.if_band_offset = true;
     c_.if_band_offset     = -8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x02000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x8016B2C2));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x40000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, IfBandOffsetLarge) {
+TEST_P(WriteIfContextTest, IfBandOffsetLarge) {
     c_.has.if_band_offset = true;
     c_.if_band_offset     = 8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x02000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x7FE94D3D));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xC0000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, IfBandOffsetInvalidSmall) {
+TEST_P(WriteIfContextTest, IfBandOffsetInvalidSmall) {
     c_.has.if_band_offset = true;
     c_.if_band_offset     = -8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_IF_BAND_OFFSET);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_IF_BAND_OFFSET);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
 }
 
-TEST_F(WriteIfContextTest, IfBandOffsetInvalidLarge) {
+TEST_P(WriteIfContextTest, IfBandOffsetInvalidLarge) {
     c_.has.if_band_offset = true;
     c_.if_band_offset     = 8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_IF_BAND_OFFSET);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_IF_BAND_OFFSET);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
 }
 
-TEST_F(WriteIfContextTest, ReferenceLevel) {
+TEST_P(WriteIfContextTest, ReferenceLevel) {
     c_.has.reference_level = true;
     c_.reference_level     = -1.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x01000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0000FF80));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, ReferenceLevelSmall) {
+TEST_P(WriteIfContextTest, ReferenceLevelSmall) {
     c_.has.reference_level = true;
     c_.reference_level     = -256.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x01000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, ReferenceLevelLarge) {
+TEST_P(WriteIfContextTest, ReferenceLevelLarge) {
     c_.has.reference_level = true;
     c_.reference_level     = 255.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x01000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00007F80));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, ReferenceLevelInvalidSmall) {
+TEST_P(WriteIfContextTest, ReferenceLevelInvalidSmall) {
     c_.has.reference_level = true;
     c_.reference_level     = -257.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_REFERENCE_LEVEL);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_REFERENCE_LEVEL);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, false), 2);
 }
 
-TEST_F(WriteIfContextTest, ReferenceLevelInvalidLarge) {
+TEST_P(WriteIfContextTest, ReferenceLevelInvalidLarge) {
     c_.has.reference_level = true;
     c_.reference_level     = 256.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_REFERENCE_LEVEL);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_REFERENCE_LEVEL);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, false), 2);
 }
 
-TEST_F(WriteIfContextTest, Gain1) {
+TEST_P(WriteIfContextTest, Gain1) {
     c_.has.gain    = true;
     c_.gain.stage1 = -1.0F;
     c_.gain.stage2 = 1.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00800000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0080FF80));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, Gain2) {
+TEST_P(WriteIfContextTest, Gain2) {
     c_.has.gain    = true;
     c_.gain.stage1 = -1.0F;
     c_.gain.stage2 = 0.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00800000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0000FF80));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, GainSmall) {
+TEST_P(WriteIfContextTest, GainSmall) {
     c_.has.gain    = true;
     c_.gain.stage1 = -256.0F;
     c_.gain.stage2 = -256.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00800000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x80008000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, GainLarge) {
+TEST_P(WriteIfContextTest, GainLarge) {
     c_.has.gain    = true;
     c_.gain.stage1 = 255.0F;
     c_.gain.stage2 = 255.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00800000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x7F807F80));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, GainStage1InvalidSmall) {
+TEST_P(WriteIfContextTest, GainStage1InvalidSmall) {
     c_.has.gain    = true;
     c_.gain.stage1 = -257.0F;
     c_.gain.stage2 = 1.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_GAIN);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_GAIN);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, false), 2);
 }
 
-TEST_F(WriteIfContextTest, GainStage2InvalidSmall) {
+TEST_P(WriteIfContextTest, GainStage2InvalidSmall) {
     c_.has.gain    = true;
     c_.gain.stage1 = 1.0F;
     c_.gain.stage2 = -257.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_GAIN);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_GAIN);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, false), 2);
 }
 
-TEST_F(WriteIfContextTest, GainStage1InvalidLarge) {
+TEST_P(WriteIfContextTest, GainStage1InvalidLarge) {
     c_.has.gain    = true;
     c_.gain.stage1 = 256.0F;
     c_.gain.stage2 = 1.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_GAIN);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_GAIN);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, false), 2);
 }
 
-TEST_F(WriteIfContextTest, GainStage2InvalidLarge) {
+TEST_P(WriteIfContextTest, GainStage2InvalidLarge) {
     c_.has.gain    = true;
     c_.gain.stage1 = 1.0F;
     c_.gain.stage2 = 256.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_GAIN);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_GAIN);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, false), 2);
 }
 
-TEST_F(WriteIfContextTest, GainInvalidStage2Set) {
+TEST_P(WriteIfContextTest, GainInvalidStage2Set) {
     c_.has.gain    = true;
     c_.gain.stage1 = 0.0F;
     c_.gain.stage2 = 1.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_GAIN_STAGE2_SET);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_GAIN_STAGE2_SET);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, false), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00800000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00800000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, OverRangeCount) {
+TEST_P(WriteIfContextTest, OverRangeCount) {
     c_.has.over_range_count = true;
     c_.over_range_count     = 0xFEFEFEFE;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00400000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFEFEFEFE));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, SampleRate) {
+TEST_P(WriteIfContextTest, SampleRate) {
     c_.has.sample_rate = true;
     c_.sample_rate     = 4097.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00200000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000001));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00100000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, SampleRateSmall) {
+TEST_P(WriteIfContextTest, SampleRateSmall) {
     c_.has.sample_rate = true;
     c_.sample_rate     = 0.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00200000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, SampleRateLarge) {
+TEST_P(WriteIfContextTest, SampleRateLarge) {
     c_.has.sample_rate = true;
     c_.sample_rate     = 8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00200000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x7FE94D3D));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xC0000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, SampleRateInvalidSmall) {
+TEST_P(WriteIfContextTest, SampleRateInvalidSmall) {
     c_.has.sample_rate = true;
     c_.sample_rate     = -1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_SAMPLE_RATE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_SAMPLE_RATE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00200000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFFFFFFFF));
     /* Due to low precision of double when converting to fixed point, don't do the comparison below */
@@ -511,661 +519,661 @@ TEST_F(WriteIfContextTest, SampleRateInvalidSmall) {
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, SampleRateInvalidLarge) {
+TEST_P(WriteIfContextTest, SampleRateInvalidLarge) {
     c_.has.sample_rate = true;
     c_.sample_rate     = 8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_SAMPLE_RATE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_SAMPLE_RATE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
 }
 
-TEST_F(WriteIfContextTest, TimestampAdjustment) {
+TEST_P(WriteIfContextTest, TimestampAdjustment) {
     c_.has.timestamp_adjustment = true;
     c_.timestamp_adjustment     = 0xABABABABBEBEBEBE;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00100000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBEBEBEBE));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, TimestampCalibrationTime) {
+TEST_P(WriteIfContextTest, TimestampCalibrationTime) {
     c_.has.timestamp_calibration_time = true;
     c_.timestamp_calibration_time     = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00080000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, Temperature) {
+TEST_P(WriteIfContextTest, Temperature) {
     c_.has.temperature = true;
     c_.temperature     = -1.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00040000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0000FFC0));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, TemperatureSmall) {
+TEST_P(WriteIfContextTest, TemperatureSmall) {
     c_.has.temperature = true;
     c_.temperature     = -273.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00040000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0000BBC0));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, TemperatureLarge) {
+TEST_P(WriteIfContextTest, TemperatureLarge) {
     c_.has.temperature = true;
     c_.temperature     = 511.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00040000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00007FC0));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, TemperatureInvalidSmall) {
+TEST_P(WriteIfContextTest, TemperatureInvalidSmall) {
     c_.has.temperature = true;
     c_.temperature     = -274.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_TEMPERATURE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_TEMPERATURE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, false), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00040000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0000BB80));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, TemperatureInvalidLarge) {
+TEST_P(WriteIfContextTest, TemperatureInvalidLarge) {
     c_.has.temperature = true;
     c_.temperature     = 512.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_TEMPERATURE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_TEMPERATURE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, false), 2);
 }
 
-TEST_F(WriteIfContextTest, DeviceIdentifierOui) {
+TEST_P(WriteIfContextTest, DeviceIdentifierOui) {
     c_.has.device_identifier = true;
     c_.device_identifier.oui = 0x00FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00020000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FFFFFF));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DeviceIdentifierOuiInvalid) {
+TEST_P(WriteIfContextTest, DeviceIdentifierOuiInvalid) {
     c_.has.device_identifier         = true;
     c_.device_identifier.oui         = 0x01FFFFFF;
     c_.device_identifier.device_code = 0xABAF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_OUI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_OUI);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00020000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FFFFFF));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x0000ABAF));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DeviceIdentifierDeviceCode) {
+TEST_P(WriteIfContextTest, DeviceIdentifierDeviceCode) {
     c_.has.device_identifier         = true;
     c_.device_identifier.device_code = 0xABAF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00020000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x0000ABAF));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasCalibratedTime) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsHasCalibratedTime) {
     c_.has.state_and_event_indicators                 = true;
     c_.state_and_event_indicators.has.calibrated_time = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x80000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasValidData) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsHasValidData) {
     c_.has.state_and_event_indicators            = true;
     c_.state_and_event_indicators.has.valid_data = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x40000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasReferenceLock) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsHasReferenceLock) {
     c_.has.state_and_event_indicators                = true;
     c_.state_and_event_indicators.has.reference_lock = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x20000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasAgcOrMgc) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsHasAgcOrMgc) {
     c_.has.state_and_event_indicators            = true;
     c_.state_and_event_indicators.has.agc_or_mgc = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x10000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasDetectedSignal) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsHasDetectedSignal) {
     c_.has.state_and_event_indicators                 = true;
     c_.state_and_event_indicators.has.detected_signal = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x08000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasSpectralInversion) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsHasSpectralInversion) {
     c_.has.state_and_event_indicators                    = true;
     c_.state_and_event_indicators.has.spectral_inversion = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x04000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasOverRange) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsHasOverRange) {
     c_.has.state_and_event_indicators            = true;
     c_.state_and_event_indicators.has.over_range = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x02000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasSampleLoss) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsHasSampleLoss) {
     c_.has.state_and_event_indicators             = true;
     c_.state_and_event_indicators.has.sample_loss = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x01000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsCalibratedTime) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsCalibratedTime) {
     c_.has.state_and_event_indicators             = true;
     c_.state_and_event_indicators.calibrated_time = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsValidData) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsValidData) {
     c_.has.state_and_event_indicators        = true;
     c_.state_and_event_indicators.valid_data = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsReferenceLock) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsReferenceLock) {
     c_.has.state_and_event_indicators            = true;
     c_.state_and_event_indicators.reference_lock = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsAgcOrMgc) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsAgcOrMgc) {
     c_.has.state_and_event_indicators        = true;
     c_.state_and_event_indicators.agc_or_mgc = VRT_AOM_AGC;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsDetectedSignal) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsDetectedSignal) {
     c_.has.state_and_event_indicators             = true;
     c_.state_and_event_indicators.detected_signal = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsSpectralInversion) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsSpectralInversion) {
     c_.has.state_and_event_indicators                = true;
     c_.state_and_event_indicators.spectral_inversion = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsOverRange) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsOverRange) {
     c_.has.state_and_event_indicators        = true;
     c_.state_and_event_indicators.over_range = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsSampleLoss) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsSampleLoss) {
     c_.has.state_and_event_indicators         = true;
     c_.state_and_event_indicators.sample_loss = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothCalibratedTime) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsBothCalibratedTime) {
     c_.has.state_and_event_indicators                 = true;
     c_.state_and_event_indicators.has.calibrated_time = true;
     c_.state_and_event_indicators.calibrated_time     = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x80080000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothValidData) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsBothValidData) {
     c_.has.state_and_event_indicators            = true;
     c_.state_and_event_indicators.has.valid_data = true;
     c_.state_and_event_indicators.valid_data     = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x40040000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothReferenceLock) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsBothReferenceLock) {
     c_.has.state_and_event_indicators                = true;
     c_.state_and_event_indicators.has.reference_lock = true;
     c_.state_and_event_indicators.reference_lock     = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x20020000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothAgcOrMgc) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsBothAgcOrMgc) {
     c_.has.state_and_event_indicators            = true;
     c_.state_and_event_indicators.has.agc_or_mgc = true;
     c_.state_and_event_indicators.agc_or_mgc     = VRT_AOM_AGC;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x10010000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothDetectedSignal) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsBothDetectedSignal) {
     c_.has.state_and_event_indicators                 = true;
     c_.state_and_event_indicators.has.detected_signal = true;
     c_.state_and_event_indicators.detected_signal     = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x08008000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothSpectralInversion) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsBothSpectralInversion) {
     c_.has.state_and_event_indicators                    = true;
     c_.state_and_event_indicators.has.spectral_inversion = true;
     c_.state_and_event_indicators.spectral_inversion     = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x04004000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothOverRange) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsBothOverRange) {
     c_.has.state_and_event_indicators            = true;
     c_.state_and_event_indicators.has.over_range = true;
     c_.state_and_event_indicators.over_range     = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x02002000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothSampleLoss) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsBothSampleLoss) {
     c_.has.state_and_event_indicators             = true;
     c_.state_and_event_indicators.has.sample_loss = true;
     c_.state_and_event_indicators.sample_loss     = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x01001000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothUserDefined) {
+TEST_P(WriteIfContextTest, StateAndEventIndicatorsBothUserDefined) {
     c_.has.state_and_event_indicators          = true;
     c_.state_and_event_indicators.user_defined = 0xFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x000000FF));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatPackingMethod) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatPackingMethod) {
     c_.has.data_packet_payload_format            = true;
     c_.data_packet_payload_format.packing_method = VRT_PM_LINK_EFFICIENT;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x80000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatPackingMethodInvalidSmall) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatPackingMethodInvalidSmall) {
     c_.has.data_packet_payload_format            = true;
     c_.data_packet_payload_format.packing_method = static_cast<vrt_packing_method>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_PACKING_METHOD);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_PACKING_METHOD);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x80000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatPackingMethodInvalidLarge) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatPackingMethodInvalidLarge) {
     c_.has.data_packet_payload_format            = true;
     c_.data_packet_payload_format.packing_method = static_cast<vrt_packing_method>(2);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_PACKING_METHOD);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_PACKING_METHOD);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatRealOrComplex) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatRealOrComplex) {
     c_.has.data_packet_payload_format             = true;
     c_.data_packet_payload_format.real_or_complex = VRT_ROC_COMPLEX_POLAR;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x40000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatRealOrComplexInvalidSmall) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatRealOrComplexInvalidSmall) {
     c_.has.data_packet_payload_format             = true;
     c_.data_packet_payload_format.real_or_complex = static_cast<vrt_real_complex>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_REAL_OR_COMPLEX);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_REAL_OR_COMPLEX);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x60000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatRealOrComplexInvalidLarge) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatRealOrComplexInvalidLarge) {
     c_.has.data_packet_payload_format             = true;
     c_.data_packet_payload_format.real_or_complex = static_cast<vrt_real_complex>(3);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_REAL_OR_COMPLEX);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_REAL_OR_COMPLEX);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x60000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemFormat) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatDataItemFormat) {
     c_.has.data_packet_payload_format              = true;
     c_.data_packet_payload_format.data_item_format = VRT_DIF_UNSIGNED_VRT_6_BIT_EXPONENT;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x16000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid1) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid1) {
     c_.has.data_packet_payload_format              = true;
     c_.data_packet_payload_format.data_item_format = static_cast<vrt_data_item_format>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x1F000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid2) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid2) {
     c_.has.data_packet_payload_format              = true;
     c_.data_packet_payload_format.data_item_format = static_cast<vrt_data_item_format>(0x07);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x07000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid3) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid3) {
     c_.has.data_packet_payload_format              = true;
     c_.data_packet_payload_format.data_item_format = static_cast<vrt_data_item_format>(0x0D);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0D000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid4) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid4) {
     c_.has.data_packet_payload_format              = true;
     c_.data_packet_payload_format.data_item_format = static_cast<vrt_data_item_format>(0x17);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x17000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatSampleComponentRepeat) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatSampleComponentRepeat) {
     c_.has.data_packet_payload_format                     = true;
     c_.data_packet_payload_format.sample_component_repeat = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00800000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatEventTagSize) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatEventTagSize) {
     c_.has.data_packet_payload_format            = true;
     c_.data_packet_payload_format.event_tag_size = 0x07;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00700000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatEventTagSizeInvalid) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatEventTagSizeInvalid) {
     c_.has.data_packet_payload_format            = true;
     c_.data_packet_payload_format.event_tag_size = 0x08;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_EVENT_TAG_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_EVENT_TAG_SIZE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatChannelTagSize) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatChannelTagSize) {
     c_.has.data_packet_payload_format              = true;
     c_.data_packet_payload_format.channel_tag_size = 0x0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x000F0000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatChannelTagSizeInvalid) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatChannelTagSizeInvalid) {
     c_.has.data_packet_payload_format              = true;
     c_.data_packet_payload_format.channel_tag_size = 0x10;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_CHANNEL_TAG_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_CHANNEL_TAG_SIZE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatItemPackingFieldSize) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatItemPackingFieldSize) {
     c_.has.data_packet_payload_format                     = true;
     c_.data_packet_payload_format.item_packing_field_size = 0x3F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000FC0));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatItemPackingFieldSizeInvalid) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatItemPackingFieldSizeInvalid) {
     c_.has.data_packet_payload_format                     = true;
     c_.data_packet_payload_format.item_packing_field_size = 0x40;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_ITEM_PACKING_FIELD_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_ITEM_PACKING_FIELD_SIZE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemSize) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatDataItemSize) {
     c_.has.data_packet_payload_format            = true;
     c_.data_packet_payload_format.data_item_size = 0x3F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0000003F));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemSizeInvalid) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatDataItemSizeInvalid) {
     c_.has.data_packet_payload_format            = true;
     c_.data_packet_payload_format.data_item_size = 0x40;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_DATA_ITEM_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_DATA_ITEM_SIZE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatRepeatCount) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatRepeatCount) {
     c_.has.data_packet_payload_format          = true;
     c_.data_packet_payload_format.repeat_count = 0xFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xFFFF0000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, DataPacketPayloadFormatVectorSize) {
+TEST_P(WriteIfContextTest, DataPacketPayloadFormatVectorSize) {
     c_.has.data_packet_payload_format         = true;
     c_.data_packet_payload_format.vector_size = 0xFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x0000FFFF));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsi) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationTsi) {
     c_.has.formatted_gps_geolocation = true;
     c_.formatted_gps_geolocation.tsi = VRT_TSI_OTHER;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0C000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsiInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationTsiInvalidSmall) {
     c_.has.formatted_gps_geolocation = true;
     c_.formatted_gps_geolocation.tsi = static_cast<vrt_tsi>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSI);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0C000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsiInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationTsiInvalidLarge) {
     c_.has.formatted_gps_geolocation = true;
     c_.formatted_gps_geolocation.tsi = static_cast<vrt_tsi>(4);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSI);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsf) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationTsf) {
     c_.has.formatted_gps_geolocation = true;
     c_.formatted_gps_geolocation.tsf = VRT_TSF_FREE_RUNNING_COUNT;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x03000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsfInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationTsfInvalidSmall) {
     c_.has.formatted_gps_geolocation = true;
     c_.formatted_gps_geolocation.tsf = static_cast<vrt_tsf>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSF);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSF);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x03000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsfInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationTsfInvalidLarge) {
     c_.has.formatted_gps_geolocation = true;
     c_.formatted_gps_geolocation.tsf = static_cast<vrt_tsf>(4);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSF);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSF);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationOui) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationOui) {
     c_.has.formatted_gps_geolocation = true;
     c_.formatted_gps_geolocation.oui = 0x00FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FFFFFF));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationOuiInvalid) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationOuiInvalid) {
     c_.has.formatted_gps_geolocation = true;
     c_.formatted_gps_geolocation.oui = 0x01FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_OUI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_OUI);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FFFFFF));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationIntegerSecondTimestamp) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationIntegerSecondTimestamp) {
     c_.has.formatted_gps_geolocation                      = true;
     c_.formatted_gps_geolocation.tsi                      = VRT_TSI_UTC;
     c_.formatted_gps_geolocation.integer_second_timestamp = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {{1, 2}}, true);
@@ -1173,23 +1181,23 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationIntegerSecondTimestamp) {
     ASSERT_EQ(Hex(buf_[2]), Hex(0xABABABAB));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationIntegerSecondTimestampInvalid) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationIntegerSecondTimestampInvalid) {
     c_.has.formatted_gps_geolocation                      = true;
     c_.formatted_gps_geolocation.tsi                      = VRT_TSI_UNDEFINED;
     c_.formatted_gps_geolocation.integer_second_timestamp = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {2}, true);
     ASSERT_EQ(Hex(buf_[2]), Hex(0xABABABAB));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationFractionalSecondTimestamp) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationFractionalSecondTimestamp) {
     c_.has.formatted_gps_geolocation                         = true;
     c_.formatted_gps_geolocation.tsf                         = VRT_TSF_REAL_TIME;
     c_.formatted_gps_geolocation.fractional_second_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {{1, 3, 4}}, true);
@@ -1198,12 +1206,12 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationFractionalSecondTimestamp) {
     ASSERT_EQ(Hex(buf_[4]), Hex(0xD4A50FFF));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInvalid1) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInvalid1) {
     c_.has.formatted_gps_geolocation                         = true;
     c_.formatted_gps_geolocation.tsf                         = VRT_TSF_UNDEFINED;
     c_.formatted_gps_geolocation.fractional_second_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {{3, 4}}, true);
@@ -1211,12 +1219,12 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInval
     ASSERT_EQ(Hex(buf_[4]), Hex(0xD4A50FFF));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInvalid2) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInvalid2) {
     c_.has.formatted_gps_geolocation                         = true;
     c_.formatted_gps_geolocation.tsf                         = VRT_TSF_REAL_TIME;
     c_.formatted_gps_geolocation.fractional_second_timestamp = 0x000000E8D4A51000;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {{1, 3, 4}}, true);
@@ -1225,544 +1233,544 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInval
     ASSERT_EQ(Hex(buf_[4]), Hex(0xD4A51000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationLatitude) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationLatitude) {
     c_.has.formatted_gps_geolocation      = true;
     c_.formatted_gps_geolocation.latitude = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationLongitude) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationLongitude) {
     c_.has.formatted_gps_geolocation       = true;
     c_.formatted_gps_geolocation.longitude = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationAltitude) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationAltitude) {
     c_.has.formatted_gps_geolocation      = true;
     c_.formatted_gps_geolocation.altitude = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationSpeedOverGround) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationSpeedOverGround) {
     c_.has.formatted_gps_geolocation               = true;
     c_.formatted_gps_geolocation.speed_over_ground = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationHeadingAngle) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationHeadingAngle) {
     c_.has.formatted_gps_geolocation           = true;
     c_.formatted_gps_geolocation.heading_angle = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationTrackAngle) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationTrackAngle) {
     c_.has.formatted_gps_geolocation         = true;
     c_.formatted_gps_geolocation.track_angle = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationMagneticVariation) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationMagneticVariation) {
     c_.has.formatted_gps_geolocation                = true;
     c_.formatted_gps_geolocation.magnetic_variation = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLatitude) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothLatitude) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.latitude = true;
     c_.formatted_gps_geolocation.latitude     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
     ASSERT_EQ(Hex(buf_[5]), Hex(0x00400000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLatitudeSmall) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothLatitudeSmall) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.latitude = true;
     c_.formatted_gps_geolocation.latitude     = -90.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
     ASSERT_EQ(Hex(buf_[5]), Hex(0xE9800000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLatitudeLarge) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothLatitudeLarge) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.latitude = true;
     c_.formatted_gps_geolocation.latitude     = 90.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
     ASSERT_EQ(Hex(buf_[5]), Hex(0x16800000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLatitudeInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothLatitudeInvalidSmall) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.latitude = true;
     c_.formatted_gps_geolocation.latitude     = -91.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LATITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LATITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
     ASSERT_EQ(Hex(buf_[5]), Hex(0xE9400000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLatitudeInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothLatitudeInvalidLarge) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.latitude = true;
     c_.formatted_gps_geolocation.latitude     = 91.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LATITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LATITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
     ASSERT_EQ(Hex(buf_[5]), Hex(0x16C00000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLongitude) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothLongitude) {
     c_.has.formatted_gps_geolocation           = true;
     c_.formatted_gps_geolocation.has.longitude = true;
     c_.formatted_gps_geolocation.longitude     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
     ASSERT_EQ(Hex(buf_[6]), Hex(0x00400000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLongitudeSmall) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothLongitudeSmall) {
     c_.has.formatted_gps_geolocation           = true;
     c_.formatted_gps_geolocation.has.longitude = true;
     c_.formatted_gps_geolocation.longitude     = -180.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
     ASSERT_EQ(Hex(buf_[6]), Hex(0xD3000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLongitudeLarge) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothLongitudeLarge) {
     c_.has.formatted_gps_geolocation           = true;
     c_.formatted_gps_geolocation.has.longitude = true;
     c_.formatted_gps_geolocation.longitude     = 180.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
     ASSERT_EQ(Hex(buf_[6]), Hex(0x2D000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLongitudeInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothLongitudeInvalidSmall) {
     c_.has.formatted_gps_geolocation           = true;
     c_.formatted_gps_geolocation.has.longitude = true;
     c_.formatted_gps_geolocation.longitude     = -181.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LONGITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LONGITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
     ASSERT_EQ(Hex(buf_[6]), Hex(0xD2C00000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLongitudeInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothLongitudeInvalidLarge) {
     c_.has.formatted_gps_geolocation           = true;
     c_.formatted_gps_geolocation.has.longitude = true;
     c_.formatted_gps_geolocation.longitude     = 181.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LONGITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LONGITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
     ASSERT_EQ(Hex(buf_[6]), Hex(0x2D400000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothAltitude) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothAltitude) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.altitude = true;
     c_.formatted_gps_geolocation.altitude     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, true);
     ASSERT_EQ(Hex(buf_[7]), Hex(0x00000020));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothAltitudeSmall) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothAltitudeSmall) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.altitude = true;
     c_.formatted_gps_geolocation.altitude     = -67108e3;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, true);
     ASSERT_EQ(Hex(buf_[7]), Hex(0x80006C00));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothAltitudeLarge) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothAltitudeLarge) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.altitude = true;
     c_.formatted_gps_geolocation.altitude     = 67108e3;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, true);
     ASSERT_EQ(Hex(buf_[7]), Hex(0x7FFF9400));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothAltitudeInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothAltitudeInvalidSmall) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.altitude = true;
     c_.formatted_gps_geolocation.altitude     = -67109e3;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_ALTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_ALTITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothAltitudeInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothAltitudeInvalidLarge) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.altitude = true;
     c_.formatted_gps_geolocation.altitude     = 67109e3;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_ALTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_ALTITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothSpeedOverGround) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothSpeedOverGround) {
     c_.has.formatted_gps_geolocation                   = true;
     c_.formatted_gps_geolocation.has.speed_over_ground = true;
     c_.formatted_gps_geolocation.speed_over_ground     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, true);
     ASSERT_EQ(Hex(buf_[8]), Hex(0x00010000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothSpeedOverGroundSmall) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothSpeedOverGroundSmall) {
     c_.has.formatted_gps_geolocation                   = true;
     c_.formatted_gps_geolocation.has.speed_over_ground = true;
     c_.formatted_gps_geolocation.speed_over_ground     = 0.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, true);
     ASSERT_EQ(Hex(buf_[8]), Hex(0x00000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothSpeedOverGroundLarge) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothSpeedOverGroundLarge) {
     c_.has.formatted_gps_geolocation                   = true;
     c_.formatted_gps_geolocation.has.speed_over_ground = true;
     c_.formatted_gps_geolocation.speed_over_ground     = 65535.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, true);
     ASSERT_EQ(Hex(buf_[8]), Hex(0xFFFF0000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothSpeedOverGroundInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothSpeedOverGroundInvalidSmall) {
     c_.has.formatted_gps_geolocation                   = true;
     c_.formatted_gps_geolocation.has.speed_over_ground = true;
     c_.formatted_gps_geolocation.speed_over_ground     = -1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_SPEED_OVER_GROUND);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_SPEED_OVER_GROUND);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, true);
     ASSERT_EQ(Hex(buf_[8]), Hex(0xFFFF0000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothSpeedOverGroundInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothSpeedOverGroundInvalidLarge) {
     c_.has.formatted_gps_geolocation                   = true;
     c_.formatted_gps_geolocation.has.speed_over_ground = true;
     c_.formatted_gps_geolocation.speed_over_ground     = 65536.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_SPEED_OVER_GROUND);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_SPEED_OVER_GROUND);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothHeadingAngle) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothHeadingAngle) {
     c_.has.formatted_gps_geolocation               = true;
     c_.formatted_gps_geolocation.has.heading_angle = true;
     c_.formatted_gps_geolocation.heading_angle     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
     ASSERT_EQ(Hex(buf_[9]), Hex(0x00400000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothHeadingAngleSmall) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothHeadingAngleSmall) {
     c_.has.formatted_gps_geolocation               = true;
     c_.formatted_gps_geolocation.has.heading_angle = true;
     c_.formatted_gps_geolocation.heading_angle     = 0.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
     ASSERT_EQ(Hex(buf_[9]), Hex(0x00000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothHeadingAngleLarge) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothHeadingAngleLarge) {
     c_.has.formatted_gps_geolocation               = true;
     c_.formatted_gps_geolocation.has.heading_angle = true;
     c_.formatted_gps_geolocation.heading_angle     = 359.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
     ASSERT_EQ(Hex(buf_[9]), Hex(0x59C00000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothHeadingAngleInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothHeadingAngleInvalidSmall) {
     c_.has.formatted_gps_geolocation               = true;
     c_.formatted_gps_geolocation.has.heading_angle = true;
     c_.formatted_gps_geolocation.heading_angle     = -1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
     ASSERT_EQ(Hex(buf_[9]), Hex(0xFFC00000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothHeadingAngleInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothHeadingAngleInvalidLarge) {
     c_.has.formatted_gps_geolocation               = true;
     c_.formatted_gps_geolocation.has.heading_angle = true;
     c_.formatted_gps_geolocation.heading_angle     = 360.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
     ASSERT_EQ(Hex(buf_[9]), Hex(0x5A000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothTrackAngle) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothTrackAngle) {
     c_.has.formatted_gps_geolocation             = true;
     c_.formatted_gps_geolocation.has.track_angle = true;
     c_.formatted_gps_geolocation.track_angle     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
     ASSERT_EQ(Hex(buf_[10]), Hex(0x00400000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothTrackAngleSmall) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothTrackAngleSmall) {
     c_.has.formatted_gps_geolocation             = true;
     c_.formatted_gps_geolocation.has.track_angle = true;
     c_.formatted_gps_geolocation.track_angle     = 0.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
     ASSERT_EQ(Hex(buf_[10]), Hex(0x00000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothTrackAngleLarge) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothTrackAngleLarge) {
     c_.has.formatted_gps_geolocation             = true;
     c_.formatted_gps_geolocation.has.track_angle = true;
     c_.formatted_gps_geolocation.track_angle     = 359.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
     ASSERT_EQ(Hex(buf_[10]), Hex(0x59C00000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothTrackAngleInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothTrackAngleInvalidSmall) {
     c_.has.formatted_gps_geolocation             = true;
     c_.formatted_gps_geolocation.has.track_angle = true;
     c_.formatted_gps_geolocation.track_angle     = -1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
     ASSERT_EQ(Hex(buf_[10]), Hex(0xFFC00000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothTrackAngleInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothTrackAngleInvalidLarge) {
     c_.has.formatted_gps_geolocation             = true;
     c_.formatted_gps_geolocation.has.track_angle = true;
     c_.formatted_gps_geolocation.track_angle     = 360.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
     ASSERT_EQ(Hex(buf_[10]), Hex(0x5A000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothMagneticVariation) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothMagneticVariation) {
     c_.has.formatted_gps_geolocation                    = true;
     c_.formatted_gps_geolocation.has.magnetic_variation = true;
     c_.formatted_gps_geolocation.magnetic_variation     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
     ASSERT_EQ(Hex(buf_[11]), Hex(0x00400000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothMagneticVariationSmall) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothMagneticVariationSmall) {
     c_.has.formatted_gps_geolocation                    = true;
     c_.formatted_gps_geolocation.has.magnetic_variation = true;
     c_.formatted_gps_geolocation.magnetic_variation     = -180.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
     ASSERT_EQ(Hex(buf_[11]), Hex(0xD3000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothMagneticVariationLarge) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothMagneticVariationLarge) {
     c_.has.formatted_gps_geolocation                    = true;
     c_.formatted_gps_geolocation.has.magnetic_variation = true;
     c_.formatted_gps_geolocation.magnetic_variation     = 180.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
     ASSERT_EQ(Hex(buf_[11]), Hex(0x2D000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothMagneticVariationInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothMagneticVariationInvalidSmall) {
     c_.has.formatted_gps_geolocation                    = true;
     c_.formatted_gps_geolocation.has.magnetic_variation = true;
     c_.formatted_gps_geolocation.magnetic_variation     = -181.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
     ASSERT_EQ(Hex(buf_[11]), Hex(0xD2C00000));
 }
 
-TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothMagneticVariationInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedGpsGeolocationBothMagneticVariationInvalidLarge) {
     c_.has.formatted_gps_geolocation                    = true;
     c_.formatted_gps_geolocation.has.magnetic_variation = true;
     c_.formatted_gps_geolocation.magnetic_variation     = 181.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
     ASSERT_EQ(Hex(buf_[11]), Hex(0x2D400000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationTsi) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationTsi) {
     c_.has.formatted_ins_geolocation = true;
     c_.formatted_ins_geolocation.tsi = VRT_TSI_OTHER;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0C000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationTsiInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationTsiInvalidSmall) {
     c_.has.formatted_ins_geolocation = true;
     c_.formatted_ins_geolocation.tsi = static_cast<vrt_tsi>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSI);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0C000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationTsiInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationTsiInvalidLarge) {
     c_.has.formatted_ins_geolocation = true;
     c_.formatted_ins_geolocation.tsi = static_cast<vrt_tsi>(4);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSI);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationTsf) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationTsf) {
     c_.has.formatted_ins_geolocation = true;
     c_.formatted_ins_geolocation.tsf = VRT_TSF_FREE_RUNNING_COUNT;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x03000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationTsfInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationTsfInvalidSmall) {
     c_.has.formatted_ins_geolocation = true;
     c_.formatted_ins_geolocation.tsf = static_cast<vrt_tsf>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSF);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSF);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x03000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationTsfInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationTsfInvalidLarge) {
     c_.has.formatted_ins_geolocation = true;
     c_.formatted_ins_geolocation.tsf = static_cast<vrt_tsf>(4);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSF);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSF);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationOui) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationOui) {
     c_.has.formatted_ins_geolocation = true;
     c_.formatted_ins_geolocation.oui = 0x00FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FFFFFF));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationOuiInvalid) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationOuiInvalid) {
     c_.has.formatted_ins_geolocation = true;
     c_.formatted_ins_geolocation.oui = 0x01FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_OUI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_OUI);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FFFFFF));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationIntegerSecondTimestamp) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationIntegerSecondTimestamp) {
     c_.has.formatted_ins_geolocation                      = true;
     c_.formatted_ins_geolocation.tsi                      = VRT_TSI_UTC;
     c_.formatted_ins_geolocation.integer_second_timestamp = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {{1, 2}}, true);
@@ -1770,23 +1778,23 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationIntegerSecondTimestamp) {
     ASSERT_EQ(Hex(buf_[2]), Hex(0xABABABAB));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationIntegerSecondTimestampInvalid) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationIntegerSecondTimestampInvalid) {
     c_.has.formatted_ins_geolocation                      = true;
     c_.formatted_ins_geolocation.tsi                      = VRT_TSI_UNDEFINED;
     c_.formatted_ins_geolocation.integer_second_timestamp = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {2}, true);
     ASSERT_EQ(Hex(buf_[2]), Hex(0xABABABAB));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationFractionalSecondTimestamp) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationFractionalSecondTimestamp) {
     c_.has.formatted_ins_geolocation                         = true;
     c_.formatted_ins_geolocation.tsf                         = VRT_TSF_REAL_TIME;
     c_.formatted_ins_geolocation.fractional_second_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {{1, 3, 4}}, true);
@@ -1795,12 +1803,12 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationFractionalSecondTimestamp) {
     ASSERT_EQ(Hex(buf_[4]), Hex(0xD4A50FFF));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInvalid1) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInvalid1) {
     c_.has.formatted_ins_geolocation                         = true;
     c_.formatted_ins_geolocation.tsf                         = VRT_TSF_UNDEFINED;
     c_.formatted_ins_geolocation.fractional_second_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {{3, 4}}, true);
@@ -1808,12 +1816,12 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInval
     ASSERT_EQ(Hex(buf_[4]), Hex(0xD4A50FFF));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInvalid2) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInvalid2) {
     c_.has.formatted_ins_geolocation                         = true;
     c_.formatted_ins_geolocation.tsf                         = VRT_TSF_REAL_TIME;
     c_.formatted_ins_geolocation.fractional_second_timestamp = 0x000000E8D4A51000;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {{1, 3, 4}}, true);
@@ -1822,544 +1830,544 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInval
     ASSERT_EQ(Hex(buf_[4]), Hex(0xD4A51000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationLatitude) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationLatitude) {
     c_.has.formatted_ins_geolocation      = true;
     c_.formatted_ins_geolocation.latitude = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationLongitude) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationLongitude) {
     c_.has.formatted_ins_geolocation       = true;
     c_.formatted_ins_geolocation.longitude = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationAltitude) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationAltitude) {
     c_.has.formatted_ins_geolocation      = true;
     c_.formatted_ins_geolocation.altitude = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationSpeedOverGround) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationSpeedOverGround) {
     c_.has.formatted_ins_geolocation               = true;
     c_.formatted_ins_geolocation.speed_over_ground = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationHeadingAngle) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationHeadingAngle) {
     c_.has.formatted_ins_geolocation           = true;
     c_.formatted_ins_geolocation.heading_angle = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationTrackAngle) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationTrackAngle) {
     c_.has.formatted_ins_geolocation         = true;
     c_.formatted_ins_geolocation.track_angle = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationMagneticVariation) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationMagneticVariation) {
     c_.has.formatted_ins_geolocation                = true;
     c_.formatted_ins_geolocation.magnetic_variation = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLatitude) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothLatitude) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.latitude = true;
     c_.formatted_ins_geolocation.latitude     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
     ASSERT_EQ(Hex(buf_[5]), Hex(0x00400000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLatitudeSmall) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothLatitudeSmall) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.latitude = true;
     c_.formatted_ins_geolocation.latitude     = -90.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
     ASSERT_EQ(Hex(buf_[5]), Hex(0xE9800000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLatitudeLarge) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothLatitudeLarge) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.latitude = true;
     c_.formatted_ins_geolocation.latitude     = 90.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
     ASSERT_EQ(Hex(buf_[5]), Hex(0x16800000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLatitudeInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothLatitudeInvalidSmall) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.latitude = true;
     c_.formatted_ins_geolocation.latitude     = -91.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LATITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LATITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
     ASSERT_EQ(Hex(buf_[5]), Hex(0xE9400000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLatitudeInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothLatitudeInvalidLarge) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.latitude = true;
     c_.formatted_ins_geolocation.latitude     = 91.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LATITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LATITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
     ASSERT_EQ(Hex(buf_[5]), Hex(0x16C00000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLongitude) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothLongitude) {
     c_.has.formatted_ins_geolocation           = true;
     c_.formatted_ins_geolocation.has.longitude = true;
     c_.formatted_ins_geolocation.longitude     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
     ASSERT_EQ(Hex(buf_[6]), Hex(0x00400000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLongitudeSmall) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothLongitudeSmall) {
     c_.has.formatted_ins_geolocation           = true;
     c_.formatted_ins_geolocation.has.longitude = true;
     c_.formatted_ins_geolocation.longitude     = -180.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
     ASSERT_EQ(Hex(buf_[6]), Hex(0xD3000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLongitudeLarge) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothLongitudeLarge) {
     c_.has.formatted_ins_geolocation           = true;
     c_.formatted_ins_geolocation.has.longitude = true;
     c_.formatted_ins_geolocation.longitude     = 180.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
     ASSERT_EQ(Hex(buf_[6]), Hex(0x2D000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLongitudeInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothLongitudeInvalidSmall) {
     c_.has.formatted_ins_geolocation           = true;
     c_.formatted_ins_geolocation.has.longitude = true;
     c_.formatted_ins_geolocation.longitude     = -181.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LONGITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LONGITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
     ASSERT_EQ(Hex(buf_[6]), Hex(0xD2C00000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLongitudeInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothLongitudeInvalidLarge) {
     c_.has.formatted_ins_geolocation           = true;
     c_.formatted_ins_geolocation.has.longitude = true;
     c_.formatted_ins_geolocation.longitude     = 181.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LONGITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LONGITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
     ASSERT_EQ(Hex(buf_[6]), Hex(0x2D400000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothAltitude) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothAltitude) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.altitude = true;
     c_.formatted_ins_geolocation.altitude     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, true);
     ASSERT_EQ(Hex(buf_[7]), Hex(0x00000020));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothAltitudeSmall) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothAltitudeSmall) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.altitude = true;
     c_.formatted_ins_geolocation.altitude     = -67108e3;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, true);
     ASSERT_EQ(Hex(buf_[7]), Hex(0x80006C00));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothAltitudeLarge) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothAltitudeLarge) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.altitude = true;
     c_.formatted_ins_geolocation.altitude     = 67108e3;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, true);
     ASSERT_EQ(Hex(buf_[7]), Hex(0x7FFF9400));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothAltitudeInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothAltitudeInvalidSmall) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.altitude = true;
     c_.formatted_ins_geolocation.altitude     = -67109e3;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_ALTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_ALTITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothAltitudeInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothAltitudeInvalidLarge) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.altitude = true;
     c_.formatted_ins_geolocation.altitude     = 67109e3;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_ALTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_ALTITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothSpeedOverGround) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothSpeedOverGround) {
     c_.has.formatted_ins_geolocation                   = true;
     c_.formatted_ins_geolocation.has.speed_over_ground = true;
     c_.formatted_ins_geolocation.speed_over_ground     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, true);
     ASSERT_EQ(Hex(buf_[8]), Hex(0x00010000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothSpeedOverGroundSmall) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothSpeedOverGroundSmall) {
     c_.has.formatted_ins_geolocation                   = true;
     c_.formatted_ins_geolocation.has.speed_over_ground = true;
     c_.formatted_ins_geolocation.speed_over_ground     = 0.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, true);
     ASSERT_EQ(Hex(buf_[8]), Hex(0x00000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothSpeedOverGroundLarge) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothSpeedOverGroundLarge) {
     c_.has.formatted_ins_geolocation                   = true;
     c_.formatted_ins_geolocation.has.speed_over_ground = true;
     c_.formatted_ins_geolocation.speed_over_ground     = 65535.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, true);
     ASSERT_EQ(Hex(buf_[8]), Hex(0xFFFF0000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothSpeedOverGroundInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothSpeedOverGroundInvalidSmall) {
     c_.has.formatted_ins_geolocation                   = true;
     c_.formatted_ins_geolocation.has.speed_over_ground = true;
     c_.formatted_ins_geolocation.speed_over_ground     = -1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_SPEED_OVER_GROUND);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_SPEED_OVER_GROUND);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, true);
     ASSERT_EQ(Hex(buf_[8]), Hex(0xFFFF0000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothSpeedOverGroundInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothSpeedOverGroundInvalidLarge) {
     c_.has.formatted_ins_geolocation                   = true;
     c_.formatted_ins_geolocation.has.speed_over_ground = true;
     c_.formatted_ins_geolocation.speed_over_ground     = 65536.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_SPEED_OVER_GROUND);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_SPEED_OVER_GROUND);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothHeadingAngle) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothHeadingAngle) {
     c_.has.formatted_ins_geolocation               = true;
     c_.formatted_ins_geolocation.has.heading_angle = true;
     c_.formatted_ins_geolocation.heading_angle     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
     ASSERT_EQ(Hex(buf_[9]), Hex(0x00400000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothHeadingAngleSmall) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothHeadingAngleSmall) {
     c_.has.formatted_ins_geolocation               = true;
     c_.formatted_ins_geolocation.has.heading_angle = true;
     c_.formatted_ins_geolocation.heading_angle     = 0.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
     ASSERT_EQ(Hex(buf_[9]), Hex(0x00000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothHeadingAngleLarge) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothHeadingAngleLarge) {
     c_.has.formatted_ins_geolocation               = true;
     c_.formatted_ins_geolocation.has.heading_angle = true;
     c_.formatted_ins_geolocation.heading_angle     = 359.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
     ASSERT_EQ(Hex(buf_[9]), Hex(0x59C00000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothHeadingAngleInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothHeadingAngleInvalidSmall) {
     c_.has.formatted_ins_geolocation               = true;
     c_.formatted_ins_geolocation.has.heading_angle = true;
     c_.formatted_ins_geolocation.heading_angle     = -1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
     ASSERT_EQ(Hex(buf_[9]), Hex(0xFFC00000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothHeadingAngleInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothHeadingAngleInvalidLarge) {
     c_.has.formatted_ins_geolocation               = true;
     c_.formatted_ins_geolocation.has.heading_angle = true;
     c_.formatted_ins_geolocation.heading_angle     = 360.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
     ASSERT_EQ(Hex(buf_[9]), Hex(0x5A000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothTrackAngle) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothTrackAngle) {
     c_.has.formatted_ins_geolocation             = true;
     c_.formatted_ins_geolocation.has.track_angle = true;
     c_.formatted_ins_geolocation.track_angle     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
     ASSERT_EQ(Hex(buf_[10]), Hex(0x00400000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothTrackAngleSmall) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothTrackAngleSmall) {
     c_.has.formatted_ins_geolocation             = true;
     c_.formatted_ins_geolocation.has.track_angle = true;
     c_.formatted_ins_geolocation.track_angle     = 0.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
     ASSERT_EQ(Hex(buf_[10]), Hex(0x00000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothTrackAngleLarge) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothTrackAngleLarge) {
     c_.has.formatted_ins_geolocation             = true;
     c_.formatted_ins_geolocation.has.track_angle = true;
     c_.formatted_ins_geolocation.track_angle     = 359.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
     ASSERT_EQ(Hex(buf_[10]), Hex(0x59C00000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothTrackAngleInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothTrackAngleInvalidSmall) {
     c_.has.formatted_ins_geolocation             = true;
     c_.formatted_ins_geolocation.has.track_angle = true;
     c_.formatted_ins_geolocation.track_angle     = -1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
     ASSERT_EQ(Hex(buf_[10]), Hex(0xFFC00000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothTrackAngleInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothTrackAngleInvalidLarge) {
     c_.has.formatted_ins_geolocation             = true;
     c_.formatted_ins_geolocation.has.track_angle = true;
     c_.formatted_ins_geolocation.track_angle     = 360.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
     ASSERT_EQ(Hex(buf_[10]), Hex(0x5A000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothMagneticVariation) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothMagneticVariation) {
     c_.has.formatted_ins_geolocation                    = true;
     c_.formatted_ins_geolocation.has.magnetic_variation = true;
     c_.formatted_ins_geolocation.magnetic_variation     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
     ASSERT_EQ(Hex(buf_[11]), Hex(0x00400000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothMagneticVariationSmall) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothMagneticVariationSmall) {
     c_.has.formatted_ins_geolocation                    = true;
     c_.formatted_ins_geolocation.has.magnetic_variation = true;
     c_.formatted_ins_geolocation.magnetic_variation     = -180.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
     ASSERT_EQ(Hex(buf_[11]), Hex(0xD3000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothMagneticVariationLarge) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothMagneticVariationLarge) {
     c_.has.formatted_ins_geolocation                    = true;
     c_.formatted_ins_geolocation.has.magnetic_variation = true;
     c_.formatted_ins_geolocation.magnetic_variation     = 180.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
     ASSERT_EQ(Hex(buf_[11]), Hex(0x2D000000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothMagneticVariationInvalidSmall) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothMagneticVariationInvalidSmall) {
     c_.has.formatted_ins_geolocation                    = true;
     c_.formatted_ins_geolocation.has.magnetic_variation = true;
     c_.formatted_ins_geolocation.magnetic_variation     = -181.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
     ASSERT_EQ(Hex(buf_[11]), Hex(0xD2C00000));
 }
 
-TEST_F(WriteIfContextTest, FormattedInsGeolocationBothMagneticVariationInvalidLarge) {
+TEST_P(WriteIfContextTest, FormattedInsGeolocationBothMagneticVariationInvalidLarge) {
     c_.has.formatted_ins_geolocation                    = true;
     c_.formatted_ins_geolocation.has.magnetic_variation = true;
     c_.formatted_ins_geolocation.magnetic_variation     = 181.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 12, false), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
     ASSERT_EQ(Hex(buf_[11]), Hex(0x2D400000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisTsi) {
+TEST_P(WriteIfContextTest, EcefEphemerisTsi) {
     c_.has.ecef_ephemeris = true;
     c_.ecef_ephemeris.tsi = VRT_TSI_OTHER;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0C000000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisTsiInvalidSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisTsiInvalidSmall) {
     c_.has.ecef_ephemeris = true;
     c_.ecef_ephemeris.tsi = static_cast<vrt_tsi>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSI);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0C000000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisTsiInvalidLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisTsiInvalidLarge) {
     c_.has.ecef_ephemeris = true;
     c_.ecef_ephemeris.tsi = static_cast<vrt_tsi>(4);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSI);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisTsf) {
+TEST_P(WriteIfContextTest, EcefEphemerisTsf) {
     c_.has.ecef_ephemeris = true;
     c_.ecef_ephemeris.tsf = VRT_TSF_FREE_RUNNING_COUNT;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x03000000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisTsfInvalidSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisTsfInvalidSmall) {
     c_.has.ecef_ephemeris = true;
     c_.ecef_ephemeris.tsf = static_cast<vrt_tsf>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSF);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSF);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x03000000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisTsfInvalidLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisTsfInvalidLarge) {
     c_.has.ecef_ephemeris = true;
     c_.ecef_ephemeris.tsf = static_cast<vrt_tsf>(4);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSF);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSF);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisOui) {
+TEST_P(WriteIfContextTest, EcefEphemerisOui) {
     c_.has.ecef_ephemeris = true;
     c_.ecef_ephemeris.oui = 0x00FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FFFFFF));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisOuiInvalid) {
+TEST_P(WriteIfContextTest, EcefEphemerisOuiInvalid) {
     c_.has.ecef_ephemeris = true;
     c_.ecef_ephemeris.oui = 0x01FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_OUI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_OUI);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FFFFFF));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisIntegerSecondTimestamp) {
+TEST_P(WriteIfContextTest, EcefEphemerisIntegerSecondTimestamp) {
     c_.has.ecef_ephemeris                      = true;
     c_.ecef_ephemeris.tsi                      = VRT_TSI_UTC;
     c_.ecef_ephemeris.integer_second_timestamp = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1, 2}, false);
@@ -2367,23 +2375,23 @@ TEST_F(WriteIfContextTest, EcefEphemerisIntegerSecondTimestamp) {
     ASSERT_EQ(Hex(buf_[2]), Hex(0xABABABAB));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisIntegerSecondTimestampInvalid) {
+TEST_P(WriteIfContextTest, EcefEphemerisIntegerSecondTimestampInvalid) {
     c_.has.ecef_ephemeris                      = true;
     c_.ecef_ephemeris.tsi                      = VRT_TSI_UNDEFINED;
     c_.ecef_ephemeris.integer_second_timestamp = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {2}, false);
     ASSERT_EQ(Hex(buf_[2]), Hex(0xABABABAB));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisFractionalSecondTimestamp) {
+TEST_P(WriteIfContextTest, EcefEphemerisFractionalSecondTimestamp) {
     c_.has.ecef_ephemeris                         = true;
     c_.ecef_ephemeris.tsf                         = VRT_TSF_REAL_TIME;
     c_.ecef_ephemeris.fractional_second_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1, 3, 4}, false);
@@ -2392,12 +2400,12 @@ TEST_F(WriteIfContextTest, EcefEphemerisFractionalSecondTimestamp) {
     ASSERT_EQ(Hex(buf_[4]), Hex(0xD4A50FFF));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid1) {
+TEST_P(WriteIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid1) {
     c_.has.ecef_ephemeris                         = true;
     c_.ecef_ephemeris.tsf                         = VRT_TSF_UNDEFINED;
     c_.ecef_ephemeris.fractional_second_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {3, 4}, false);
@@ -2405,12 +2413,12 @@ TEST_F(WriteIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid1) {
     ASSERT_EQ(Hex(buf_[4]), Hex(0xD4A50FFF));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid2) {
+TEST_P(WriteIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid2) {
     c_.has.ecef_ephemeris                         = true;
     c_.ecef_ephemeris.tsf                         = VRT_TSF_REAL_TIME;
     c_.ecef_ephemeris.fractional_second_timestamp = 0x000000E8D4A51000;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1, 3, 4}, false);
@@ -2419,617 +2427,617 @@ TEST_F(WriteIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid2) {
     ASSERT_EQ(Hex(buf_[4]), Hex(0xD4A51000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisPositionX) {
+TEST_P(WriteIfContextTest, EcefEphemerisPositionX) {
     c_.has.ecef_ephemeris        = true;
     c_.ecef_ephemeris.position_x = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisPositionY) {
+TEST_P(WriteIfContextTest, EcefEphemerisPositionY) {
     c_.has.ecef_ephemeris        = true;
     c_.ecef_ephemeris.position_y = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisPositionZ) {
+TEST_P(WriteIfContextTest, EcefEphemerisPositionZ) {
     c_.has.ecef_ephemeris        = true;
     c_.ecef_ephemeris.position_z = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisAttitudeAlpha) {
+TEST_P(WriteIfContextTest, EcefEphemerisAttitudeAlpha) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.attitude_alpha = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisAttitudeBeta) {
+TEST_P(WriteIfContextTest, EcefEphemerisAttitudeBeta) {
     c_.has.ecef_ephemeris           = true;
     c_.ecef_ephemeris.attitude_beta = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisAttitudePhi) {
+TEST_P(WriteIfContextTest, EcefEphemerisAttitudePhi) {
     c_.has.ecef_ephemeris          = true;
     c_.ecef_ephemeris.attitude_phi = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisVelocityDx) {
+TEST_P(WriteIfContextTest, EcefEphemerisVelocityDx) {
     c_.has.ecef_ephemeris         = true;
     c_.ecef_ephemeris.velocity_dx = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisVelocityDy) {
+TEST_P(WriteIfContextTest, EcefEphemerisVelocityDy) {
     c_.has.ecef_ephemeris         = true;
     c_.ecef_ephemeris.velocity_dy = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisVelocityDz) {
+TEST_P(WriteIfContextTest, EcefEphemerisVelocityDz) {
     c_.has.ecef_ephemeris         = true;
     c_.ecef_ephemeris.velocity_dz = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothPositionX) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothPositionX) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_x = true;
     c_.ecef_ephemeris.position_x     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, false);
     ASSERT_EQ(Hex(buf_[5]), Hex(0x00000020));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothPositionXSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothPositionXSmall) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_x = true;
     c_.ecef_ephemeris.position_x     = -67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, false);
     ASSERT_EQ(Hex(buf_[5]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothPositionXLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothPositionXLarge) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_x = true;
     c_.ecef_ephemeris.position_x     = 67108863;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, false);
     ASSERT_EQ(Hex(buf_[5]), Hex(0x7FFFFFE0));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothPositionXInvalidSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothPositionXInvalidSmall) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_x = true;
     c_.ecef_ephemeris.position_x     = -67108865;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothPositionXInvalidLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothPositionXInvalidLarge) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_x = true;
     c_.ecef_ephemeris.position_x     = 67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothPositionY) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothPositionY) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_y = true;
     c_.ecef_ephemeris.position_y     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, false);
     ASSERT_EQ(Hex(buf_[6]), Hex(0x00000020));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothPositionYSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothPositionYSmall) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_y = true;
     c_.ecef_ephemeris.position_y     = -67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, false);
     ASSERT_EQ(Hex(buf_[6]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothPositionYLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothPositionYLarge) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_y = true;
     c_.ecef_ephemeris.position_y     = 67108863;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, false);
     ASSERT_EQ(Hex(buf_[6]), Hex(0x7FFFFFE0));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothPositionYInvalidSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothPositionYInvalidSmall) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_y = true;
     c_.ecef_ephemeris.position_y     = -67108865;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothPositionYInvalidLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothPositionYInvalidLarge) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_y = true;
     c_.ecef_ephemeris.position_y     = 67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothPositionZ) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothPositionZ) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_z = true;
     c_.ecef_ephemeris.position_z     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, false);
     ASSERT_EQ(Hex(buf_[7]), Hex(0x00000020));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothPositionZSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothPositionZSmall) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_z = true;
     c_.ecef_ephemeris.position_z     = -67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, false);
     ASSERT_EQ(Hex(buf_[7]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothPositionZLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothPositionZLarge) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_z = true;
     c_.ecef_ephemeris.position_z     = 67108863;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, false);
     ASSERT_EQ(Hex(buf_[7]), Hex(0x7FFFFFE0));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothPositionZInvalidSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothPositionZInvalidSmall) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_z = true;
     c_.ecef_ephemeris.position_z     = -67108865;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothPositionZInvalidLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothPositionZInvalidLarge) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_z = true;
     c_.ecef_ephemeris.position_z     = 67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeAlpha) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothAttitudeAlpha) {
     c_.has.ecef_ephemeris                = true;
     c_.ecef_ephemeris.has.attitude_alpha = true;
     c_.ecef_ephemeris.attitude_alpha     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, false);
     ASSERT_EQ(Hex(buf_[8]), Hex(0x00400000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeAlphaSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothAttitudeAlphaSmall) {
     c_.has.ecef_ephemeris                = true;
     c_.ecef_ephemeris.has.attitude_alpha = true;
     c_.ecef_ephemeris.attitude_alpha     = -512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, false);
     ASSERT_EQ(Hex(buf_[8]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeAlphaLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothAttitudeAlphaLarge) {
     c_.has.ecef_ephemeris                = true;
     c_.ecef_ephemeris.has.attitude_alpha = true;
     c_.ecef_ephemeris.attitude_alpha     = 511;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, false);
     ASSERT_EQ(Hex(buf_[8]), Hex(0x7FC00000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeAlphaInvalidSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothAttitudeAlphaInvalidSmall) {
     c_.has.ecef_ephemeris                = true;
     c_.ecef_ephemeris.has.attitude_alpha = true;
     c_.ecef_ephemeris.attitude_alpha     = -513;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeAlphaInvalidLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothAttitudeAlphaInvalidLarge) {
     c_.has.ecef_ephemeris                = true;
     c_.ecef_ephemeris.has.attitude_alpha = true;
     c_.ecef_ephemeris.attitude_alpha     = 512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeBeta) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothAttitudeBeta) {
     c_.has.ecef_ephemeris               = true;
     c_.ecef_ephemeris.has.attitude_beta = true;
     c_.ecef_ephemeris.attitude_beta     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, false);
     ASSERT_EQ(Hex(buf_[9]), Hex(0x00400000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeBetaSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothAttitudeBetaSmall) {
     c_.has.ecef_ephemeris               = true;
     c_.ecef_ephemeris.has.attitude_beta = true;
     c_.ecef_ephemeris.attitude_beta     = -512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, false);
     ASSERT_EQ(Hex(buf_[9]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeBetaLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothAttitudeBetaLarge) {
     c_.has.ecef_ephemeris               = true;
     c_.ecef_ephemeris.has.attitude_beta = true;
     c_.ecef_ephemeris.attitude_beta     = 511;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, false);
     ASSERT_EQ(Hex(buf_[9]), Hex(0x7FC00000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeBetaInvalidSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothAttitudeBetaInvalidSmall) {
     c_.has.ecef_ephemeris               = true;
     c_.ecef_ephemeris.has.attitude_beta = true;
     c_.ecef_ephemeris.attitude_beta     = -513;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeBetaInvalidLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothAttitudeBetaInvalidLarge) {
     c_.has.ecef_ephemeris               = true;
     c_.ecef_ephemeris.has.attitude_beta = true;
     c_.ecef_ephemeris.attitude_beta     = 512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudePhi) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothAttitudePhi) {
     c_.has.ecef_ephemeris              = true;
     c_.ecef_ephemeris.has.attitude_phi = true;
     c_.ecef_ephemeris.attitude_phi     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, false);
     ASSERT_EQ(Hex(buf_[10]), Hex(0x00400000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudePhiSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothAttitudePhiSmall) {
     c_.has.ecef_ephemeris              = true;
     c_.ecef_ephemeris.has.attitude_phi = true;
     c_.ecef_ephemeris.attitude_phi     = -512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, false);
     ASSERT_EQ(Hex(buf_[10]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudePhiLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothAttitudePhiLarge) {
     c_.has.ecef_ephemeris              = true;
     c_.ecef_ephemeris.has.attitude_phi = true;
     c_.ecef_ephemeris.attitude_phi     = 511;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, false);
     ASSERT_EQ(Hex(buf_[10]), Hex(0x7FC00000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudePhiInvalidSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothAttitudePhiInvalidSmall) {
     c_.has.ecef_ephemeris              = true;
     c_.ecef_ephemeris.has.attitude_phi = true;
     c_.ecef_ephemeris.attitude_phi     = -513;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudePhiInvalidLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothAttitudePhiInvalidLarge) {
     c_.has.ecef_ephemeris              = true;
     c_.ecef_ephemeris.has.attitude_phi = true;
     c_.ecef_ephemeris.attitude_phi     = 512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDx) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothVelocityDx) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dx = true;
     c_.ecef_ephemeris.velocity_dx     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, false);
     ASSERT_EQ(Hex(buf_[11]), Hex(0x00010000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDxSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothVelocityDxSmall) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dx = true;
     c_.ecef_ephemeris.velocity_dx     = -32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, false);
     ASSERT_EQ(Hex(buf_[11]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDxLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothVelocityDxLarge) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dx = true;
     c_.ecef_ephemeris.velocity_dx     = 32767;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, false);
     ASSERT_EQ(Hex(buf_[11]), Hex(0x7FFF0000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDxInvalidSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothVelocityDxInvalidSmall) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dx = true;
     c_.ecef_ephemeris.velocity_dx     = -32769;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDxInvalidLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothVelocityDxInvalidLarge) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dx = true;
     c_.ecef_ephemeris.velocity_dx     = 32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDy) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothVelocityDy) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dy = true;
     c_.ecef_ephemeris.velocity_dy     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {12}, false);
     ASSERT_EQ(Hex(buf_[12]), Hex(0x00010000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDySmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothVelocityDySmall) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dy = true;
     c_.ecef_ephemeris.velocity_dy     = -32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {12}, false);
     ASSERT_EQ(Hex(buf_[12]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDyLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothVelocityDyLarge) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dy = true;
     c_.ecef_ephemeris.velocity_dy     = 32767;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {12}, false);
     ASSERT_EQ(Hex(buf_[12]), Hex(0x7FFF0000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDyInvalidSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothVelocityDyInvalidSmall) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dy = true;
     c_.ecef_ephemeris.velocity_dy     = -32769;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDyInvalidLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothVelocityDyInvalidLarge) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dy = true;
     c_.ecef_ephemeris.velocity_dy     = 32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDz) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothVelocityDz) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dz = true;
     c_.ecef_ephemeris.velocity_dz     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {13}, false);
     ASSERT_EQ(Hex(buf_[13]), Hex(0x00010000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDzSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothVelocityDzSmall) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dz = true;
     c_.ecef_ephemeris.velocity_dz     = -32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {13}, false);
     ASSERT_EQ(Hex(buf_[13]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDzLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothVelocityDzLarge) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dz = true;
     c_.ecef_ephemeris.velocity_dz     = 32767;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {13}, false);
     ASSERT_EQ(Hex(buf_[13]), Hex(0x7FFF0000));
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDzInvalidSmall) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothVelocityDzInvalidSmall) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dz = true;
     c_.ecef_ephemeris.velocity_dz     = -32769;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDzInvalidLarge) {
+TEST_P(WriteIfContextTest, EcefEphemerisBothVelocityDzInvalidLarge) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dz = true;
     c_.ecef_ephemeris.velocity_dz     = 32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisTsi) {
+TEST_P(WriteIfContextTest, RelativeEphemerisTsi) {
     c_.has.relative_ephemeris = true;
     c_.relative_ephemeris.tsi = VRT_TSI_OTHER;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0C000000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisTsiInvalidSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisTsiInvalidSmall) {
     c_.has.relative_ephemeris = true;
     c_.relative_ephemeris.tsi = static_cast<vrt_tsi>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSI);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0C000000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisTsiInvalidLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisTsiInvalidLarge) {
     c_.has.relative_ephemeris = true;
     c_.relative_ephemeris.tsi = static_cast<vrt_tsi>(4);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSI);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisTsf) {
+TEST_P(WriteIfContextTest, RelativeEphemerisTsf) {
     c_.has.relative_ephemeris = true;
     c_.relative_ephemeris.tsf = VRT_TSF_FREE_RUNNING_COUNT;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x03000000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisTsfInvalidSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisTsfInvalidSmall) {
     c_.has.relative_ephemeris = true;
     c_.relative_ephemeris.tsf = static_cast<vrt_tsf>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSF);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSF);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x03000000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisTsfInvalidLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisTsfInvalidLarge) {
     c_.has.relative_ephemeris = true;
     c_.relative_ephemeris.tsf = static_cast<vrt_tsf>(4);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSF);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSF);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisOui) {
+TEST_P(WriteIfContextTest, RelativeEphemerisOui) {
     c_.has.relative_ephemeris = true;
     c_.relative_ephemeris.oui = 0x00FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FFFFFF));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisOuiInvalid) {
+TEST_P(WriteIfContextTest, RelativeEphemerisOuiInvalid) {
     c_.has.relative_ephemeris = true;
     c_.relative_ephemeris.oui = 0x01FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_OUI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_OUI);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FFFFFF));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisIntegerSecondTimestamp) {
+TEST_P(WriteIfContextTest, RelativeEphemerisIntegerSecondTimestamp) {
     c_.has.relative_ephemeris                      = true;
     c_.relative_ephemeris.tsi                      = VRT_TSI_UTC;
     c_.relative_ephemeris.integer_second_timestamp = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1, 2}, false);
@@ -3037,23 +3045,23 @@ TEST_F(WriteIfContextTest, RelativeEphemerisIntegerSecondTimestamp) {
     ASSERT_EQ(Hex(buf_[2]), Hex(0xABABABAB));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisIntegerSecondTimestampInvalid) {
+TEST_P(WriteIfContextTest, RelativeEphemerisIntegerSecondTimestampInvalid) {
     c_.has.relative_ephemeris                      = true;
     c_.relative_ephemeris.tsi                      = VRT_TSI_UNDEFINED;
     c_.relative_ephemeris.integer_second_timestamp = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {2}, false);
     ASSERT_EQ(Hex(buf_[2]), Hex(0xABABABAB));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisFractionalSecondTimestamp) {
+TEST_P(WriteIfContextTest, RelativeEphemerisFractionalSecondTimestamp) {
     c_.has.relative_ephemeris                         = true;
     c_.relative_ephemeris.tsf                         = VRT_TSF_REAL_TIME;
     c_.relative_ephemeris.fractional_second_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1, 3, 4}, false);
@@ -3062,12 +3070,12 @@ TEST_F(WriteIfContextTest, RelativeEphemerisFractionalSecondTimestamp) {
     ASSERT_EQ(Hex(buf_[4]), Hex(0xD4A50FFF));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid1) {
+TEST_P(WriteIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid1) {
     c_.has.relative_ephemeris                         = true;
     c_.relative_ephemeris.tsf                         = VRT_TSF_UNDEFINED;
     c_.relative_ephemeris.fractional_second_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {3, 4}, false);
@@ -3075,12 +3083,12 @@ TEST_F(WriteIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid1) {
     ASSERT_EQ(Hex(buf_[4]), Hex(0xD4A50FFF));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid2) {
+TEST_P(WriteIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid2) {
     c_.has.relative_ephemeris                         = true;
     c_.relative_ephemeris.tsf                         = VRT_TSF_REAL_TIME;
     c_.relative_ephemeris.fractional_second_timestamp = 0x000000E8D4A51000;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1, 3, 4}, false);
@@ -3089,573 +3097,573 @@ TEST_F(WriteIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid2) {
     ASSERT_EQ(Hex(buf_[4]), Hex(0xD4A51000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisPositionX) {
+TEST_P(WriteIfContextTest, RelativeEphemerisPositionX) {
     c_.has.relative_ephemeris        = true;
     c_.relative_ephemeris.position_x = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisPositionXSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisPositionXSmall) {
     c_.has.relative_ephemeris        = true;
     c_.relative_ephemeris.position_x = -67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisPositionY) {
+TEST_P(WriteIfContextTest, RelativeEphemerisPositionY) {
     c_.has.relative_ephemeris        = true;
     c_.relative_ephemeris.position_y = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisPositionZ) {
+TEST_P(WriteIfContextTest, RelativeEphemerisPositionZ) {
     c_.has.relative_ephemeris        = true;
     c_.relative_ephemeris.position_z = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisAttitudeAlpha) {
+TEST_P(WriteIfContextTest, RelativeEphemerisAttitudeAlpha) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.attitude_alpha = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisAttitudeBeta) {
+TEST_P(WriteIfContextTest, RelativeEphemerisAttitudeBeta) {
     c_.has.relative_ephemeris           = true;
     c_.relative_ephemeris.attitude_beta = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisAttitudePhi) {
+TEST_P(WriteIfContextTest, RelativeEphemerisAttitudePhi) {
     c_.has.relative_ephemeris          = true;
     c_.relative_ephemeris.attitude_phi = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisVelocityDx) {
+TEST_P(WriteIfContextTest, RelativeEphemerisVelocityDx) {
     c_.has.relative_ephemeris         = true;
     c_.relative_ephemeris.velocity_dx = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisVelocityDy) {
+TEST_P(WriteIfContextTest, RelativeEphemerisVelocityDy) {
     c_.has.relative_ephemeris         = true;
     c_.relative_ephemeris.velocity_dy = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisVelocityDz) {
+TEST_P(WriteIfContextTest, RelativeEphemerisVelocityDz) {
     c_.has.relative_ephemeris         = true;
     c_.relative_ephemeris.velocity_dz = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionX) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothPositionX) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_x = true;
     c_.relative_ephemeris.position_x     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, false);
     ASSERT_EQ(Hex(buf_[5]), Hex(0x00000020));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionXSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothPositionXSmall) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_x = true;
     c_.relative_ephemeris.position_x     = -67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, false);
     ASSERT_EQ(Hex(buf_[5]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionXLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothPositionXLarge) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_x = true;
     c_.relative_ephemeris.position_x     = 67108863;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, false);
     ASSERT_EQ(Hex(buf_[5]), Hex(0x7FFFFFE0));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionXInvalidSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothPositionXInvalidSmall) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_x = true;
     c_.relative_ephemeris.position_x     = -67108865;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionXInvalidLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothPositionXInvalidLarge) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_x = true;
     c_.relative_ephemeris.position_x     = 67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionY) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothPositionY) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_y = true;
     c_.relative_ephemeris.position_y     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, false);
     ASSERT_EQ(Hex(buf_[6]), Hex(0x00000020));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionYSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothPositionYSmall) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_y = true;
     c_.relative_ephemeris.position_y     = -67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, false);
     ASSERT_EQ(Hex(buf_[6]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionYLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothPositionYLarge) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_y = true;
     c_.relative_ephemeris.position_y     = 67108863;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, false);
     ASSERT_EQ(Hex(buf_[6]), Hex(0x7FFFFFE0));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionYInvalidSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothPositionYInvalidSmall) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_y = true;
     c_.relative_ephemeris.position_y     = -67108865;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionYInvalidLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothPositionYInvalidLarge) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_y = true;
     c_.relative_ephemeris.position_y     = 67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionZ) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothPositionZ) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_z = true;
     c_.relative_ephemeris.position_z     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, false);
     ASSERT_EQ(Hex(buf_[7]), Hex(0x00000020));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionZSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothPositionZSmall) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_z = true;
     c_.relative_ephemeris.position_z     = -67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, false);
     ASSERT_EQ(Hex(buf_[7]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionZLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothPositionZLarge) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_z = true;
     c_.relative_ephemeris.position_z     = 67108863;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, false);
     ASSERT_EQ(Hex(buf_[7]), Hex(0x7FFFFFE0));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionZInvalidSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothPositionZInvalidSmall) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_z = true;
     c_.relative_ephemeris.position_z     = -67108865;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionZInvalidLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothPositionZInvalidLarge) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_z = true;
     c_.relative_ephemeris.position_z     = 67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeAlpha) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothAttitudeAlpha) {
     c_.has.relative_ephemeris                = true;
     c_.relative_ephemeris.has.attitude_alpha = true;
     c_.relative_ephemeris.attitude_alpha     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, false);
     ASSERT_EQ(Hex(buf_[8]), Hex(0x00400000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeAlphaSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothAttitudeAlphaSmall) {
     c_.has.relative_ephemeris                = true;
     c_.relative_ephemeris.has.attitude_alpha = true;
     c_.relative_ephemeris.attitude_alpha     = -512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, false);
     ASSERT_EQ(Hex(buf_[8]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeAlphaLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothAttitudeAlphaLarge) {
     c_.has.relative_ephemeris                = true;
     c_.relative_ephemeris.has.attitude_alpha = true;
     c_.relative_ephemeris.attitude_alpha     = 511;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, false);
     ASSERT_EQ(Hex(buf_[8]), Hex(0x7FC00000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeAlphaInvalidSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothAttitudeAlphaInvalidSmall) {
     c_.has.relative_ephemeris                = true;
     c_.relative_ephemeris.has.attitude_alpha = true;
     c_.relative_ephemeris.attitude_alpha     = -513;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeAlphaInvalidLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothAttitudeAlphaInvalidLarge) {
     c_.has.relative_ephemeris                = true;
     c_.relative_ephemeris.has.attitude_alpha = true;
     c_.relative_ephemeris.attitude_alpha     = 512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeBeta) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothAttitudeBeta) {
     c_.has.relative_ephemeris               = true;
     c_.relative_ephemeris.has.attitude_beta = true;
     c_.relative_ephemeris.attitude_beta     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, false);
     ASSERT_EQ(Hex(buf_[9]), Hex(0x00400000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeBetaSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothAttitudeBetaSmall) {
     c_.has.relative_ephemeris               = true;
     c_.relative_ephemeris.has.attitude_beta = true;
     c_.relative_ephemeris.attitude_beta     = -512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, false);
     ASSERT_EQ(Hex(buf_[9]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeBetaLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothAttitudeBetaLarge) {
     c_.has.relative_ephemeris               = true;
     c_.relative_ephemeris.has.attitude_beta = true;
     c_.relative_ephemeris.attitude_beta     = 511;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, false);
     ASSERT_EQ(Hex(buf_[9]), Hex(0x7FC00000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeBetaInvalidSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothAttitudeBetaInvalidSmall) {
     c_.has.relative_ephemeris               = true;
     c_.relative_ephemeris.has.attitude_beta = true;
     c_.relative_ephemeris.attitude_beta     = -513;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeBetaInvalidLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothAttitudeBetaInvalidLarge) {
     c_.has.relative_ephemeris               = true;
     c_.relative_ephemeris.has.attitude_beta = true;
     c_.relative_ephemeris.attitude_beta     = 512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudePhi) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothAttitudePhi) {
     c_.has.relative_ephemeris              = true;
     c_.relative_ephemeris.has.attitude_phi = true;
     c_.relative_ephemeris.attitude_phi     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, false);
     ASSERT_EQ(Hex(buf_[10]), Hex(0x00400000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudePhiSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothAttitudePhiSmall) {
     c_.has.relative_ephemeris              = true;
     c_.relative_ephemeris.has.attitude_phi = true;
     c_.relative_ephemeris.attitude_phi     = -512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, false);
     ASSERT_EQ(Hex(buf_[10]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudePhiLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothAttitudePhiLarge) {
     c_.has.relative_ephemeris              = true;
     c_.relative_ephemeris.has.attitude_phi = true;
     c_.relative_ephemeris.attitude_phi     = 511;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, false);
     ASSERT_EQ(Hex(buf_[10]), Hex(0x7FC00000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudePhiInvalidSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothAttitudePhiInvalidSmall) {
     c_.has.relative_ephemeris              = true;
     c_.relative_ephemeris.has.attitude_phi = true;
     c_.relative_ephemeris.attitude_phi     = -513;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudePhiInvalidLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothAttitudePhiInvalidLarge) {
     c_.has.relative_ephemeris              = true;
     c_.relative_ephemeris.has.attitude_phi = true;
     c_.relative_ephemeris.attitude_phi     = 512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDx) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothVelocityDx) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dx = true;
     c_.relative_ephemeris.velocity_dx     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, false);
     ASSERT_EQ(Hex(buf_[11]), Hex(0x00010000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDxSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothVelocityDxSmall) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dx = true;
     c_.relative_ephemeris.velocity_dx     = -32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, false);
     ASSERT_EQ(Hex(buf_[11]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDxLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothVelocityDxLarge) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dx = true;
     c_.relative_ephemeris.velocity_dx     = 32767;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, false);
     ASSERT_EQ(Hex(buf_[11]), Hex(0x7FFF0000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDxInvalidSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothVelocityDxInvalidSmall) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dx = true;
     c_.relative_ephemeris.velocity_dx     = -32769;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDxInvalidLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothVelocityDxInvalidLarge) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dx = true;
     c_.relative_ephemeris.velocity_dx     = 32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDy) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothVelocityDy) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dy = true;
     c_.relative_ephemeris.velocity_dy     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {12}, false);
     ASSERT_EQ(Hex(buf_[12]), Hex(0x00010000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDySmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothVelocityDySmall) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dy = true;
     c_.relative_ephemeris.velocity_dy     = -32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {12}, false);
     ASSERT_EQ(Hex(buf_[12]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDyLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothVelocityDyLarge) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dy = true;
     c_.relative_ephemeris.velocity_dy     = 32767;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {12}, false);
     ASSERT_EQ(Hex(buf_[12]), Hex(0x7FFF0000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDyInvalidSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothVelocityDyInvalidSmall) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dy = true;
     c_.relative_ephemeris.velocity_dy     = -32769;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDyInvalidLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothVelocityDyInvalidLarge) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dy = true;
     c_.relative_ephemeris.velocity_dy     = 32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDz) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothVelocityDz) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dz = true;
     c_.relative_ephemeris.velocity_dz     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {13}, false);
     ASSERT_EQ(Hex(buf_[13]), Hex(0x00010000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDzSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothVelocityDzSmall) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dz = true;
     c_.relative_ephemeris.velocity_dz     = -32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {13}, false);
     ASSERT_EQ(Hex(buf_[13]), Hex(0x80000000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDzLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothVelocityDzLarge) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dz = true;
     c_.relative_ephemeris.velocity_dz     = 32767;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {13}, false);
     ASSERT_EQ(Hex(buf_[13]), Hex(0x7FFF0000));
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDzInvalidSmall) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothVelocityDzInvalidSmall) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dz = true;
     c_.relative_ephemeris.velocity_dz     = -32769;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDzInvalidLarge) {
+TEST_P(WriteIfContextTest, RelativeEphemerisBothVelocityDzInvalidLarge) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dz = true;
     c_.relative_ephemeris.velocity_dz     = 32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 14, false), 14);
 }
 
-TEST_F(WriteIfContextTest, EphemerisReferenceIdentifier) {
+TEST_P(WriteIfContextTest, EphemerisReferenceIdentifier) {
     c_.has.ephemeris_reference_identifier = true;
     c_.ephemeris_reference_identifier     = 0xFEFEFEFE;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000400));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFEFEFEFE));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, GpsAsciiOui) {
+TEST_P(WriteIfContextTest, GpsAsciiOui) {
     c_.has.gps_ascii = true;
     c_.gps_ascii.oui = 0x00FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000200));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FFFFFF));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, GpsAsciiOuiInvalid) {
+TEST_P(WriteIfContextTest, GpsAsciiOuiInvalid) {
     c_.has.gps_ascii = true;
     c_.gps_ascii.oui = 0x01FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_OUI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_OUI);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000200));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FFFFFF));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, GpsAsciiAscii) {
+TEST_P(WriteIfContextTest, GpsAsciiAscii) {
     c_.has.gps_ascii             = true;
     c_.gps_ascii.number_of_words = 5;
     c_.gps_ascii.ascii           = "What's your name?";
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 8, true), 8);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 8, true), 8);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000200));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000005));
@@ -3663,14 +3671,14 @@ TEST_F(WriteIfContextTest, GpsAsciiAscii) {
     ASSERT_EQ(Hex(buf_[8]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, ContextAssociationListsSource) {
+TEST_P(WriteIfContextTest, ContextAssociationListsSource) {
     c_.has.context_association_lists                             = true;
     c_.context_association_lists.source_list_size                = 0x01FF;
     std::array<uint32_t, 0x1FF> l                                = {};
     l[0]                                                         = 0xABABABAB;
     l[0x1FE]                                                     = 0xCBCBCBCB;
     c_.context_association_lists.source_context_association_list = l.data();
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, true), 0x202);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 0x202, true), 0x202);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000100));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x01FF0000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -3679,29 +3687,29 @@ TEST_F(WriteIfContextTest, ContextAssociationListsSource) {
     ASSERT_EQ(Hex(buf_[0x202]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, ContextAssociationListsSourceInvalid) {
+TEST_P(WriteIfContextTest, ContextAssociationListsSourceInvalid) {
     c_.has.context_association_lists                             = true;
     c_.context_association_lists.source_list_size                = 0x0200;
     std::array<uint32_t, 0x1FF> l                                = {};
     l[0]                                                         = 0xABABABAB;
     l[0x1FE]                                                     = 0xCBCBCBCB;
     c_.context_association_lists.source_context_association_list = l.data();
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, true), VRT_ERR_BOUNDS_SOURCE_LIST_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, false), 0x003);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 0x202, true), VRT_ERR_BOUNDS_SOURCE_LIST_SIZE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 0x202, false), 0x003);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000100));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, ContextAssociationListsSystem) {
+TEST_P(WriteIfContextTest, ContextAssociationListsSystem) {
     c_.has.context_association_lists                             = true;
     c_.context_association_lists.system_list_size                = 0x01FF;
     std::array<uint32_t, 0x1FF> l                                = {};
     l[0]                                                         = 0xABABABAB;
     l[0x1FE]                                                     = 0xCBCBCBCB;
     c_.context_association_lists.system_context_association_list = l.data();
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, true), 0x202);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 0x202, true), 0x202);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000100));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x000001FF));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -3710,29 +3718,29 @@ TEST_F(WriteIfContextTest, ContextAssociationListsSystem) {
     ASSERT_EQ(Hex(buf_[0x202]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, ContextAssociationListsSystemInvalid) {
+TEST_P(WriteIfContextTest, ContextAssociationListsSystemInvalid) {
     c_.has.context_association_lists                             = true;
     c_.context_association_lists.system_list_size                = 0x0200;
     std::array<uint32_t, 0x1FF> l                                = {};
     l[0]                                                         = 0xABABABAB;
     l[0x1FE]                                                     = 0xCBCBCBCB;
     c_.context_association_lists.system_context_association_list = l.data();
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, true), VRT_ERR_BOUNDS_SYSTEM_LIST_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, false), 0x003);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 0x202, true), VRT_ERR_BOUNDS_SYSTEM_LIST_SIZE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 0x202, false), 0x003);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000100));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, ContextAssociationListsVectorComponent) {
+TEST_P(WriteIfContextTest, ContextAssociationListsVectorComponent) {
     c_.has.context_association_lists                                       = true;
     c_.context_association_lists.vector_component_list_size                = 0x1FF;
     std::array<uint32_t, 0x1FF> l                                          = {};
     l[0]                                                                   = 0xABABABAB;
     l[0x1FE]                                                               = 0xCBCBCBCB;
     c_.context_association_lists.vector_component_context_association_list = l.data();
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, true), 0x202);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 0x202, true), 0x202);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000100));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x01FF0000));
@@ -3741,14 +3749,14 @@ TEST_F(WriteIfContextTest, ContextAssociationListsVectorComponent) {
     ASSERT_EQ(Hex(buf_[0x202]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, ContextAssociationListsAsynchronous) {
+TEST_P(WriteIfContextTest, ContextAssociationListsAsynchronous) {
     c_.has.context_association_lists                                           = true;
     c_.context_association_lists.asynchronous_channel_list_size                = 0x1FF;
     std::array<uint32_t, 0x1FF> l                                              = {};
     l[0]                                                                       = 0xABABABAB;
     l[0x1FE]                                                                   = 0xCBCBCBCB;
     c_.context_association_lists.asynchronous_channel_context_association_list = l.data();
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, true), 0x202);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 0x202, true), 0x202);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000100));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x000001FF));
@@ -3757,15 +3765,15 @@ TEST_F(WriteIfContextTest, ContextAssociationListsAsynchronous) {
     ASSERT_EQ(Hex(buf_[0x202]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, ContextAssociationListsAsynchronousInvalid) {
+TEST_P(WriteIfContextTest, ContextAssociationListsAsynchronousInvalid) {
     c_.has.context_association_lists                                           = true;
     c_.context_association_lists.asynchronous_channel_list_size                = 0x8000;
     std::array<uint32_t, 0x1FF> l                                              = {};
     c_.context_association_lists.asynchronous_channel_context_association_list = l.data();
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x8000, true), VRT_ERR_BOUNDS_CHANNEL_LIST_SIZE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 0x8000, true), VRT_ERR_BOUNDS_CHANNEL_LIST_SIZE);
 }
 
-TEST_F(WriteIfContextTest, ContextAssociationListsAsynchronousTag) {
+TEST_P(WriteIfContextTest, ContextAssociationListsAsynchronousTag) {
     c_.has.context_association_lists                                           = true;
     c_.context_association_lists.asynchronous_channel_list_size                = 3;
     c_.context_association_lists.has.asynchronous_channel_tag_list             = true;
@@ -3779,7 +3787,7 @@ TEST_F(WriteIfContextTest, ContextAssociationListsAsynchronousTag) {
     l2[2]                                                                      = 0xCDCDCDCD;
     c_.context_association_lists.asynchronous_channel_context_association_list = l1.data();
     c_.context_association_lists.asynchronous_channel_tag_list                 = l2.data();
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 9, true), 9);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 9, true), 9);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000100));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00008003));
@@ -3792,7 +3800,7 @@ TEST_F(WriteIfContextTest, ContextAssociationListsAsynchronousTag) {
     ASSERT_EQ(Hex(buf_[9]), Hex(0xBAADF00D));
 }
 
-TEST_F(WriteIfContextTest, EveryOther1) {
+TEST_P(WriteIfContextTest, EveryOther1) {
     c_.context_field_change_indicator = true;
     c_.has.bandwidth                  = true;
     c_.has.rf_reference_frequency     = true;
@@ -3875,8 +3883,8 @@ TEST_F(WriteIfContextTest, EveryOther1) {
     c_.gps_ascii.number_of_words = 3;
     c_.gps_ascii.ascii           = "Lorem ipsum!";
 
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 43, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 44, false), 44);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 43, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 44, false), 44);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xAAAAAA00)); /* Context indicators */
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFFFFFFFF)); /* Bandwidth */
     ASSERT_EQ(Hex(buf_[2]), Hex(0xFFF00000));
@@ -3923,7 +3931,7 @@ TEST_F(WriteIfContextTest, EveryOther1) {
     ASSERT_EQ(Hex(buf_[43]), Hex(0x216D7573));
 }
 
-TEST_F(WriteIfContextTest, EveryOther2) {
+TEST_P(WriteIfContextTest, EveryOther2) {
     c_.has.reference_point_identifier     = true;
     c_.has.if_reference_frequency         = true;
     c_.has.rf_reference_frequency_offset  = true;
@@ -4025,8 +4033,8 @@ TEST_F(WriteIfContextTest, EveryOther2) {
     c_.context_association_lists.asynchronous_channel_context_association_list = l4.data();
     c_.context_association_lists.asynchronous_channel_tag_list                 = l5.data();
 
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 48, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 49, false), 49);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 48, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 49, false), 49);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x55555500)); /* Context indicators */
     ASSERT_EQ(Hex(buf_[1]), Hex(0xACACACAC)); /* Reference point identifier */
     ASSERT_EQ(Hex(buf_[2]), Hex(0xFFFFFFFF)); /* IF reference frequency */
@@ -4078,7 +4086,7 @@ TEST_F(WriteIfContextTest, EveryOther2) {
     ASSERT_EQ(Hex(buf_[48]), Hex(0xABCDEF01));
 }
 
-TEST_F(WriteIfContextTest, All) {
+TEST_P(WriteIfContextTest, All) {
     c_.context_field_change_indicator     = true;
     c_.has.reference_point_identifier     = true;
     c_.has.bandwidth                      = true;
@@ -4260,8 +4268,8 @@ TEST_F(WriteIfContextTest, All) {
     c_.context_association_lists.asynchronous_channel_context_association_list = l4.data();
     c_.context_association_lists.asynchronous_channel_tag_list                 = l5.data();
 
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 91, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 92, false), 92);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 91, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_if_context(&c_, buf_.data(), 92, false), 92);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xFFFFFF00)); /* Context indicators */
     ASSERT_EQ(Hex(buf_[1]), Hex(0xACACACAC)); /* Reference point identifier */
     ASSERT_EQ(Hex(buf_[2]), Hex(0xFFFFFFFF)); /* Bandwidth */
@@ -4355,3 +4363,8 @@ TEST_F(WriteIfContextTest, All) {
     ASSERT_EQ(Hex(buf_[90]), Hex(0x9ABCDEF0));
     ASSERT_EQ(Hex(buf_[91]), Hex(0xABCDEF01));
 }
+
+INSTANTIATE_TEST_SUITE_P(ByteOrders,
+                         WriteIfContextTest,
+                         ::testing::Values(ByteOrder::HOST, ByteOrder::NETWORK),
+                         byte_order_name);
@@ -10,81 +10,90 @@
 #include <vrt/vrt_types.h>
 #include <vrt/vrt_write.h>
 
+#include "byte_order.h"
 #include "hex.h"
 
-class WritePacketTest : public ::testing::Test {
+class WritePacketTest : public ::testing::TestWithParam<ByteOrder> {
    protected:
     void SetUp() override {
         vrt_init_packet(&p_);
         buf_.fill(0xBAADF00D);
     }
 
+    /* Writes in the byte order of the test parameter, buf_ is in host order again afterwards. Bodies are held in
+     * host order, so they are swapped when written in network order. */
+    int32_t write_packet(const vrt_packet* packet, void* buf, int32_t words_buf, bool validate) {
+        return call_in_order(
+            GetParam(), &buf_, [&] { return vrt_write_packet(packet, buf, words_buf, validate); },
+            [&] { return vrt_write_packet_be(packet, buf, words_buf, validate, true); });
+    }
+
     vrt_packet               p_{};
     std::array<uint32_t, 32> buf_{};
 };
 
-TEST_F(WritePacketTest, NegativeSizeBuffer) {
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), -1, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), -1, false), VRT_ERR_BUFFER_SIZE);
+TEST_P(WritePacketTest, NegativeSizeBuffer) {
+    ASSERT_EQ(write_packet(&p_, buf_.data(), -1, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), -1, false), VRT_ERR_BUFFER_SIZE);
 }
 
-TEST_F(WritePacketTest, ZeroSizeBuffer) {
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 0, false), VRT_ERR_BUFFER_SIZE);
+TEST_P(WritePacketTest, ZeroSizeBuffer) {
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 0, false), VRT_ERR_BUFFER_SIZE);
 }
 
-TEST_F(WritePacketTest, EmptyIfDataWithoutStreamId) {
+TEST_P(WritePacketTest, EmptyIfDataWithoutStreamId) {
     p_.header.packet_type = VRT_PT_IF_DATA_WITHOUT_STREAM_ID;
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 1, true), 1);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 1, true), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000001));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, EmptyIfDataWithStreamId) {
+TEST_P(WritePacketTest, EmptyIfDataWithStreamId) {
     p_.header.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
     p_.fields.stream_id   = 0xABABABAB;
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x10000002));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, EmptyExtDataWithoutStreamId) {
+TEST_P(WritePacketTest, EmptyExtDataWithoutStreamId) {
     p_.header.packet_type = VRT_PT_EXT_DATA_WITHOUT_STREAM_ID;
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 1, true), 1);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 1, true), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x20000001));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, EmptyExtDataWithStreamId) {
+TEST_P(WritePacketTest, EmptyExtDataWithStreamId) {
     p_.header.packet_type = VRT_PT_EXT_DATA_WITH_STREAM_ID;
     p_.fields.stream_id   = 0xABABABAB;
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x30000002));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, EmptyIfContext) {
+TEST_P(WritePacketTest, EmptyIfContext) {
     p_.header.packet_type = VRT_PT_IF_CONTEXT;
     p_.fields.stream_id   = 0xABABABAB;
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x40000003));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, EmptyExtContext) {
+TEST_P(WritePacketTest, EmptyExtContext) {
     p_.header.packet_type = VRT_PT_EXT_CONTEXT;
     p_.fields.stream_id   = 0xABABABAB;
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x50000002));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, BodyIfDataWithoutStreamId) {
+TEST_P(WritePacketTest, BodyIfDataWithoutStreamId) {
     p_.header.packet_type        = VRT_PT_IF_DATA_WITHOUT_STREAM_ID;
     std::array<uint32_t, 3> body = {};
     body[0]                      = 0xCECECECE;
@@ -92,7 +101,7 @@ TEST_F(WritePacketTest, BodyIfDataWithoutStreamId) {
     body[2]                      = 0xDEDEDEDE;
     p_.words_body                = body.size();
     p_.body                      = body.data();
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 4, true), 4);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 4, true), 4);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000004));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xCECECECE));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xFEFEFEFE));
@@ -100,7 +109,7 @@ TEST_F(WritePacketTest, BodyIfDataWithoutStreamId) {
     ASSERT_EQ(Hex(buf_[4]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, BodyIfDataWithStreamId) {
+TEST_P(WritePacketTest, BodyIfDataWithStreamId) {
     p_.header.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
     p_.fields.stream_id   = 0xABABABAB;
     std::array<uint32_t, 3> body{};
@@ -109,7 +118,7 @@ TEST_F(WritePacketTest, BodyIfDataWithStreamId) {
     body[2]       = 0xDEDEDEDE;
     p_.words_body = body.size();
     p_.body       = body.data();
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 5, true), 5);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 5, true), 5);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x10000005));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xCECECECE));
@@ -118,7 +127,7 @@ TEST_F(WritePacketTest, BodyIfDataWithStreamId) {
     ASSERT_EQ(Hex(buf_[5]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, BodyExtDataWithoutStreamId) {
+TEST_P(WritePacketTest, BodyExtDataWithoutStreamId) {
     p_.header.packet_type = VRT_PT_EXT_DATA_WITHOUT_STREAM_ID;
     std::array<uint32_t, 3> body{};
     body[0]       = 0xCECECECE;
@@ -126,7 +135,7 @@ TEST_F(WritePacketTest, BodyExtDataWithoutStreamId) {
     body[2]       = 0xDEDEDEDE;
     p_.words_body = body.size();
     p_.body       = body.data();
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 4, true), 4);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 4, true), 4);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x20000004));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xCECECECE));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xFEFEFEFE));
@@ -134,7 +143,7 @@ TEST_F(WritePacketTest, BodyExtDataWithoutStreamId) {
     ASSERT_EQ(Hex(buf_[4]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, BodyExtDataWithStreamId) {
+TEST_P(WritePacketTest, BodyExtDataWithStreamId) {
     p_.header.packet_type = VRT_PT_EXT_DATA_WITH_STREAM_ID;
     p_.fields.stream_id   = 0xABABABAB;
     std::array<uint32_t, 3> body{};
@@ -143,7 +152,7 @@ TEST_F(WritePacketTest, BodyExtDataWithStreamId) {
     body[2]       = 0xDEDEDEDE;
     p_.words_body = body.size();
     p_.body       = body.data();
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 5, true), 5);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 5, true), 5);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x30000005));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xCECECECE));
@@ -152,7 +161,7 @@ TEST_F(WritePacketTest, BodyExtDataWithStreamId) {
     ASSERT_EQ(Hex(buf_[5]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, BodyIfContext) {
+TEST_P(WritePacketTest, BodyIfContext) {
     p_.header.packet_type = VRT_PT_IF_CONTEXT;
     p_.fields.stream_id   = 0xABABABAB;
     std::array<uint32_t, 3> body{};
@@ -161,14 +170,14 @@ TEST_F(WritePacketTest, BodyIfContext) {
     body[2]       = 0xDEDEDEDE;
     p_.words_body = body.size();
     p_.body       = body.data();
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x40000003));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, BodyExtContext) {
+TEST_P(WritePacketTest, BodyExtContext) {
     p_.header.packet_type = VRT_PT_EXT_CONTEXT;
     p_.fields.stream_id   = 0xABABABAB;
     std::array<uint32_t, 3> body{};
@@ -177,7 +186,7 @@ TEST_F(WritePacketTest, BodyExtContext) {
     body[2]       = 0xDEDEDEDE;
     p_.words_body = body.size();
     p_.body       = body.data();
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 5, true), 5);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 5, true), 5);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x50000005));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xCECECECE));
@@ -186,124 +195,124 @@ TEST_F(WritePacketTest, BodyExtContext) {
     ASSERT_EQ(Hex(buf_[5]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, TrailerIfDataWithoutStreamId) {
+TEST_P(WritePacketTest, TrailerIfDataWithoutStreamId) {
     p_.header.packet_type      = VRT_PT_IF_DATA_WITHOUT_STREAM_ID;
     p_.header.has.trailer      = true;
     p_.trailer.has.sample_loss = true;
     p_.trailer.sample_loss     = true;
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x04000002));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x01001000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, TrailerIfDataWithStreamId) {
+TEST_P(WritePacketTest, TrailerIfDataWithStreamId) {
     p_.header.packet_type      = VRT_PT_IF_DATA_WITH_STREAM_ID;
     p_.fields.stream_id        = 0xABABABAB;
     p_.header.has.trailer      = true;
     p_.trailer.has.sample_loss = true;
     p_.trailer.sample_loss     = true;
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x14000003));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x01001000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, TrailerExtDataWithoutStreamId) {
+TEST_P(WritePacketTest, TrailerExtDataWithoutStreamId) {
     p_.header.packet_type      = VRT_PT_EXT_DATA_WITHOUT_STREAM_ID;
     p_.header.has.trailer      = true;
     p_.trailer.has.sample_loss = true;
     p_.trailer.sample_loss     = true;
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 2, true), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x24000002));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x01001000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, TrailerExtDataWithStreamId) {
+TEST_P(WritePacketTest, TrailerExtDataWithStreamId) {
     p_.header.packet_type      = VRT_PT_EXT_DATA_WITH_STREAM_ID;
     p_.fields.stream_id        = 0xABABABAB;
     p_.header.has.trailer      = true;
     p_.trailer.has.sample_loss = true;
     p_.trailer.sample_loss     = true;
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 3, true), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x34000003));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x01001000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, TrailerIfContext) {
+TEST_P(WritePacketTest, TrailerIfContext) {
     p_.header.packet_type      = VRT_PT_IF_CONTEXT;
     p_.fields.stream_id        = 0xABABABAB;
     p_.header.has.trailer      = true;
     p_.trailer.has.sample_loss = true;
     p_.trailer.sample_loss     = true;
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 3, true), VRT_ERR_TRAILER_IN_CONTEXT);
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 3, true), VRT_ERR_TRAILER_IN_CONTEXT);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x44000003));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, TrailerExtContext) {
+TEST_P(WritePacketTest, TrailerExtContext) {
     p_.header.packet_type      = VRT_PT_EXT_CONTEXT;
     p_.fields.stream_id        = 0xABABABAB;
     p_.header.has.trailer      = true;
     p_.trailer.has.sample_loss = true;
     p_.trailer.sample_loss     = true;
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 2, true), VRT_ERR_TRAILER_IN_CONTEXT);
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 2, true), VRT_ERR_TRAILER_IN_CONTEXT);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 2, false), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x54000002));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, ValidationBodyBufferSize) {
+TEST_P(WritePacketTest, ValidationBodyBufferSize) {
     p_.header.packet_count = static_cast<vrt_packet_type>(3);
     p_.words_body          = 5;
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 1, true), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 1, true), VRT_ERR_BUFFER_SIZE);
 }
 
-TEST_F(WritePacketTest, ValidationHeader) {
+TEST_P(WritePacketTest, ValidationHeader) {
     p_.header.packet_count = static_cast<vrt_packet_type>(0xFF);
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 1, true), VRT_ERR_BOUNDS_PACKET_COUNT);
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 1, false), 1);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 1, true), VRT_ERR_BOUNDS_PACKET_COUNT);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 1, false), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x000F0001));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, ValidationFields) {
+TEST_P(WritePacketTest, ValidationFields) {
     p_.header.tsf                          = VRT_TSF_REAL_TIME;
     p_.fields.fractional_seconds_timestamp = 0xFFFFFFFFFFFFFFFF;
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 3, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 3, true), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 3, false), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00200003));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFFFFFFFF));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xFFFFFFFF));
     ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, ValidationTrailer) {
+TEST_P(WritePacketTest, ValidationTrailer) {
     p_.header.has.trailer                          = true;
     p_.trailer.has.associated_context_packet_count = true;
     p_.trailer.associated_context_packet_count     = 0xFF;
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 2, true), VRT_ERR_BOUNDS_ASSOCIATED_CONTEXT_PACKET_COUNT);
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 2, true), VRT_ERR_BOUNDS_ASSOCIATED_CONTEXT_PACKET_COUNT);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 2, false), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x04000002));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x000000FF));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, ValidationIfContext) {
+TEST_P(WritePacketTest, ValidationIfContext) {
     p_.header.packet_type         = VRT_PT_IF_CONTEXT;
     p_.fields.stream_id           = 0xABABABAB;
     p_.if_context.has.sample_rate = true;
     p_.if_context.sample_rate     = -1.0;
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 5, true), VRT_ERR_BOUNDS_SAMPLE_RATE);
-    ASSERT_EQ(vrt_write_packet(&p_, buf_.data(), 5, false), 5);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 5, true), VRT_ERR_BOUNDS_SAMPLE_RATE);
+    ASSERT_EQ(write_packet(&p_, buf_.data(), 5, false), 5);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x40000005));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00200000));
@@ -312,7 +321,7 @@ TEST_F(WritePacketTest, ValidationIfContext) {
     ASSERT_EQ(Hex(buf_[5]), Hex(0xBAADF00D));
 }
 
-TEST_F(WritePacketTest, ValidationBoundsPacketSize) {
+TEST_P(WritePacketTest, ValidationBoundsPacketSize) {
     /* Use heap allocated vectors instead here to avoid stack overflow */
     std::vector<uint32_t> buf_big;
     buf_big.resize(std::numeric_limits<uint16_t>::max() + 100);
@@ -322,5 +331,27 @@ TEST_F(WritePacketTest, ValidationBoundsPacketSize) {
     p_.header.packet_type = VRT_PT_EXT_CONTEXT;
     p_.words_body         = body.size();
     p_.body               = body.data();
-    ASSERT_EQ(vrt_write_packet(&p_, buf_big.data(), buf_big.size(), true), VRT_ERR_BOUNDS_PACKET_SIZE);
+    ASSERT_EQ(write_packet(&p_, buf_big.data(), buf_big.size(), true), VRT_ERR_BOUNDS_PACKET_SIZE);
 }
+
+TEST_P(WritePacketTest, BodyInNetworkOrder) {
+    p_.header.packet_type        = VRT_PT_IF_DATA_WITHOUT_STREAM_ID;
+    std::array<uint32_t, 2> body = {};
+    body[0]                      = 0x01020304;
+    body[1]                      = 0x0A0B0C0D;
+    p_.words_body                = body.size();
+    p_.body                      = body.data();
+    /* Body already in network order is copied verbatim, only the header is swapped */
+    ASSERT_EQ(vrt_write_packet_be(&p_, buf_.data(), buf_.size(), true, false), 3);
+    swap_to_network_order(&buf_);
+    ASSERT_EQ(Hex(buf_[0]), Hex(0x00000003));
+    swap_to_network_order(&buf_);
+    ASSERT_EQ(Hex(buf_[1]), Hex(0x01020304));
+    ASSERT_EQ(Hex(buf_[2]), Hex(0x0A0B0C0D));
+    ASSERT_EQ(Hex(buf_[3]), Hex(0xBAADF00D));
+}
+
+INSTANTIATE_TEST_SUITE_P(ByteOrders,
+                         WritePacketTest,
+                         ::testing::Values(ByteOrder::HOST, ByteOrder::NETWORK),
+                         byte_order_name);
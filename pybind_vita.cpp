@@ -1,9 +1,32 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h> 
+#include <pybind11/numpy.h>
+#include <pybind11/complex.h>
 #include "vita_socket.cpp"  // Include your existing C++ code
 
 namespace py = pybind11;
 
+static py::array_t<float> toFloat32(const std::vector<float>& values) {
+    return py::array_t<float>(values.size(), values.data());
+}
+
+// Wraps a stream view in a read-only numpy array that keeps the underlying block alive.
+// Decimated streams hold complex64, otherwise the view is the raw payload bytes.
+static py::array viewToArray(const SampleView& view) {
+    auto* owner = new std::shared_ptr<const StreamBuffer::Block>(view.block);
+    py::capsule keep_alive(owner, [](void* p) { delete static_cast<std::shared_ptr<const StreamBuffer::Block>*>(p); });
+    py::array array;
+    if (view.complex64) {
+        size_t count = view.bytes / sizeof(std::complex<float>);
+        array = py::array_t<std::complex<float>>({count}, {sizeof(std::complex<float>)},
+                                                 reinterpret_cast<const std::complex<float>*>(view.data), keep_alive);
+    } else {
+        array = py::array_t<uint8_t>({view.bytes}, {sizeof(uint8_t)}, view.data, keep_alive);
+    }
+    array.attr("setflags")(py::arg("write") = false);
+    return array;
+}
+
 PYBIND11_MODULE(vita_socket, m) {
     m.doc() = "Python bindings for Vita Socket using pybind11";
 
@@ -16,11 +39,143 @@ PYBIND11_MODULE(vita_socket, m) {
     //     .def("hasContextPacket", &VitaStream::hasContextPacket)
     //     .def("getFrequency", &VitaStream::getFrequency);
 
-    py::class_<VitaStream>(m, "VitaStream")
+    py::class_<StreamStats>(m, "StreamStats")
+        .def_readonly("stream_id", &StreamStats::stream_id)
+        .def_readonly("samples", &StreamStats::samples)
+        .def_readonly("rms_dbfs", &StreamStats::rms_dbfs)
+        .def_readonly("dc_i", &StreamStats::dc_i)
+        .def_readonly("dc_q", &StreamStats::dc_q)
+        .def_readonly("peak_magnitude", &StreamStats::peak_magnitude)
+        .def_readonly("clipping_percent", &StreamStats::clipping_percent)
+        .def_readonly("over_range_count", &StreamStats::over_range_count)
+        .def_readonly("over_range_packets", &StreamStats::over_range_packets);
+
+    py::class_<ContextCacheStats>(m, "ContextCacheStats")
+        .def_readonly("stream_id", &ContextCacheStats::stream_id)
+        .def_readonly("hits", &ContextCacheStats::hits)
+        .def_readonly("misses", &ContextCacheStats::misses);
+
+    py::class_<StreamLatency>(m, "StreamLatency")
+        .def_readonly("stream_id", &StreamLatency::stream_id)
+        .def_readonly("packets", &StreamLatency::packets)
+        .def_readonly("last_arrival_ns", &StreamLatency::last_arrival_ns)
+        .def_readonly("transport_mean", &StreamLatency::transport_mean)
+        .def_readonly("transport_max", &StreamLatency::transport_max)
+        .def_readonly("queueing_mean", &StreamLatency::queueing_mean)
+        .def_readonly("queueing_max", &StreamLatency::queueing_max);
+
+    py::class_<SocketStats>(m, "SocketStats")
+        .def_readonly("source_id", &SocketStats::source_id)
+        .def_readonly("description", &SocketStats::description)
+        .def_readonly("reads", &SocketStats::reads)
+        .def_readonly("bytes", &SocketStats::bytes)
+        .def_readonly("kernel_drops", &SocketStats::kernel_drops)
+        .def_readonly("receive_buffer_bytes", &SocketStats::receive_buffer_bytes);
+
+    py::class_<ThreadPlacement>(m, "ThreadPlacement")
+        .def_readonly("role", &ThreadPlacement::role)
+        .def_readonly("index", &ThreadPlacement::index)
+        .def_readonly("tid", &ThreadPlacement::tid)
+        .def_readonly("cpus", &ThreadPlacement::cpus)
+        .def_readonly("cpu", &ThreadPlacement::cpu)
+        .def_readonly("numa_node", &ThreadPlacement::numa_node)
+        .def_readonly("memory_node", &ThreadPlacement::memory_node)
+        .def_readonly("policy", &ThreadPlacement::policy)
+        .def_readonly("priority", &ThreadPlacement::priority)
+        .def_readonly("errors", &ThreadPlacement::errors);
+
+    py::class_<ArenaStats>(m, "ArenaStats")
+        .def_readonly("mode", &ArenaStats::mode)
+        .def_readonly("prefault", &ArenaStats::prefault)
+        .def_readonly("lock", &ArenaStats::lock)
+        .def_readonly("cache_limit", &ArenaStats::cache_limit)
+        .def_readonly("mapped_bytes", &ArenaStats::mapped_bytes)
+        .def_readonly("cached_bytes", &ArenaStats::cached_bytes)
+        .def_readonly("hugetlb_regions", &ArenaStats::hugetlb_regions)
+        .def_readonly("thp_regions", &ArenaStats::thp_regions)
+        .def_readonly("fallbacks", &ArenaStats::fallbacks)
+        .def_readonly("cache_hits", &ArenaStats::cache_hits)
+        .def_readonly("lock_failures", &ArenaStats::lock_failures);
+
+    // The arena is shared by every socket in the process
+    m.def("configureArena", [](const std::string& mode, bool prefault, bool lock, size_t cache_mb) {
+              Arena::instance().configure(Arena::parseMode(mode), prefault, lock, cache_mb * 1024 * 1024);
+          },
+          py::arg("mode") = "thp", py::arg("prefault") = false, py::arg("lock") = false, py::arg("cache_mb") = 0);
+    m.def("getArenaStats", []() { return Arena::instance().getStats(); });
+
+    py::class_<StreamMemoryStats>(m, "StreamMemoryStats")
+        .def_readonly("stream_id", &StreamMemoryStats::stream_id)
+        .def_readonly("priority", &StreamMemoryStats::priority)
+        .def_readonly("min_retention_seconds", &StreamMemoryStats::min_retention_seconds)
+        .def_readonly("bytes_buffered", &StreamMemoryStats::bytes_buffered)
+        .def_readonly("bytes_allocated", &StreamMemoryStats::bytes_allocated)
+        .def_readonly("bytes_evicted", &StreamMemoryStats::bytes_evicted)
+        .def_readonly("seconds_buffered", &StreamMemoryStats::seconds_buffered)
+        .def_readonly("seconds_since_read", &StreamMemoryStats::seconds_since_read);
+
+    py::class_<VitaStream, std::shared_ptr<VitaStream>>(m, "VitaStream")
         .def(py::init<int, size_t>()) // Assuming you want to expose the max_packets parameter to Python as well
         .def("addPacket", &VitaStream::addPacket)
         .def("getPacketData", &VitaStream::getPacketData)
+        .def("drainPacketData", [](VitaStream& self) {
+            SampleView view = self.drainPacketData();
+            return py::make_tuple(viewToArray(view), view.start.integer_seconds, view.start.picoseconds);
+        })
+        .def("readInto", [](VitaStream& self, py::array out, size_t max_samples) {
+            // complex64 arrays get converted samples, any other dtype receives the raw 32 bit words
+            if (!(out.flags() & py::array::c_style)) {
+                throw std::runtime_error("readInto requires a C contiguous array");
+            }
+            bool as_complex64 = py::isinstance<py::array_t<std::complex<float>>>(out);
+            size_t out_bytes = out.nbytes();
+            void* data = out.mutable_data();
+            py::gil_scoped_release release;
+            return self.readInto(data, out_bytes, max_samples, as_complex64);
+        }, py::arg("out"), py::arg("max_samples") = std::numeric_limits<size_t>::max())
+        .def("getSamples", [](const VitaStream& self, double t_start, double t_end) {
+            SampleView view = self.getSamples(t_start, t_end);
+            return py::make_tuple(viewToArray(view), view.start.integer_seconds, view.start.picoseconds);
+        }, py::arg("t_start"), py::arg("t_end"))
+        .def("getTimeRange", &VitaStream::getTimeRange)
+        .def("getSampleCount", &VitaStream::getSampleCount)
+        .def("isComplex64", &VitaStream::isComplex64)
         .def("getStreamID", &VitaStream::getStreamID)
+        .def("setDecimation", &VitaStream::setDecimation, py::arg("factor"),
+             py::arg("taps") = std::vector<float>(), py::arg("frequency_shift") = 0.0)
+        .def("getDecimation", &VitaStream::getDecimation)
+        .def("setSpectrum", &VitaStream::setSpectrum, py::arg("fft_size"), py::arg("overlap") = 0.5,
+             py::arg("alpha") = 0.1, py::arg("block_count") = 0)
+        .def("getSpectrum", [](const VitaStream& self) { return toFloat32(self.getSpectrum()); })
+        .def("setCapture", &VitaStream::setCapture, py::arg("enabled"), py::arg("threshold_db") = 10.0,
+             py::arg("pre_seconds") = 0.01, py::arg("post_seconds") = 0.01, py::arg("floor_alpha") = 0.01)
+        .def("isCapturing", &VitaStream::isCapturing)
+        .def("getNoiseFloor", &VitaStream::getNoiseFloor)
+        .def("getCaptures", [](VitaStream& self) {
+            std::vector<Capture> captures;
+            {
+                py::gil_scoped_release release;
+                captures = self.getCaptures();
+            }
+            py::list result;
+            for (const auto& capture : captures) {
+                py::array_t<std::complex<float>> samples(capture.samples.size(), capture.samples.data());
+                // Untimestamped streams have no start time, given as None
+                py::object seconds = capture.timed ? py::object(py::int_(capture.start.integer_seconds)) : py::none();
+                py::object picoseconds = capture.timed ? py::object(py::int_(capture.start.picoseconds)) : py::none();
+                result.append(py::make_tuple(samples, seconds, picoseconds, capture.sample_rate, capture.peak_dbfs));
+            }
+            return result;
+        })
+        .def("getStats", &VitaStream::getStats, py::arg("reset") = true)
+        .def("getLatency", &VitaStream::getLatency, py::arg("reset") = true)
+        .def("getContextCacheStats", &VitaStream::getContextCacheStats, py::arg("reset") = true)
+        .def("setPriority", &VitaStream::setPriority, py::arg("priority"))
+        .def("getPriority", &VitaStream::getPriority)
+        .def("setMinRetention", &VitaStream::setMinRetention, py::arg("seconds"))
+        .def("getMinRetention", &VitaStream::getMinRetention)
+        .def("getMemoryStats", &VitaStream::getMemoryStats)
+        .def("isRetired", &VitaStream::isRetired)
         .def("getSampleRate", &VitaStream::getSampleRate) // No change needed here
         .def("hasContextPacket", &VitaStream::hasContextPacket)
         .def("getFrequency", &VitaStream::getFrequency);
@@ -30,11 +185,64 @@ PYBIND11_MODULE(vita_socket, m) {
         .def(py::init<int, bool>())
         .def("stop_vita_socket", &VitaSocket::stop_vita_socket)
         .def("getStreamIDs", &VitaSocket::getStreamIDs)
-        .def("getStream", &VitaSocket::getStream, py::return_value_policy::reference)
+        .def("getStream", &VitaSocket::getStream)
+        .def("getSpectrum", [](VitaSocket& self, int stream_id) { return toFloat32(self.getSpectrum(stream_id)); },
+             py::arg("stream_id"))
+        .def("setIdleTimeout", &VitaSocket::setIdleTimeout, py::arg("seconds"))
+        .def("getIdleTimeout", &VitaSocket::getIdleTimeout)
+        .def("getRetiredStreamIDs", &VitaSocket::getRetiredStreamIDs)
+        .def("getAligned", [](VitaSocket& self, const std::vector<int>& stream_ids, double t_start, size_t n_samples,
+                              py::object out) {
+            // Returns (array, uncovered stream IDs), filling out in place when one is given
+            py::array_t<std::complex<float>, py::array::c_style> rows;
+            if (out.is_none()) {
+                rows = py::array_t<std::complex<float>, py::array::c_style>({stream_ids.size(), n_samples});
+            } else {
+                if (!py::isinstance<py::array_t<std::complex<float>, py::array::c_style>>(out)) {
+                    throw std::runtime_error("getAligned requires a C contiguous complex64 array");
+                }
+                rows = out.cast<py::array_t<std::complex<float>, py::array::c_style>>();
+                if (rows.ndim() != 2 || static_cast<size_t>(rows.shape(0)) != stream_ids.size() ||
+                    static_cast<size_t>(rows.shape(1)) != n_samples) {
+                    throw std::runtime_error("getAligned output must have shape [len(stream_ids), n_samples]");
+                }
+            }
+            std::complex<float>* data = rows.mutable_data();
+            std::vector<int> uncovered;
+            {
+                py::gil_scoped_release release;
+                uncovered = self.getAligned(stream_ids, t_start, n_samples, data);
+            }
+            return py::make_tuple(rows, uncovered);
+        }, py::arg("stream_ids"), py::arg("t_start"), py::arg("n_samples"), py::arg("out") = py::none())
+        .def("setMemoryBudget", &VitaSocket::setMemoryBudget, py::arg("bytes"))
+        .def("getMemoryBudget", &VitaSocket::getMemoryBudget)
+        .def("getMemoryUsage", &VitaSocket::getMemoryUsage)
+        .def("getStats", &VitaSocket::getStats, py::arg("reset") = true)
+        .def("getMemoryStats", &VitaSocket::getMemoryStats)
         .def("join", &VitaSocket::join)
         .def("run_tcp", &VitaSocket::run_tcp, py::arg("host"), py::arg("port"))
         .def("run_udp", &VitaSocket::run_udp, py::arg("host"), py::arg("port"))
-        .def("run_multicast", &VitaSocket::run_multicast, py::arg("host"), py::arg("port"));
+        .def("run_multicast", &VitaSocket::run_multicast, py::arg("host"), py::arg("port"))
+        .def("startEventLoop", &VitaSocket::startEventLoop, py::arg("io_threads") = 2)
+        .def("addTcpSource", &VitaSocket::addTcpSource, py::arg("host"), py::arg("port"))
+        .def("addUdpSource", &VitaSocket::addUdpSource, py::arg("host"), py::arg("port"))
+        .def("addMulticastSource", &VitaSocket::addMulticastSource, py::arg("group"), py::arg("port"))
+        .def("removeSource", &VitaSocket::removeSource, py::arg("source_id"))
+        .def("getSourceIDs", &VitaSocket::getSourceIDs)
+        .def("setThreadAffinity", &VitaSocket::setThreadAffinity, py::arg("role"), py::arg("cpus"))
+        .def("setRealtimePriority", &VitaSocket::setRealtimePriority, py::arg("priority"))
+        .def("setNumaNode", &VitaSocket::setNumaNode, py::arg("node"))
+        .def("getThreadPlacement", &VitaSocket::getThreadPlacement)
+        .def("setReceiveBuffer", &VitaSocket::setReceiveBuffer, py::arg("bytes"), py::arg("force") = false)
+        .def("setBusyPoll", &VitaSocket::setBusyPoll, py::arg("microseconds"))
+        .def("setMulticastAll", &VitaSocket::setMulticastAll, py::arg("enabled"))
+        .def("setMulticastInterface", &VitaSocket::setMulticastInterface, py::arg("interface"))
+        .def("setKernelTimestamps", &VitaSocket::setKernelTimestamps, py::arg("enabled"))
+        .def("getSocketStats", &VitaSocket::getSocketStats)
+        .def("getLatency", &VitaSocket::getLatency, py::arg("reset") = true)
+        .def("setContextCache", &VitaSocket::setContextCache, py::arg("enabled"))
+        .def("getContextCacheStats", &VitaSocket::getContextCacheStats, py::arg("reset") = true);
 
     // m.def("addPacketToStream", &addPacketToStream);
     // m.def("getStreamIDs", &getStreamIDs);
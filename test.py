@@ -52,6 +52,9 @@ def main():
 
         for stream_id in vita_socket.getStreamIDs():
             stream = vita_socket.getStream(stream_id)
+            if stream is None:
+                # Retired since getStreamIDs
+                continue
 
             if stream.hasContextPacket():
                 sample_rate = stream.getSampleRate()
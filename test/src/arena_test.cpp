@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "vita_socket.cpp"
+
+/* Restores the process wide arena configuration after each test */
+class ArenaTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        saved_  = arena_.getStats();
+        mapped_ = saved_.mapped_bytes;
+    }
+
+    void TearDown() override {
+        arena_.configure(Arena::parseMode(saved_.mode), saved_.prefault, saved_.lock, saved_.cache_limit);
+    }
+
+    static constexpr size_t bytes = 3 * Arena::huge_page;
+
+    Arena&     arena_ = Arena::instance();
+    ArenaStats saved_{};
+    size_t     mapped_ = 0;
+};
+
+TEST_F(ArenaTest, UnmappedByDefault) {
+    arena_.deallocate(arena_.allocate(bytes), bytes);
+    ASSERT_EQ(arena_.getStats().mapped_bytes, mapped_);
+}
+
+TEST_F(ArenaTest, Cached) {
+    arena_.configure(Arena::parseMode(saved_.mode), false, false, 8 * Arena::huge_page);
+    arena_.deallocate(arena_.allocate(bytes), bytes);
+    ASSERT_EQ(arena_.getStats().cached_bytes, bytes);
+    ASSERT_EQ(arena_.getStats().mapped_bytes, mapped_ + bytes);
+    uint64_t hits = arena_.getStats().cache_hits;
+    arena_.deallocate(arena_.allocate(bytes), bytes);
+    ASSERT_EQ(arena_.getStats().cache_hits, hits + 1);
+}
+
+TEST_F(ArenaTest, Uncached) {
+    arena_.configure(Arena::parseMode(saved_.mode), false, false, 8 * Arena::huge_page);
+    void* kept  = arena_.allocate(bytes);
+    void* freed = arena_.allocate(bytes);
+    arena_.deallocate(kept, bytes);
+    {
+        Arena::Uncached uncached;
+        arena_.deallocate(freed, bytes);
+    }
+    /* Only the region freed in the scope is unmapped, the one cached before stays */
+    ASSERT_EQ(arena_.getStats().cached_bytes, bytes);
+    ASSERT_EQ(arena_.getStats().mapped_bytes, mapped_ + bytes);
+}
+
+TEST_F(ArenaTest, RetireKeepsOtherStreamsCached) {
+    std::vector<uint32_t> body(100, 0x00100010);
+    vrt_packet_view       view{};
+    vrt_init_header(&view.header);
+    vrt_init_fields(&view.fields);
+    vrt_init_trailer(&view.trailer);
+    view.header.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    view.body               = body.data();
+    view.words_body         = static_cast<int32_t>(body.size());
+    vrt_packet context;
+    vrt_init_packet(&context);
+    context.header.packet_type         = VRT_PT_IF_CONTEXT;
+    context.if_context.has.sample_rate = true;
+    context.if_context.sample_rate     = 1e6;
+    VitaStream stream(1);
+    stream.addPacket(context);
+    for (int i = 0; i < 100000 && stream.getAllocatedBytes() < Arena::huge_page; i++) {
+        stream.addPacket(view);
+    }
+    ASSERT_GE(stream.getAllocatedBytes(), Arena::huge_page);
+
+    arena_.configure(Arena::parseMode(saved_.mode), false, false, 64 * Arena::huge_page);
+    size_t mapped = arena_.getStats().mapped_bytes;
+    arena_.deallocate(arena_.allocate(bytes), bytes);
+    stream.retire();
+    ASSERT_EQ(arena_.getStats().cached_bytes, bytes);
+    ASSERT_LT(arena_.getStats().mapped_bytes, mapped + bytes);
+}
+
+TEST_F(ArenaTest, SmallOnHeap) {
+    void* small = arena_.allocate(64);
+    ASSERT_EQ(arena_.getStats().mapped_bytes, mapped_);
+    arena_.deallocate(small, 64);
+    ASSERT_EQ(arena_.getStats().mapped_bytes, mapped_);
+}
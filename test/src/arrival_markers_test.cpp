@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "vita_socket.cpp"
+
+class ArrivalMarkersTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        for (size_t i = 1; i <= 1000; i++) {
+            arrivals_.add(i * 100, static_cast<int64_t>(i));
+        }
+    }
+
+    ArrivalMarkers arrivals_;
+};
+
+TEST_F(ArrivalMarkersTest, At) {
+    ASSERT_EQ(arrivals_.at(1), 1);
+    ASSERT_EQ(arrivals_.at(100), 1);
+    ASSERT_EQ(arrivals_.at(101), 2);
+    ASSERT_EQ(arrivals_.at(100000), 1000);
+    ASSERT_EQ(arrivals_.at(100001), 0);
+}
+
+TEST_F(ArrivalMarkersTest, Erase) {
+    arrivals_.erase(250);
+    ASSERT_EQ(arrivals_.at(1), 3);
+    ASSERT_EQ(arrivals_.at(50), 3);
+    ASSERT_EQ(arrivals_.at(51), 4);
+}
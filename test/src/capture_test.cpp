@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "vita_socket.cpp"
+
+class CaptureTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vrt_init_packet(&context_);
+        context_.header.packet_type         = VRT_PT_IF_CONTEXT;
+        context_.if_context.has.sample_rate = true;
+        context_.if_context.sample_rate     = 1000;
+    }
+
+    /* Untimestamped int16 I/Q data packet with every sample set to word */
+    vrt_packet_view data(uint32_t word) {
+        std::fill(body_.begin(), body_.end(), word);
+        vrt_packet_view view{};
+        vrt_init_header(&view.header);
+        vrt_init_fields(&view.fields);
+        vrt_init_trailer(&view.trailer);
+        view.header.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
+        view.body               = body_.data();
+        view.words_body         = static_cast<int32_t>(body_.size());
+        return view;
+    }
+
+    static constexpr uint32_t quiet = 0x00100010;
+    static constexpr uint32_t loud  = 0x40004000;
+
+    vrt_packet            context_{};
+    std::vector<uint32_t> body_ = std::vector<uint32_t>(100);
+};
+
+TEST_F(CaptureTest, Untimestamped) {
+    VitaStream stream(1);
+    stream.addPacket(context_);
+    stream.setCapture(true, 10, 0.1, 0.2, 0.1);
+    for (int i = 0; i < 5; i++) {
+        stream.addPacket(data(quiet));
+    }
+    stream.addPacket(data(loud));
+    ASSERT_TRUE(stream.isCapturing());
+
+    for (int i = 0; i < 3; i++) {
+        stream.addPacket(data(quiet));
+    }
+    std::vector<Capture> captures = stream.getCaptures();
+    ASSERT_FALSE(stream.isCapturing());
+    ASSERT_EQ(captures.size(), 1);
+    ASSERT_FALSE(captures[0].timed);
+    /* 100 pre-trigger, the loud packet and 200 post-trigger samples */
+    ASSERT_EQ(captures[0].samples.size(), 400);
+}
+
+TEST_F(CaptureTest, DrainBlocked) {
+    VitaStream stream(1);
+    stream.addPacket(context_);
+    stream.setCapture(true, 10, 0.1, 0.2, 0.1);
+    for (int i = 0; i < 5; i++) {
+        stream.addPacket(data(quiet));
+    }
+    stream.addPacket(data(loud));
+    ASSERT_TRUE(stream.isCapturing());
+
+    std::vector<uint8_t> out(body_.size() * sizeof(uint32_t));
+    ASSERT_EQ(stream.readInto(out.data(), out.size(), body_.size(), false), 0);
+    ASSERT_EQ(stream.drainPacketData().bytes, 0);
+}
@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <vrt/vrt_write.h>
+
+#include "vita_socket.cpp"
+
+class ContextCacheTest : public ::testing::Test {
+   protected:
+    static vrt_packet context(double sample_rate) {
+        vrt_packet packet;
+        vrt_init_packet(&packet);
+        packet.header.packet_type         = VRT_PT_IF_CONTEXT;
+        packet.if_context.has.sample_rate = true;
+        packet.if_context.sample_rate     = sample_rate;
+        return packet;
+    }
+
+    /* Reads a context through the stream's cache and applies it. Returns true if it was decoded. */
+    bool read_context(double sample_rate) {
+        vrt_packet               packet = context(sample_rate);
+        std::array<uint32_t, 16> words{};
+        vrt_packet_desc          desc{};
+        bool                     changed = true;
+        EXPECT_GE(vrt_write_packet(&packet, words.data(), words.size(), true), 0);
+        EXPECT_GE(vrt_peek_packet(words.data(), words.size(), &desc, true), 0);
+        EXPECT_GE(stream_.readContext(words.data(), desc, &packet, &changed), 0);
+        stream_.addPacket(packet, 0, changed);
+        return changed;
+    }
+
+    VitaStream stream_{2};
+};
+
+TEST_F(ContextCacheTest, Hit) {
+    ASSERT_TRUE(read_context(1000));
+    ASSERT_FALSE(read_context(1000));
+    ASSERT_EQ(stream_.getSampleRate(), 1000);
+}
+
+TEST_F(ContextCacheTest, ResetByUncachedContext) {
+    ASSERT_TRUE(read_context(1000));
+    stream_.addPacket(context(2000));
+    ASSERT_EQ(stream_.getSampleRate(), 2000);
+    ASSERT_TRUE(read_context(1000));
+    ASSERT_EQ(stream_.getSampleRate(), 1000);
+}
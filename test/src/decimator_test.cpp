@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#include "vita_socket.cpp"
+
+/* n samples of a complex tone at frequency Hz, sampled at rate */
+static std::vector<std::complex<float>> tone(double frequency, double rate, size_t n) {
+    std::vector<std::complex<float>> x(n);
+    for (size_t i = 0; i < n; ++i) {
+        double theta = 2.0 * M_PI * frequency * static_cast<double>(i) / rate;
+        x[i]         = std::complex<float>(static_cast<float>(std::cos(theta)), static_cast<float>(std::sin(theta)));
+    }
+    return x;
+}
+
+TEST(Decimator, ImpulseResponse) {
+    const std::vector<float>         taps = {1, 2, 3, 4, 5};
+    std::vector<std::complex<float>> impulse(12);
+    impulse[0] = {1.0f, -1.0f};
+
+    Decimator                        decimator(1, taps, 0, 1000);
+    std::vector<std::complex<float>> out;
+    decimator.process(impulse.data(), impulse.size(), out);
+    ASSERT_EQ(out.size(), impulse.size());
+    for (size_t i = 0; i < out.size(); ++i) {
+        float expected = i < taps.size() ? taps[i] : 0.0f;
+        ASSERT_EQ(out[i], std::complex<float>(expected, -expected)) << "sample " << i;
+    }
+    ASSERT_DOUBLE_EQ(decimator.getGroupDelay(), 2.0);
+}
+
+TEST(Decimator, KeepsEveryFactorthOutput) {
+    const std::vector<float>         taps = {1, 2, 3, 4, 5};
+    std::vector<std::complex<float>> impulse(12);
+    impulse[0] = 1.0f;
+
+    /* Fed one sample at a time, so the phase has to carry over between calls */
+    Decimator                        decimator(3, taps, 0, 1000);
+    std::vector<std::complex<float>> out;
+    for (const auto& sample : impulse) {
+        decimator.process(&sample, 1, out);
+    }
+    const std::vector<std::complex<float>> expected = {1.0f, 4.0f, 0.0f, 0.0f};
+    ASSERT_EQ(out, expected);
+    ASSERT_EQ(decimator.getPhase(), 0);
+}
+
+TEST(Decimator, ShiftsToneToDC) {
+    const double rate   = 1000;
+    const int    factor = 4;
+    const size_t n      = 4000;
+
+    /* The shift mixes a tone at +100 Hz down to DC, where the default low-pass passes it at unit gain */
+    Decimator                        decimator(factor, {}, 100, rate);
+    std::vector<std::complex<float>> x = tone(100, rate, n);
+    std::vector<std::complex<float>> out;
+    decimator.process(x.data(), x.size(), out);
+    ASSERT_EQ(out.size(), n / factor);
+    ASSERT_EQ(decimator.getFactor(), factor);
+    ASSERT_DOUBLE_EQ(decimator.getFrequencyShift(), 100);
+    for (size_t i = 100; i < out.size(); ++i) {
+        ASSERT_NEAR(out[i].real(), 1.0, 1e-3) << "sample " << i;
+        ASSERT_NEAR(out[i].imag(), 0.0, 1e-3) << "sample " << i;
+    }
+}
+
+TEST(Decimator, RejectsToneOutsideOutputBand) {
+    const double rate   = 1000;
+    const int    factor = 4;
+    const size_t n      = 4000;
+
+    /* Shifted to -200 Hz, beyond the 125 Hz output Nyquist, so it would alias without the filter */
+    Decimator                        decimator(factor, {}, 100, rate);
+    std::vector<std::complex<float>> x = tone(-100, rate, n);
+    std::vector<std::complex<float>> out;
+    decimator.process(x.data(), x.size(), out);
+    ASSERT_EQ(out.size(), n / factor);
+    for (size_t i = 100; i < out.size(); ++i) {
+        ASSERT_LT(std::abs(out[i]), 0.01) << "sample " << i;
+    }
+}
+
+TEST(Decimator, Stream) {
+    vrt_packet context;
+    vrt_init_packet(&context);
+    context.header.packet_type                    = VRT_PT_IF_CONTEXT;
+    context.if_context.has.sample_rate            = true;
+    context.if_context.sample_rate                = 1000;
+    context.if_context.has.if_reference_frequency = true;
+    context.if_context.if_reference_frequency     = 1e6;
+
+    /* int16 I/Q, a quarter of full scale on I */
+    std::vector<uint32_t> body(400, 0x20000000);
+    vrt_packet_view       data{};
+    vrt_init_header(&data.header);
+    vrt_init_fields(&data.fields);
+    vrt_init_trailer(&data.trailer);
+    data.header.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    data.body               = body.data();
+    data.words_body         = static_cast<int32_t>(body.size());
+
+    VitaStream stream(1);
+    stream.addPacket(context);
+    stream.setDecimation(4, {}, 100);
+    ASSERT_EQ(stream.getDecimation(), 4);
+    ASSERT_EQ(stream.getSampleRate(), 250);
+    ASSERT_DOUBLE_EQ(stream.getFrequency(), 1e6 + 100);
+    ASSERT_TRUE(stream.isComplex64());
+
+    stream.addPacket(data);
+    ASSERT_EQ(stream.getSampleCount(), 100);
+    ASSERT_FLOAT_EQ(stream.getSecondsOfData(), 100.0f / 250);
+
+    /* Back to the wire rate and format */
+    stream.setDecimation(1, {}, 0);
+    ASSERT_EQ(stream.getDecimation(), 1);
+    ASSERT_EQ(stream.getSampleRate(), 1000);
+    ASSERT_DOUBLE_EQ(stream.getFrequency(), 1e6);
+    ASSERT_FALSE(stream.isComplex64());
+    ASSERT_EQ(stream.getSampleCount(), 0);
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include <vrt/vrt_write.h>
+
+#include "vita_socket.cpp"
+
+/*
+ * Listens on an ephemeral port that stays bound until VitaSocket has connected to it as a TCP source, and sends
+ * network order packets over the accepted connection.
+ */
+class EventLoopTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        int listener = socket(AF_INET, SOCK_STREAM, 0);
+        ASSERT_GE(listener, 0);
+        struct sockaddr_in address{};
+        address.sin_family      = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length        = sizeof(address);
+        ASSERT_EQ(bind(listener, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)), 0);
+        ASSERT_EQ(listen(listener, 1), 0);
+        ASSERT_EQ(getsockname(listener, reinterpret_cast<struct sockaddr*>(&address), &length), 0);
+
+        vita_socket_.addTcpSource("127.0.0.1", ntohs(address.sin_port));
+        sender_ = accept(listener, nullptr, nullptr);
+        close(listener);
+        ASSERT_GE(sender_, 0);
+    }
+
+    void TearDown() override {
+        if (sender_ >= 0) {
+            close(sender_);
+        }
+    }
+
+    /* Data packet of stream 7, with the samples given in host order */
+    static vrt_packet data(std::array<uint32_t, 4>& samples) {
+        vrt_packet packet;
+        vrt_init_packet(&packet);
+        packet.header.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
+        packet.fields.stream_id   = 7;
+        packet.body               = samples.data();
+        packet.words_body         = samples.size();
+        return packet;
+    }
+
+    static vrt_packet context() {
+        vrt_packet packet;
+        vrt_init_packet(&packet);
+        packet.header.packet_type         = VRT_PT_IF_CONTEXT;
+        packet.fields.stream_id           = 7;
+        packet.if_context.has.sample_rate = true;
+        packet.if_context.sample_rate     = 1000;
+        return packet;
+    }
+
+    void send_packet(const vrt_packet& packet) {
+        std::array<uint32_t, 16> words{};
+        int32_t                  n = vrt_write_packet_be(&packet, words.data(), words.size(), true, true);
+        ASSERT_GT(n, 0);
+        ssize_t bytes = static_cast<ssize_t>(n * sizeof(uint32_t));
+        ASSERT_EQ(send(sender_, words.data(), bytes, 0), bytes);
+    }
+
+    /* Waits up to a second for stream 7 to satisfy done */
+    template <typename Done>
+    bool wait_for(Done done) {
+        for (int i = 0; i < 100; i++) {
+            std::shared_ptr<VitaStream> stream = vita_socket_.getStream(7);
+            if (stream && done(*stream)) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return false;
+    }
+
+    VitaSocket vita_socket_{2048};
+    int        sender_ = -1;
+};
+
+/* A lone context packet far below 40 words is parsed as soon as it arrives */
+TEST_F(EventLoopTest, SmallTrailingPacket) {
+    /* Context packets only go to known streams, so a small data packet opens the stream first */
+    std::array<uint32_t, 4> samples{};
+    send_packet(data(samples));
+    send_packet(context());
+    ASSERT_TRUE(wait_for([](const VitaStream& stream) { return stream.hasContextPacket(); }));
+}
+
+/* Packets are read in place from the receive buffer, and only the stored payload is swapped to host order */
+TEST_F(EventLoopTest, NetworkOrderPayload) {
+    std::array<uint32_t, 4> samples = {0x00010002, 0x7FFF8000, 0x12345678, 0xFEDCBA98};
+    send_packet(data(samples));
+    send_packet(context());
+    send_packet(data(samples));
+    ASSERT_TRUE(wait_for([](const VitaStream& stream) { return stream.getSampleCount() == 4; }));
+
+    std::array<uint32_t, 4>     stored{};
+    std::shared_ptr<VitaStream> stream = vita_socket_.getStream(7);
+    ASSERT_EQ(stream->readInto(stored.data(), sizeof(stored), stored.size(), false), stored.size());
+    ASSERT_EQ(stored, samples);
+}
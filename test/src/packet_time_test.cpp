@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "vita_socket.cpp"
+
+class PacketTimeTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vrt_init_packet(&context_);
+        context_.header.packet_type         = VRT_PT_IF_CONTEXT;
+        context_.if_context.has.sample_rate = true;
+        context_.if_context.sample_rate     = 1000;
+    }
+
+    /* int16 I/Q data packet of 100 samples, every sample set to word, timestamped with tsf and fractional */
+    vrt_packet_view data(vrt_tsf tsf, uint64_t fractional, uint32_t word) {
+        std::fill(body_.begin(), body_.end(), word);
+        vrt_packet_view view{};
+        vrt_init_header(&view.header);
+        vrt_init_fields(&view.fields);
+        vrt_init_trailer(&view.trailer);
+        view.header.packet_type                  = VRT_PT_IF_DATA_WITH_STREAM_ID;
+        view.header.tsi                          = VRT_TSI_UTC;
+        view.header.tsf                          = tsf;
+        view.fields.integer_seconds_timestamp    = 100;
+        view.fields.fractional_seconds_timestamp = fractional;
+        view.body                                = body_.data();
+        view.words_body                          = static_cast<int32_t>(body_.size());
+        return view;
+    }
+
+    vrt_packet            context_{};
+    std::vector<uint32_t> body_ = std::vector<uint32_t>(100);
+};
+
+TEST_F(PacketTimeTest, SampleCount) {
+    VitaStream stream(1);
+    stream.addPacket(context_);
+    for (uint32_t i = 0; i < 5; i++) {
+        stream.addPacket(data(VRT_TSF_SAMPLE_COUNT, i * 100, i));
+    }
+
+    SampleView view = stream.getSamples(100.1, 100.3);
+    ASSERT_EQ(view.bytes, 200 * sizeof(uint32_t));
+    ASSERT_EQ(view.start.integer_seconds, 100);
+    ASSERT_EQ(view.start.picoseconds, 100000000000);
+    uint32_t first;
+    uint32_t last;
+    std::memcpy(&first, view.data, sizeof(first));
+    std::memcpy(&last, view.data + view.bytes - sizeof(last), sizeof(last));
+    ASSERT_EQ(first, 1);
+    ASSERT_EQ(last, 2);
+
+    std::pair<double, double> range = stream.getTimeRange();
+    ASSERT_DOUBLE_EQ(range.first, 100.0);
+    ASSERT_DOUBLE_EQ(range.second, 100.5);
+}
+
+TEST_F(PacketTimeTest, SampleCountWithoutSampleRate) {
+    context_.if_context.has.sample_rate = false;
+    context_.if_context.sample_rate     = 0;
+    VitaStream stream(1);
+    stream.addPacket(context_);
+    for (uint32_t i = 0; i < 5; i++) {
+        stream.addPacket(data(VRT_TSF_SAMPLE_COUNT, i * 100, i));
+    }
+
+    ASSERT_EQ(stream.getSamples(100.0, 101.0).bytes, 0);
+    ASSERT_EQ(stream.getTimeRange(), std::make_pair(0.0, 0.0));
+}
+
+TEST_F(PacketTimeTest, FreeRunning) {
+    VitaStream stream(1);
+    stream.addPacket(context_);
+    for (uint32_t i = 0; i < 5; i++) {
+        stream.addPacket(data(VRT_TSF_FREE_RUNNING_COUNT, i * 100, i));
+    }
+
+    /* The samples are buffered, but a free-running count is not a time of day */
+    ASSERT_EQ(stream.getSamples(100.0, 101.0).bytes, 0);
+    ASSERT_EQ(stream.getTimeRange(), std::make_pair(0.0, 0.0));
+    ASSERT_EQ(stream.drainPacketData().bytes, 500 * sizeof(uint32_t));
+}
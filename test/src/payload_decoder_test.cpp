@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <complex>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "vita_socket.cpp"
+
+/* A payload format, words in that format and the normalized samples they hold */
+struct PayloadCase {
+    std::string                      name;
+    vrt_packing_method               packing;
+    vrt_real_complex                 real_or_complex;
+    vrt_data_item_format             data_item_format;
+    int                              item_bits;
+    int                              field_bits;
+    std::vector<uint32_t>            words;
+    std::vector<std::complex<float>> expected;
+};
+
+/* Names the case in failure messages, instead of dumping its bytes */
+static void PrintTo(const PayloadCase& c, std::ostream* os) {
+    *os << c.name;
+}
+
+static vrt_data_packet_payload_format payloadFormat(const PayloadCase& c) {
+    vrt_packet packet;
+    vrt_init_packet(&packet);
+    vrt_data_packet_payload_format format = packet.if_context.data_packet_payload_format;
+    format.packing_method                 = c.packing;
+    format.real_or_complex                = c.real_or_complex;
+    format.data_item_format               = c.data_item_format;
+    format.data_item_size                 = static_cast<uint8_t>(c.item_bits - 1);
+    format.item_packing_field_size        = static_cast<uint8_t>(c.field_bits - 1);
+    return format;
+}
+
+static const vrt_packing_method   PE    = VRT_PM_PROCESSING_EFFICIENT;
+static const vrt_packing_method   LE    = VRT_PM_LINK_EFFICIENT;
+static const vrt_real_complex     RE    = VRT_ROC_REAL;
+static const vrt_real_complex     CX    = VRT_ROC_COMPLEX_CARTESIAN;
+static const vrt_data_item_format FIXED = VRT_DIF_SIGNED_FIXED_POINT;
+static const vrt_data_item_format FLOAT = VRT_DIF_IEEE_754_SINGLE_PRECISION_FLOATING_POINT;
+
+static const std::vector<PayloadCase> cases = {
+    {"Int16Complex", PE, CX, FIXED, 16, 16, {0x4000C000, 0x7FFF8000}, {{0.5f, -0.5f}, {32767.0f / 32768, -1.0f}}},
+    {"Int8Complex", PE, CX, FIXED, 8, 8, {0x40C07F80}, {{0.5f, -0.5f}, {127.0f / 128, -1.0f}}},
+    {"Int8Real", PE, RE, FIXED, 8, 8, {0x40C07F80}, {{0.5f, 0}, {-0.5f, 0}, {127.0f / 128, 0}, {-1.0f, 0}}},
+    /* Items in the top 12 bits of 16 bit fields */
+    {"Int12In16Complex", PE, CX, FIXED, 12, 16, {0x4000C000, 0x7FF08000}, {{0.5f, -0.5f}, {2047.0f / 2048, -1.0f}}},
+    /* Two fields per word, the low 8 bits unused */
+    {"Int12Complex", PE, CX, FIXED, 12, 12, {0x400C00FF, 0x7FF800FF}, {{0.5f, -0.5f}, {2047.0f / 2048, -1.0f}}},
+    /* 400 C00 7FF 800 200 E00 001 FFF, the second and fifth items straddle a word boundary */
+    {"Int12LinkEfficientComplex",
+     LE,
+     CX,
+     FIXED,
+     12,
+     12,
+     {0x400C007F, 0xF800200E, 0x00001FFF},
+     {{0.5f, -0.5f}, {2047.0f / 2048, -1.0f}, {0.25f, -0.25f}, {1.0f / 2048, -1.0f / 2048}}},
+    {"Int32Real", PE, RE, FIXED, 32, 32, {0x40000000, 0x80000000}, {{0.5f, 0}, {-1.0f, 0}}},
+    /* 0.25, -0.75 and 1.5 */
+    {"Float32Complex", PE, CX, FLOAT, 32, 32, {0x3E800000, 0xBF400000}, {{0.25f, -0.75f}}},
+    {"Float32Real", PE, RE, FLOAT, 32, 32, {0x3E800000, 0x3FC00000}, {{0.25f, 0}, {1.5f, 0}}},
+};
+
+class PayloadDecoderTest : public ::testing::TestWithParam<PayloadCase> {};
+
+INSTANTIATE_TEST_SUITE_P(Formats,
+                         PayloadDecoderTest,
+                         ::testing::ValuesIn(cases),
+                         [](const ::testing::TestParamInfo<PayloadCase>& param_info) { return param_info.param.name; });
+
+TEST_P(PayloadDecoderTest, Decode) {
+    const PayloadCase& c       = GetParam();
+    PayloadDecoder     decoder = selectPayloadDecoder(payloadFormat(c));
+    ASSERT_NE(decoder.decode, nullptr);
+    ASSERT_EQ(decoder.count(c.words.size()), c.expected.size());
+    ASSERT_EQ(decoder.native, c.name == "Int16Complex");
+
+    std::vector<std::complex<float>> out(c.expected.size() + 1, {9.0f, 9.0f});
+    ASSERT_EQ(decoder.decode(c.words.data(), c.words.size(), out.data()), c.expected.size());
+    for (size_t i = 0; i < c.expected.size(); ++i) {
+        ASSERT_EQ(out[i], c.expected[i]) << "sample " << i;
+    }
+    ASSERT_EQ(out.back(), std::complex<float>(9.0f, 9.0f));
+}
+
+TEST_P(PayloadDecoderTest, Stream) {
+    const PayloadCase& c = GetParam();
+    vrt_packet         context;
+    vrt_init_packet(&context);
+    context.header.packet_type                        = VRT_PT_IF_CONTEXT;
+    context.if_context.has.sample_rate                = true;
+    context.if_context.sample_rate                    = 1000;
+    context.if_context.has.data_packet_payload_format = true;
+    context.if_context.data_packet_payload_format     = payloadFormat(c);
+
+    std::vector<uint32_t> body = c.words;
+    vrt_packet_view       data{};
+    vrt_init_header(&data.header);
+    vrt_init_fields(&data.fields);
+    vrt_init_trailer(&data.trailer);
+    data.header.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    data.body               = body.data();
+    data.words_body         = static_cast<int32_t>(body.size());
+
+    VitaStream stream(1);
+    stream.addPacket(context);
+    stream.addPacket(data);
+
+    /* Retained duration counts stored samples, int16 I/Q words or complex64 */
+    size_t samples = c.expected.size();
+    ASSERT_EQ(stream.isComplex64(), c.name != "Int16Complex");
+    ASSERT_EQ(stream.getSampleCount(), samples);
+    StreamMemoryStats stats = stream.getMemoryStats();
+    ASSERT_EQ(stats.bytes_buffered, samples * (stream.isComplex64() ? sizeof(std::complex<float>) : sizeof(uint32_t)));
+    ASSERT_FLOAT_EQ(stats.seconds_buffered, static_cast<float>(samples) / 1000);
+    ASSERT_FLOAT_EQ(stream.getSecondsOfData(), static_cast<float>(samples) / 1000);
+
+    std::vector<std::complex<float>> out(samples);
+    ASSERT_EQ(stream.readInto(out.data(), out.size() * sizeof(out[0]), samples, true), samples);
+    ASSERT_EQ(out, c.expected);
+}
+
+TEST(PayloadDecoder, Unsupported) {
+    PayloadCase c{"", PE, CX, FIXED, 24, 32, {}, {}};
+    ASSERT_EQ(selectPayloadDecoder(payloadFormat(c)).decode, nullptr);
+    c.real_or_complex = VRT_ROC_COMPLEX_POLAR;
+    c.item_bits       = 16;
+    c.field_bits      = 16;
+    ASSERT_EQ(selectPayloadDecoder(payloadFormat(c)).decode, nullptr);
+    c.real_or_complex  = CX;
+    c.data_item_format = VRT_DIF_UNSIGNED_FIXED_POINT;
+    ASSERT_EQ(selectPayloadDecoder(payloadFormat(c)).decode, nullptr);
+    c.data_item_format = VRT_DIF_IEEE_754_DOUBLE_PRECISION_FLOATING_POINT;
+    c.item_bits        = 64;
+    c.field_bits       = 64;
+    ASSERT_EQ(selectPayloadDecoder(payloadFormat(c)).decode, nullptr);
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "vita_socket.cpp"
+
+/* Direct O(n^2) DFT in double precision, the reference the FFT is checked against */
+static std::vector<std::complex<double>> dft(const std::vector<std::complex<float>>& x) {
+    size_t                            n = x.size();
+    std::vector<std::complex<double>> y(n);
+    for (size_t k = 0; k < n; ++k) {
+        for (size_t i = 0; i < n; ++i) {
+            double theta = -2.0 * M_PI * static_cast<double>((k * i) % n) / static_cast<double>(n);
+            y[k] += std::complex<double>(x[i]) * std::complex<double>(std::cos(theta), std::sin(theta));
+        }
+    }
+    return y;
+}
+
+/* Complex tone of the given amplitude centred on bin k of an n point FFT */
+static std::vector<std::complex<float>> tone(size_t n, size_t k, double amplitude, size_t samples) {
+    std::vector<std::complex<float>> x(samples);
+    for (size_t i = 0; i < samples; ++i) {
+        double theta = 2.0 * M_PI * static_cast<double>((k * i) % n) / static_cast<double>(n);
+        x[i]         = std::complex<float>(static_cast<float>(amplitude * std::cos(theta)),
+                                   static_cast<float>(amplitude * std::sin(theta)));
+    }
+    return x;
+}
+
+/* Sizes with an even log2 only take radix-4 passes, odd ones end with a radix-2 pass */
+class FFTTest : public ::testing::TestWithParam<size_t> {};
+
+INSTANTIATE_TEST_SUITE_P(Sizes, FFTTest, ::testing::Values(2, 4, 8, 16, 32, 64, 128, 256, 1024, 2048));
+
+TEST_P(FFTTest, MatchesDFT) {
+    size_t                                n = GetParam();
+    std::mt19937                          rng(1);
+    std::uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+    std::vector<std::complex<float>>      x(n);
+    for (auto& value : x) {
+        value = std::complex<float>(uniform(rng), uniform(rng));
+    }
+
+    std::vector<std::complex<double>> expected = dft(x);
+    FFT                               fft(n);
+    fft.forward(x.data());
+    for (size_t k = 0; k < n; ++k) {
+        ASSERT_NEAR(x[k].real(), expected[k].real(), 1e-5 * static_cast<double>(n)) << "bin " << k;
+        ASSERT_NEAR(x[k].imag(), expected[k].imag(), 1e-5 * static_cast<double>(n)) << "bin " << k;
+    }
+}
+
+TEST(FFT, InvalidSize) {
+    ASSERT_THROW(FFT(0), std::runtime_error);
+    ASSERT_THROW(FFT(1), std::runtime_error);
+    ASSERT_THROW(FFT(48), std::runtime_error);
+}
+
+TEST(SpectrumEstimator, BinCentredTone) {
+    const size_t n = 256;
+    const size_t k = 32;
+    /* Half of full scale, so the tone reads 20 * log10(0.5) dBFS */
+    const double amplitude = 0.5;
+    const float  expected  = static_cast<float>(20.0 * std::log10(amplitude));
+
+    SpectrumEstimator estimator(n, 0.0, 1.0, 0);
+    ASSERT_TRUE(estimator.getLatest().empty());
+    std::vector<std::complex<float>> x = tone(n, k, amplitude, n);
+    estimator.add(x.data(), x.size());
+    ASSERT_EQ(estimator.getFrameCount(), 1);
+
+    /* DC is in the middle, so bin k is at n / 2 + k */
+    const std::vector<float>& psd  = estimator.getLatest();
+    size_t                    peak = std::max_element(psd.begin(), psd.end()) - psd.begin();
+    ASSERT_EQ(psd.size(), n);
+    ASSERT_EQ(peak, n / 2 + k);
+    ASSERT_NEAR(psd[peak], expected, 0.01);
+    /* The Hann window's neighbours are 6 dB down and the rest is leakage free */
+    ASSERT_NEAR(psd[peak - 1], expected + 20.0f * std::log10(0.5f), 0.01);
+    ASSERT_NEAR(psd[peak + 1], expected + 20.0f * std::log10(0.5f), 0.01);
+    ASSERT_LT(psd[peak + 2], expected - 80.0f);
+}
+
+TEST(SpectrumEstimator, BlockAverage) {
+    const size_t n = 64;
+
+    SpectrumEstimator                estimator(n, 0.5, 1.0, 3);
+    std::vector<std::complex<float>> x = tone(n, 4, 1.0, 2 * n);
+    estimator.add(x.data(), x.size());
+    /* Frames start every n / 2 samples, so 2n samples give three frames and one full block */
+    ASSERT_EQ(estimator.getFrameCount(), 3);
+    ASSERT_EQ(estimator.getLatest().size(), n);
+    ASSERT_NEAR(estimator.getLatest()[n / 2 + 4], 0.0, 0.01);
+}
+
+class SpectrumTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vrt_init_packet(&context_);
+        context_.header.packet_type         = VRT_PT_IF_CONTEXT;
+        context_.if_context.has.sample_rate = true;
+        context_.if_context.sample_rate     = 1000;
+    }
+
+    /* Untimestamped int16 I/Q data packet holding the tone */
+    vrt_packet_view data(const std::vector<std::complex<float>>& x) {
+        body_.resize(x.size());
+        for (size_t i = 0; i < x.size(); ++i) {
+            auto re  = static_cast<int16_t>(std::lrint(x[i].real() * 32768.0f));
+            auto im  = static_cast<int16_t>(std::lrint(x[i].imag() * 32768.0f));
+            body_[i] = (static_cast<uint32_t>(static_cast<uint16_t>(re)) << 16) | static_cast<uint16_t>(im);
+        }
+        vrt_packet_view view{};
+        vrt_init_header(&view.header);
+        vrt_init_fields(&view.fields);
+        vrt_init_trailer(&view.trailer);
+        view.header.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
+        view.body               = body_.data();
+        view.words_body         = static_cast<int32_t>(body_.size());
+        return view;
+    }
+
+    vrt_packet            context_{};
+    std::vector<uint32_t> body_;
+};
+
+TEST_F(SpectrumTest, ReferenceLevelAndGain) {
+    const size_t n = 64;
+    const size_t k = 8;
+    context_.if_context.has.reference_level = true;
+    context_.if_context.reference_level     = -10.0f;
+    context_.if_context.has.gain            = true;
+    context_.if_context.gain.stage1         = 20.0f;
+    context_.if_context.gain.stage2         = 5.0f;
+
+    VitaStream stream(1);
+    stream.addPacket(context_);
+    stream.setSpectrum(n, 0.0, 1.0, 0);
+    ASSERT_TRUE(stream.getSpectrum().empty());
+    stream.addPacket(data(tone(n, k, 0.5, n)));
+
+    /* dBFS + reference level - both gain stages */
+    std::vector<float> psd  = stream.getSpectrum();
+    size_t             peak = std::max_element(psd.begin(), psd.end()) - psd.begin();
+    ASSERT_EQ(psd.size(), n);
+    ASSERT_EQ(peak, n / 2 + k);
+    ASSERT_NEAR(psd[peak], 20.0 * std::log10(0.5) - 10.0 - 25.0, 0.01);
+
+    stream.setSpectrum(0, 0.0, 1.0, 0);
+    ASSERT_TRUE(stream.getSpectrum().empty());
+}
@@ -9,8 +9,32 @@
 #include <string>
 #include <cstring>
 #include <atomic>
+#include <algorithm>
+#include <complex>
+#include <deque>
+#include <array>
+#include <memory>
+#include <cmath>
+#include <chrono>
 #include <time.h>
-
+#include <cerrno>
+#include <limits>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <net/if.h>
+#include <sys/syscall.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+
+#if defined(__AVX__) || defined(__SSE__)
+#include <immintrin.h>
+#endif
+
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_init.h>
 #include <vrt/vrt_read.h>
 #include <vrt/vrt_string.h>
 #include <vrt/vrt_types.h>
@@ -18,141 +42,2531 @@
 
 
 
-class VitaStream {
+// Counters of the ingest buffer arena
+struct ArenaStats {
+    std::string mode;
+    bool prefault;
+    bool lock;
+    size_t cache_limit;       // Freed bytes kept mapped before regions are returned to the kernel, 0 keeps none
+    size_t mapped_bytes;      // Bytes of mapped regions, live and cached
+    size_t cached_bytes;      // Bytes of freed regions kept for reuse
+    uint64_t hugetlb_regions; // Regions mapped from the hugetlbfs pool
+    uint64_t thp_regions;     // Regions mapped with MADV_HUGEPAGE
+    uint64_t fallbacks;       // Huge page requests that fell back to normal pages
+    uint64_t cache_hits;
+    uint64_t lock_failures;
+};
+
+// Backing memory for the ingest buffers. Allocations of at least a huge page are mmapped in 2 MB multiples so the
+// kernel can back them with huge pages; smaller ones stay on the heap and never touch the arena's lock. With a cache
+// limit configured, freed regions of up to that many bytes are kept and handed out again to a request of the same
+// length, so a buffer that grows back does not fault its pages in a second time. By default nothing is kept.
+class Arena {
 public:
-    VitaStream(int id, size_t max_seconds = 30) : stream_id(id), max_seconds(max_seconds) {
-        packet_data.reserve(100000);
+    enum class Mode { Pages, TransparentHugePages, HugeTLB };
+
+    static constexpr size_t huge_page = 2 * 1024 * 1024;
+
+    static Arena& instance() {
+        static Arena arena;
+        return arena;
     }
 
-    VitaStream(const VitaStream&) = delete;
-    VitaStream& operator=(const VitaStream&) = delete;
-    VitaStream(VitaStream&&) = delete;
-    VitaStream& operator=(VitaStream&&) = delete;
+    // Mode applies to regions mapped from now on, the cache is flushed so they are not mixed with older ones
+    void configure(Mode mode, bool prefault, bool lock, size_t cache_limit) {
+        std::lock_guard<std::mutex> guard(mutex);
+        this->mode = mode;
+        this->prefault = prefault;
+        this->lock = lock;
+        this->cache_limit = cache_limit;
+        _trim(0);
+    }
 
-    void addPacket(const vrt_packet& packet) {
-        std::lock_guard<std::mutex> lock(stream_mutex);
-        if (packet.header.packet_type == VRT_PT_IF_CONTEXT) {
-            context_packet = packet;
+    void* allocate(size_t bytes) {
+        if (bytes < huge_page) {
+            return ::operator new(bytes);
+        }
+        size_t length = (bytes + huge_page - 1) / huge_page * huge_page;
+        std::lock_guard<std::mutex> guard(mutex);
+        auto cached = cache.find(length);
+        if (cached != cache.end()) {
+            void* region = cached->second;
+            cache.erase(cached);
+            cached_bytes -= length;
+            cache_hits++;
+            regions[region] = length;
+            return region;
+        }
+        void* region = _map(length);
+        regions[region] = length;
+        mapped_bytes += length;
+        return region;
+    }
+
+    // bytes must be what was passed to allocate, it tells heap allocations from mapped regions without the lock
+    void deallocate(void* p, size_t bytes) {
+        if (p == nullptr) {
+            return;
+        }
+        if (bytes < huge_page) {
+            ::operator delete(p);
+            return;
+        }
+        std::lock_guard<std::mutex> guard(mutex);
+        auto region = regions.find(p);
+        if (region == regions.end()) {
+            return;
+        }
+        size_t length = region->second;
+        regions.erase(region);
+        if (length > cache_limit || _uncached() > 0) {
+            munmap(p, length);
+            mapped_bytes -= length;
+            return;
+        }
+        cache.emplace(length, p);
+        cached_bytes += length;
+        _trim(cache_limit);
+    }
+
+    // Returns every cached region to the kernel, live ones are not affected
+    ArenaStats getStats() {
+        std::lock_guard<std::mutex> guard(mutex);
+        static const char* names[] = {"pages", "thp", "hugetlb"};
+        return ArenaStats{names[static_cast<int>(mode)], prefault, lock, cache_limit, mapped_bytes, cached_bytes,
+                          hugetlb_regions, thp_regions, fallbacks, cache_hits, lock_failures};
+    }
+
+    static Mode parseMode(const std::string& name) {
+        if (name == "pages") {
+            return Mode::Pages;
+        }
+        if (name == "thp") {
+            return Mode::TransparentHugePages;
+        }
+        if (name == "hugetlb") {
+            return Mode::HugeTLB;
+        }
+        throw std::runtime_error("Unknown arena mode " + name + ", expected pages, thp or hugetlb");
+    }
+
+    // While one is alive, regions freed on the same thread are unmapped instead of cached. Lets a retiring stream hand
+    // its own memory back without flushing what other streams have cached.
+    class Uncached {
+    public:
+        Uncached() {
+            _uncached()++;
+        }
+
+        ~Uncached() {
+            _uncached()--;
+        }
+
+        Uncached(const Uncached&) = delete;
+        Uncached& operator=(const Uncached&) = delete;
+    };
+
+private:
+    std::mutex mutex;
+    Mode mode = Mode::TransparentHugePages;
+    bool prefault = false;
+    bool lock = false;
+    size_t cache_limit = 0;
+    // Live mapped regions by address, freed ones by length
+    std::map<void*, size_t> regions;
+    std::multimap<size_t, void*> cache;
+    size_t mapped_bytes = 0;
+    size_t cached_bytes = 0;
+    uint64_t hugetlb_regions = 0;
+    uint64_t thp_regions = 0;
+    uint64_t fallbacks = 0;
+    uint64_t cache_hits = 0;
+    uint64_t lock_failures = 0;
+
+    // Regions are never unmapped on the way out, the process is ending and buffers may still be in flight
+    Arena() = default;
+
+    void* _map(size_t length) {
+        void* region = MAP_FAILED;
+        if (mode == Mode::HugeTLB) {
+            // Needs reserved pages in /proc/sys/vm/nr_hugepages, MAP_POPULATE faults them in at once
+            region = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (prefault ? MAP_POPULATE : 0), -1, 0);
+            if (region != MAP_FAILED) {
+                hugetlb_regions++;
+            } else {
+                fallbacks++;
+            }
+        }
+        if (region == MAP_FAILED) {
+            // Over-mapped by one huge page and trimmed, THP only backs 2 MB aligned ranges
+            void* raw = mmap(nullptr, length + huge_page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (raw == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+            uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+            uintptr_t aligned = (start + huge_page - 1) & ~(uintptr_t)(huge_page - 1);
+            if (aligned > start) {
+                munmap(raw, aligned - start);
+            }
+            if (aligned < start + huge_page) {
+                munmap(reinterpret_cast<void*>(aligned + length), start + huge_page - aligned);
+            }
+            region = reinterpret_cast<void*>(aligned);
+            if (mode != Mode::Pages) {
+                // THP may be disabled or set to never, the region then simply keeps normal pages
+                if (madvise(region, length, MADV_HUGEPAGE) == 0) {
+                    thp_regions++;
+                } else if (mode == Mode::TransparentHugePages) {
+                    fallbacks++;
+                }
+            }
+            if (prefault) {
+                // Touched after madvise so the faults can be served with huge pages
+                volatile uint8_t* bytes = static_cast<uint8_t*>(region);
+                for (size_t offset = 0; offset < length; offset += 4096) {
+                    bytes[offset] = 0;
+                }
+            }
+        }
+        if (lock && mlock(region, length) != 0) {
+            lock_failures++;
+        }
+        return region;
+    }
+
+    static int& _uncached() {
+        static thread_local int depth = 0;
+        return depth;
+    }
+
+    void _trim(size_t limit) {
+        while (cached_bytes > limit && !cache.empty()) {
+            // Largest regions go first, they are the least likely to be asked for again
+            auto largest = std::prev(cache.end());
+            munmap(largest->second, largest->first);
+            cached_bytes -= largest->first;
+            mapped_bytes -= largest->first;
+            cache.erase(largest);
+        }
+    }
+};
+
+// Standard allocator over the arena, lets the ingest containers opt in without changing how they are used
+template <typename T>
+struct ArenaAllocator {
+    using value_type = T;
+
+    ArenaAllocator() = default;
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(Arena::instance().allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t n) {
+        Arena::instance().deallocate(p, n * sizeof(T));
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>&, const ArenaAllocator<U>&) {
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>&, const ArenaAllocator<U>&) {
+    return false;
+}
+
+using ArenaBytes = std::vector<uint8_t, ArenaAllocator<uint8_t>>;
+
+// Byte storage for a stream. Blocks handed out through pin() back zero-copy views, so a pinned block is never
+// reallocated or overwritten in place; the buffer moves its live bytes to a fresh block instead.
+class StreamBuffer {
+public:
+    using Block = ArenaBytes;
+
+    explicit StreamBuffer(size_t reserve) : block(std::make_shared<Block>()) {
+        block->reserve(reserve);
+    }
+
+    void append(const uint8_t* src, size_t n) {
+        if (_pinned() && block->size() + n > block->capacity()) {
+            _detach(0, std::max(block->capacity() * 2, block->size() + n));
+        }
+        block->insert(block->end(), src, src + n);
+    }
+
+    // Drops the oldest n bytes
+    void consume(size_t n) {
+        if (n >= block->size()) {
+            clear();
+        } else if (_pinned()) {
+            _detach(n, block->capacity());
+        } else {
+            block->erase(block->begin(), block->begin() + n);
+        }
+    }
+
+    void clear() {
+        if (_pinned()) {
+            _detach(block->size(), block->capacity());
+        } else {
+            block->clear();
+        }
+    }
+
+    const uint8_t* data() const {
+        return block->data();
+    }
+
+    size_t size() const {
+        return block->size();
+    }
+
+    size_t capacity() const {
+        return block->capacity();
+    }
+
+    // Releases spare capacity, a pinned block is left to its views and the live bytes move to an exact fit
+    void shrink() {
+        if (_pinned()) {
+            _detach(0, block->size());
+        } else {
+            block->shrink_to_fit();
+        }
+    }
+
+    // Drops the block entirely and hands it back, views keep their own reference
+    std::shared_ptr<Block> release() {
+        std::shared_ptr<Block> released = std::make_shared<Block>();
+        std::swap(block, released);
+        return released;
+    }
+
+    std::shared_ptr<const Block> pin() const {
+        return block;
+    }
+
+    // Installs spare as the active block and hands back the filled one, whose bytes now belong to the caller
+    std::shared_ptr<Block> exchange(std::shared_ptr<Block> spare) {
+        spare->clear();
+        std::swap(block, spare);
+        return spare;
+    }
+
+private:
+    std::shared_ptr<Block> block;
+
+    // Pins are only taken under the owning stream's lock, so a stale count can only cause a needless detach
+    bool _pinned() const {
+        return block.use_count() > 1;
+    }
+
+    void _detach(size_t from, size_t capacity) {
+        auto fresh = std::make_shared<Block>();
+        fresh->reserve(capacity);
+        fresh->insert(fresh->end(), block->begin() + from, block->end());
+        block = std::move(fresh);
+    }
+};
+
+// Spare stream blocks. A block handed out by acquire comes back here when its last reference goes away, so a drained
+// buffer is refilled without allocating or faulting in its pages again. Blocks released after the pool is gone are
+// simply freed.
+class BlockPool : public std::enable_shared_from_this<BlockPool> {
+public:
+    using Block = StreamBuffer::Block;
+
+    explicit BlockPool(size_t limit) : limit(limit) {}
+
+    std::shared_ptr<Block> acquire(size_t reserve) {
+        std::unique_ptr<Block> block;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!spares.empty()) {
+                block = std::move(spares.back());
+                spares.pop_back();
+                spare_bytes -= block->capacity();
+            }
+        }
+        if (!block) {
+            block.reset(new Block());
+            block->reserve(reserve);
+        }
+        std::weak_ptr<BlockPool> owner = shared_from_this();
+        return std::shared_ptr<Block>(block.release(), [owner](Block* returned) {
+            std::unique_ptr<Block> held(returned);
+            if (auto pool = owner.lock()) {
+                pool->_recycle(std::move(held));
+            }
+        });
+    }
+
+    size_t spareBytes() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return spare_bytes;
+    }
+
+    // Frees the spares and returns their capacity in bytes
+    size_t clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t released = spare_bytes;
+        spares.clear();
+        spare_bytes = 0;
+        return released;
+    }
+
+private:
+    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<Block>> spares;
+    size_t spare_bytes = 0;
+    size_t limit;
+
+    void _recycle(std::unique_ptr<Block> block) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (spares.size() < limit) {
+            block->clear();
+            spare_bytes += block->capacity();
+            spares.push_back(std::move(block));
+        }
+    }
+};
+
+// VRT timestamp of a single sample, fractional part always in picoseconds
+struct SampleTime {
+    uint32_t integer_seconds;
+    uint64_t picoseconds;
+};
+
+// Sum of a[i] * b[i] and a[i] * c[i] over n floats, n a multiple of 8
+static inline void dotProduct2(const float* a, const float* b, const float* c, size_t n, float& out_b, float& out_c) {
+#if defined(__AVX__)
+    __m256 acc_b = _mm256_setzero_ps();
+    __m256 acc_c = _mm256_setzero_ps();
+    for (size_t i = 0; i < n; i += 8) {
+        __m256 taps = _mm256_loadu_ps(a + i);
+        acc_b = _mm256_add_ps(acc_b, _mm256_mul_ps(taps, _mm256_loadu_ps(b + i)));
+        acc_c = _mm256_add_ps(acc_c, _mm256_mul_ps(taps, _mm256_loadu_ps(c + i)));
+    }
+    __m128 sum_b = _mm_add_ps(_mm256_castps256_ps128(acc_b), _mm256_extractf128_ps(acc_b, 1));
+    __m128 sum_c = _mm_add_ps(_mm256_castps256_ps128(acc_c), _mm256_extractf128_ps(acc_c, 1));
+#elif defined(__SSE__)
+    __m128 sum_b = _mm_setzero_ps();
+    __m128 sum_c = _mm_setzero_ps();
+    for (size_t i = 0; i < n; i += 4) {
+        __m128 taps = _mm_loadu_ps(a + i);
+        sum_b = _mm_add_ps(sum_b, _mm_mul_ps(taps, _mm_loadu_ps(b + i)));
+        sum_c = _mm_add_ps(sum_c, _mm_mul_ps(taps, _mm_loadu_ps(c + i)));
+    }
+#endif
+#if defined(__AVX__) || defined(__SSE__)
+    float lanes_b[4];
+    float lanes_c[4];
+    _mm_storeu_ps(lanes_b, sum_b);
+    _mm_storeu_ps(lanes_c, sum_c);
+    out_b = (lanes_b[0] + lanes_b[1]) + (lanes_b[2] + lanes_b[3]);
+    out_c = (lanes_c[0] + lanes_c[1]) + (lanes_c[2] + lanes_c[3]);
+#else
+    out_b = 0;
+    out_c = 0;
+    for (size_t i = 0; i < n; ++i) {
+        out_b += a[i] * b[i];
+        out_c += a[i] * c[i];
+    }
+#endif
+}
+
+// Running sums over int16 I/Q words for the stream health statistics
+struct SignalAccumulator {
+    uint64_t samples = 0;
+    int64_t sum_i = 0;
+    int64_t sum_q = 0;
+    uint64_t sum_power = 0;
+    uint32_t peak_power = 0;
+    uint64_t clipped = 0;
+};
+
+// One pass adding n words to acc. A sample is clipped when either component sits on a rail.
+static inline void accumulateSignal(const uint32_t* words, size_t n, SignalAccumulator& acc) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i select_i = _mm_set1_epi32(0x00010000);
+    const __m128i select_q = _mm_set1_epi32(0x00000001);
+    const __m128i rail_high = _mm_set1_epi16(32767);
+    const __m128i rail_low = _mm_set1_epi16(-32768);
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i sign = _mm_set1_epi32(INT32_MIN);
+    __m128i power = _mm_setzero_si128();
+    // Biased by the sign bit so a signed compare orders the unsigned squares
+    __m128i peak = sign;
+    while (i + 4 <= n) {
+        // 32 bit lane sums of I, Q and clip counts stay exact for 2^15 iterations
+        size_t block_end = std::min(n - (n - i) % 4, i + (size_t(1) << 17));
+        __m128i sum_i = _mm_setzero_si128();
+        __m128i sum_q = _mm_setzero_si128();
+        __m128i clipped = _mm_setzero_si128();
+        for (; i < block_end; i += 4) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + i));
+            sum_i = _mm_add_epi32(sum_i, _mm_madd_epi16(v, select_i));
+            sum_q = _mm_add_epi32(sum_q, _mm_madd_epi16(v, select_q));
+
+            __m128i squares = _mm_madd_epi16(v, v);
+            power = _mm_add_epi64(power, _mm_unpacklo_epi32(squares, zero));
+            power = _mm_add_epi64(power, _mm_unpackhi_epi32(squares, zero));
+            __m128i biased = _mm_xor_si128(squares, sign);
+            __m128i greater = _mm_cmpgt_epi32(biased, peak);
+            peak = _mm_or_si128(_mm_and_si128(greater, biased), _mm_andnot_si128(greater, peak));
+
+            __m128i rails = _mm_or_si128(_mm_cmpeq_epi16(v, rail_high), _mm_cmpeq_epi16(v, rail_low));
+            // -1 where neither component is on a rail, so adding one counts the clipped words
+            clipped = _mm_add_epi32(clipped, _mm_add_epi32(_mm_cmpeq_epi32(rails, zero), one));
+        }
+
+        int32_t lanes[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), sum_i);
+        acc.sum_i += int64_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), sum_q);
+        acc.sum_q += int64_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), clipped);
+        acc.clipped += uint64_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+    }
+    uint64_t power_lanes[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(power_lanes), power);
+    acc.sum_power += power_lanes[0] + power_lanes[1];
+    uint32_t peak_lanes[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(peak_lanes), _mm_xor_si128(peak, sign));
+    for (uint32_t lane : peak_lanes) {
+        acc.peak_power = std::max(acc.peak_power, lane);
+    }
+#endif
+    for (; i < n; ++i) {
+        int32_t re = static_cast<int16_t>(words[i] >> 16);
+        int32_t im = static_cast<int16_t>(words[i] & 0xFFFF);
+        uint32_t square = static_cast<uint32_t>(re * re) + static_cast<uint32_t>(im * im);
+        acc.sum_i += re;
+        acc.sum_q += im;
+        acc.sum_power += square;
+        acc.peak_power = std::max(acc.peak_power, square);
+        acc.clipped += (re == 32767 || re == -32768 || im == 32767 || im == -32768) ? 1 : 0;
+    }
+    acc.samples += n;
+}
+
+// Same sums for samples decoded from other payload formats, scaled to 16 bit full scale. A sample is clipped when
+// a component reaches rail or -1, the format's most positive and most negative values.
+static inline void accumulateSignal(const std::complex<float>* samples, size_t n, float rail, SignalAccumulator& acc) {
+    for (size_t i = 0; i < n; ++i) {
+        float re_f = samples[i].real();
+        float im_f = samples[i].imag();
+        int32_t re = static_cast<int32_t>(std::lrint(std::max(-32768.0f, std::min(32767.0f, re_f * 32768.0f))));
+        int32_t im = static_cast<int32_t>(std::lrint(std::max(-32768.0f, std::min(32767.0f, im_f * 32768.0f))));
+        uint32_t square = static_cast<uint32_t>(re * re) + static_cast<uint32_t>(im * im);
+        acc.sum_i += re;
+        acc.sum_q += im;
+        acc.sum_power += square;
+        acc.peak_power = std::max(acc.peak_power, square);
+        acc.clipped += (re_f >= rail || re_f <= -1.0f || im_f >= rail || im_f <= -1.0f) ? 1 : 0;
+    }
+    acc.samples += n;
+}
+
+// Payload decoders for the formats a context packet's Data Packet Payload Format field describes. Words are in host
+// order and items are packed most significant first, the data item in the top bits of its field. Processing-efficient
+// fields never straddle a word, link-efficient fields run on across word boundaries.
+using PayloadKernel = size_t (*)(const uint32_t* words, size_t n_words, std::complex<float>* out);
+using PayloadCounter = size_t (*)(size_t n_words);
+
+struct PayloadDecoder {
+    // Null for formats there is no kernel for
+    PayloadKernel decode;
+    PayloadCounter count;
+    // Normalized value of the most positive item, for clip detection
+    float rail;
+    // int16 I/Q in 32 bit words, which streams buffer as is
+    bool native;
+};
+
+template <int FieldBits, bool Complex, bool LinkEfficient>
+static size_t payloadSamples(size_t n_words) {
+    size_t items = LinkEfficient ? n_words * 32 / FieldBits : n_words * (32 / FieldBits);
+    return Complex ? items / 2 : items;
+}
+
+// Item k sign extended from its top ItemBits bits
+template <int ItemBits, int FieldBits, bool LinkEfficient>
+static inline int32_t payloadItem(const uint32_t* words, size_t n_words, size_t k) {
+    uint32_t aligned;
+    if (LinkEfficient) {
+        size_t bit = k * FieldBits;
+        size_t w = bit / 32;
+        uint64_t pair = (static_cast<uint64_t>(words[w]) << 32) | (w + 1 < n_words ? words[w + 1] : 0);
+        aligned = static_cast<uint32_t>((pair << (bit % 32)) >> 32);
+    } else {
+        constexpr size_t per_word = 32 / FieldBits;
+        aligned = words[k / per_word] << ((k % per_word) * FieldBits);
+    }
+    return static_cast<int32_t>(aligned) >> (32 - ItemBits);
+}
+
+template <int ItemBits, int FieldBits, bool Complex, bool LinkEfficient>
+static size_t decodeFixedPoint(const uint32_t* words, size_t n_words, std::complex<float>* out) {
+    const float scale = static_cast<float>(1.0 / static_cast<double>(1ULL << (ItemBits - 1)));
+    size_t samples = payloadSamples<FieldBits, Complex, LinkEfficient>(n_words);
+    for (size_t i = 0; i < samples; ++i) {
+        if (Complex) {
+            out[i] = std::complex<float>(payloadItem<ItemBits, FieldBits, LinkEfficient>(words, n_words, 2 * i) * scale,
+                                         payloadItem<ItemBits, FieldBits, LinkEfficient>(words, n_words, 2 * i + 1) * scale);
         } else {
-            // Given we don't know how much data we have without a sample rate we just wait until we have a context packet
-            if (_hasContextPacket()){
-                auto* bytePtr = static_cast<uint8_t*>(packet.body); // Convert void* to uint8_t*
-                packet_data.insert(packet_data.end(), bytePtr, bytePtr + packet.words_body * 4);
+            out[i] = std::complex<float>(payloadItem<ItemBits, FieldBits, LinkEfficient>(words, n_words, i) * scale, 0);
+        }
+    }
+    return samples;
+}
+
+template <bool Complex>
+static size_t decodeFloat32(const uint32_t* words, size_t n_words, std::complex<float>* out) {
+    size_t samples = payloadSamples<32, Complex, false>(n_words);
+    if (Complex) {
+        std::memcpy(static_cast<void*>(out), words, samples * sizeof(std::complex<float>));
+    } else {
+        for (size_t i = 0; i < samples; ++i) {
+            float value;
+            std::memcpy(&value, words + i, sizeof(value));
+            out[i] = std::complex<float>(value, 0);
+        }
+    }
+    return samples;
+}
+
+template <int ItemBits, int FieldBits, bool Complex, bool LinkEfficient>
+static PayloadDecoder fixedPointDecoder() {
+    float rail = static_cast<float>(1.0 - 1.0 / static_cast<double>(1ULL << (ItemBits - 1)));
+    return {&decodeFixedPoint<ItemBits, FieldBits, Complex, LinkEfficient>,
+            &payloadSamples<FieldBits, Complex, LinkEfficient>, rail, ItemBits == 16 && FieldBits == 16 && Complex};
+}
+
+template <bool Complex, bool LinkEfficient>
+static PayloadDecoder selectFixedPoint(int item_bits, int field_bits) {
+    switch (item_bits * 100 + field_bits) {
+        case 808:
+            return fixedPointDecoder<8, 8, Complex, LinkEfficient>();
+        case 1212:
+            return fixedPointDecoder<12, 12, Complex, LinkEfficient>();
+        case 1216:
+            return fixedPointDecoder<12, 16, Complex, LinkEfficient>();
+        case 1616:
+            return fixedPointDecoder<16, 16, Complex, LinkEfficient>();
+        case 3232:
+            return fixedPointDecoder<32, 32, Complex, LinkEfficient>();
+        default:
+            return {nullptr, nullptr, 1.0f, false};
+    }
+}
+
+static PayloadDecoder selectPayloadDecoder(const vrt_data_packet_payload_format& format) {
+    const PayloadDecoder unsupported{nullptr, nullptr, 1.0f, false};
+    if (format.real_or_complex == VRT_ROC_COMPLEX_POLAR) {
+        return unsupported;
+    }
+    bool complex = format.real_or_complex == VRT_ROC_COMPLEX_CARTESIAN;
+    bool link = format.packing_method == VRT_PM_LINK_EFFICIENT;
+    int item_bits = format.data_item_size + 1;
+    int field_bits = format.item_packing_field_size + 1;
+
+    if (format.data_item_format == VRT_DIF_IEEE_754_SINGLE_PRECISION_FLOATING_POINT) {
+        if (item_bits != 32 || field_bits != 32) {
+            return unsupported;
+        }
+        return complex ? PayloadDecoder{&decodeFloat32<true>, &payloadSamples<32, true, false>, 1.0f, false}
+                       : PayloadDecoder{&decodeFloat32<false>, &payloadSamples<32, false, false>, 1.0f, false};
+    }
+    if (format.data_item_format != VRT_DIF_SIGNED_FIXED_POINT) {
+        return unsupported;
+    }
+    if (complex) {
+        return link ? selectFixedPoint<true, true>(item_bits, field_bits) : selectFixedPoint<true, false>(item_bits, field_bits);
+    }
+    return link ? selectFixedPoint<false, true>(item_bits, field_bits) : selectFixedPoint<false, false>(item_bits, field_bits);
+}
+
+// NCO frequency shift followed by a low-pass FIR that only evaluates the outputs kept after decimation,
+// which is the work a polyphase decimator does
+class Decimator {
+public:
+    // Empty taps design a Hamming windowed sinc with its cutoff just inside the output Nyquist band
+    Decimator(int factor, std::vector<float> taps, double frequency_shift, double input_rate)
+        : factor(std::max(1, factor)), frequency_shift(frequency_shift) {
+        if (taps.empty()) {
+            taps = _designLowPass(this->factor);
+        }
+        tap_count = taps.size();
+
+        // Reverse the taps so each output is a straight dot product with the history, zero padded at the old end
+        size_t padded = (taps.size() + 7) / 8 * 8;
+        reversed_taps.assign(padded - taps.size(), 0.0f);
+        reversed_taps.insert(reversed_taps.end(), taps.rbegin(), taps.rend());
+        history_i.assign(padded - 1, 0.0f);
+        history_q.assign(padded - 1, 0.0f);
+        setInputRate(input_rate);
+    }
+
+    void setInputRate(double rate) {
+        input_rate = rate;
+        nco_step = rate > 0 ? -2.0 * M_PI * frequency_shift / rate : 0;
+    }
+
+    int getFactor() const {
+        return factor;
+    }
+
+    double getFrequencyShift() const {
+        return frequency_shift;
+    }
+
+    // Samples between the newest input of an output's window and the point in time that output represents
+    double getGroupDelay() const {
+        return (tap_count - 1) / 2.0;
+    }
+
+    // Inputs still to consume before the next output is produced
+    size_t getPhase() const {
+        return phase;
+    }
+
+    // Shifts and filters n input samples, appending the decimated output to out
+    void process(const std::complex<float>* in, size_t n, std::vector<std::complex<float>>& out) {
+        size_t keep = history_i.size();
+        history_i.resize(keep + n);
+        history_q.resize(keep + n);
+
+        std::complex<double> rotation(std::cos(nco_step), std::sin(nco_step));
+        std::complex<double> phasor(std::cos(nco_phase), std::sin(nco_phase));
+        for (size_t i = 0; i < n; ++i) {
+            std::complex<float> mixed = in[i] * std::complex<float>(phasor);
+            history_i[keep + i] = mixed.real();
+            history_q[keep + i] = mixed.imag();
+            phasor *= rotation;
+        }
+        nco_phase = std::fmod(nco_phase + nco_step * n, 2.0 * M_PI);
+
+        // Output k uses the window ending at input phase + k * factor
+        size_t width = reversed_taps.size();
+        size_t i = phase;
+        for (; i < n; i += factor) {
+            float re;
+            float im;
+            dotProduct2(reversed_taps.data(), history_i.data() + i + keep + 1 - width,
+                        history_q.data() + i + keep + 1 - width, width, re, im);
+            out.emplace_back(re, im);
+        }
+        phase = i - n;
+
+        history_i.erase(history_i.begin(), history_i.end() - keep);
+        history_q.erase(history_q.begin(), history_q.end() - keep);
+    }
+
+private:
+    int factor;
+    double frequency_shift;
+    double input_rate = 0;
+    size_t tap_count = 0;
+    std::vector<float> reversed_taps;
+    std::vector<float> history_i;
+    std::vector<float> history_q;
+    size_t phase = 0;
+    double nco_phase = 0;
+    double nco_step = 0;
+
+    static std::vector<float> _designLowPass(int factor) {
+        size_t count = 8 * factor + 1;
+        double cutoff = 0.45 / factor;
+        std::vector<float> taps(count);
+        double sum = 0;
+        for (size_t i = 0; i < count; ++i) {
+            double t = static_cast<double>(i) - (count - 1) / 2.0;
+            double sinc = t == 0 ? 2 * cutoff : std::sin(2 * M_PI * cutoff * t) / (M_PI * t);
+            double window = 0.54 - 0.46 * std::cos(2 * M_PI * i / (count - 1));
+            taps[i] = static_cast<float>(sinc * window);
+            sum += taps[i];
+        }
+        for (auto& tap : taps) {
+            tap = static_cast<float>(tap / sum);
+        }
+        return taps;
+    }
+};
 
-                if (_getSecondsOfData() > max_seconds) {
-                    packet_data.clear();
-                    std::cout << "C++ Dropped packets" << std::endl << std::flush;
+// Forward complex FFT for power of two sizes. Stockham autosort radix-4 passes with one radix-2 pass when log2(n) is
+// odd, so there is no bit reversal. Butterflies handle two complex values per SSE register when the stride allows.
+class FFT {
+public:
+    explicit FFT(size_t n) : n(n), work(n) {
+        if (n < 2 || (n & (n - 1)) != 0) {
+            throw std::runtime_error("FFT size must be a power of two >= 2");
+        }
+        // One twiddle table per pass, w^p, w^2p and w^3p interleaved
+        for (size_t len = n, stride = 1; len > 1; stride *= (len >= 4 ? 4 : 2), len /= (len >= 4 ? 4 : 2)) {
+            std::vector<std::complex<float>> table;
+            size_t quarter = len >= 4 ? len / 4 : 0;
+            for (size_t p = 0; p < quarter; ++p) {
+                double theta = -2.0 * M_PI * p / len;
+                for (int k = 1; k <= 3; ++k) {
+                    table.emplace_back(static_cast<float>(std::cos(k * theta)), static_cast<float>(std::sin(k * theta)));
                 }
             }
+            twiddles.push_back(std::move(table));
         }
     }
 
-    std::vector<uint8_t> getPacketData() {
-        std::lock_guard<std::mutex> lock(stream_mutex);
-        std::vector<uint8_t> data(packet_data);
-        packet_data.clear();
-        return data;
+    size_t size() const {
+        return n;
     }
 
-    int getStreamID() const {
-        return stream_id;
+    // In place, unnormalized, exp(-j) kernel
+    void forward(std::complex<float>* data) {
+        std::complex<float>* x = data;
+        std::complex<float>* y = work.data();
+        size_t pass = 0;
+        for (size_t len = n, stride = 1; len > 1; ++pass) {
+            if (len >= 4) {
+                _radix4(len, stride, twiddles[pass].data(), x, y);
+                len /= 4;
+                stride *= 4;
+            } else {
+                _radix2(stride, x, y);
+                len /= 2;
+                stride *= 2;
+            }
+            std::swap(x, y);
+        }
+        if (x != data) {
+            std::copy(x, x + n, data);
+        }
     }
 
-    int getSampleRate() const {
-        std::lock_guard<std::mutex> lock(stream_mutex);
-        return _getSampleRate();
+private:
+    size_t n;
+    std::vector<std::complex<float>> work;
+    std::vector<std::vector<std::complex<float>>> twiddles;
+
+#if defined(__SSE__)
+    // (a.re * w.re - a.im * w.im, a.im * w.re + a.re * w.im) for two packed complex values
+    static inline __m128 _cmul(__m128 a, __m128 w_re, __m128 w_im_signed) {
+        __m128 swapped = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+        return _mm_add_ps(_mm_mul_ps(a, w_re), _mm_mul_ps(swapped, w_im_signed));
     }
 
-    float getSecondsOfData() const {
-        std::lock_guard<std::mutex> lock(stream_mutex);
-        return _getSecondsOfData();
+    static inline __m128 _twiddle(const std::complex<float>& w, __m128& w_im_signed) {
+        w_im_signed = _mm_setr_ps(-w.imag(), w.imag(), -w.imag(), w.imag());
+        return _mm_set1_ps(w.real());
+    }
+#endif
+
+    static void _radix4(size_t len, size_t stride, const std::complex<float>* table, const std::complex<float>* x,
+                        std::complex<float>* y) {
+        const std::complex<float> j(0, 1);
+        size_t m = len / 4;
+        for (size_t p = 0; p < m; ++p) {
+            const std::complex<float> w1 = table[3 * p];
+            const std::complex<float> w2 = table[3 * p + 1];
+            const std::complex<float> w3 = table[3 * p + 2];
+            const std::complex<float>* xa = x + stride * p;
+            const std::complex<float>* xb = x + stride * (p + m);
+            const std::complex<float>* xc = x + stride * (p + 2 * m);
+            const std::complex<float>* xd = x + stride * (p + 3 * m);
+            std::complex<float>* y0 = y + stride * (4 * p);
+            std::complex<float>* y1 = y0 + stride;
+            std::complex<float>* y2 = y1 + stride;
+            std::complex<float>* y3 = y2 + stride;
+            size_t q = 0;
+#if defined(__SSE__)
+            __m128 w1_im, w2_im, w3_im;
+            __m128 w1_re = _twiddle(w1, w1_im);
+            __m128 w2_re = _twiddle(w2, w2_im);
+            __m128 w3_re = _twiddle(w3, w3_im);
+            const __m128 rotate_sign = _mm_setr_ps(-1.0f, 1.0f, -1.0f, 1.0f);
+            for (; q + 2 <= stride; q += 2) {
+                __m128 a = _mm_loadu_ps(reinterpret_cast<const float*>(xa + q));
+                __m128 b = _mm_loadu_ps(reinterpret_cast<const float*>(xb + q));
+                __m128 c = _mm_loadu_ps(reinterpret_cast<const float*>(xc + q));
+                __m128 d = _mm_loadu_ps(reinterpret_cast<const float*>(xd + q));
+                __m128 apc = _mm_add_ps(a, c);
+                __m128 amc = _mm_sub_ps(a, c);
+                __m128 bpd = _mm_add_ps(b, d);
+                __m128 bmd = _mm_sub_ps(b, d);
+                // j * (b - d)
+                __m128 jbmd = _mm_mul_ps(_mm_shuffle_ps(bmd, bmd, _MM_SHUFFLE(2, 3, 0, 1)), rotate_sign);
+                _mm_storeu_ps(reinterpret_cast<float*>(y0 + q), _mm_add_ps(apc, bpd));
+                _mm_storeu_ps(reinterpret_cast<float*>(y1 + q), _cmul(_mm_sub_ps(amc, jbmd), w1_re, w1_im));
+                _mm_storeu_ps(reinterpret_cast<float*>(y2 + q), _cmul(_mm_sub_ps(apc, bpd), w2_re, w2_im));
+                _mm_storeu_ps(reinterpret_cast<float*>(y3 + q), _cmul(_mm_add_ps(amc, jbmd), w3_re, w3_im));
+            }
+#endif
+            for (; q < stride; ++q) {
+                std::complex<float> apc = xa[q] + xc[q];
+                std::complex<float> amc = xa[q] - xc[q];
+                std::complex<float> bpd = xb[q] + xd[q];
+                std::complex<float> jbmd = j * (xb[q] - xd[q]);
+                y0[q] = apc + bpd;
+                y1[q] = w1 * (amc - jbmd);
+                y2[q] = w2 * (apc - bpd);
+                y3[q] = w3 * (amc + jbmd);
+            }
+        }
     }
 
-    bool hasContextPacket() const {
-        std::lock_guard<std::mutex> lock(stream_mutex);
-        return _hasContextPacket();
+    // Last pass of an odd log2(n) size, len is 2 so every twiddle is 1
+    static void _radix2(size_t stride, const std::complex<float>* x, std::complex<float>* y) {
+        for (size_t q = 0; q < stride; ++q) {
+            y[q] = x[q] + x[q + stride];
+            y[q + stride] = x[q] - x[q + stride];
+        }
+    }
+};
+
+// Welch power spectrum: Hann windowed FFT frames with configurable overlap, averaged exponentially or in blocks
+class SpectrumEstimator {
+public:
+    // block_count > 0 publishes the mean of every block_count frames, otherwise frames are averaged with weight alpha
+    SpectrumEstimator(size_t fft_size, double overlap, double alpha, size_t block_count)
+        : fft(fft_size), window(fft_size), frame(fft_size), power(fft_size, 0.0f), latest(),
+          alpha(std::min(1.0, std::max(1e-6, alpha))), block_count(block_count) {
+        overlap = std::min(0.95, std::max(0.0, overlap));
+        hop = std::max<size_t>(1, static_cast<size_t>(fft_size * (1.0 - overlap)));
+
+        double sum = 0;
+        for (size_t i = 0; i < fft_size; ++i) {
+            window[i] = static_cast<float>(0.5 - 0.5 * std::cos(2 * M_PI * i / fft_size));
+            sum += window[i];
+        }
+        // A full scale tone centred on a bin reads 0 dBFS
+        normalization = static_cast<float>(1.0 / (sum * sum));
+    }
+
+    size_t getFFTSize() const {
+        return fft.size();
+    }
+
+    void add(const std::complex<float>* samples, size_t n) {
+        pending.insert(pending.end(), samples, samples + n);
+        size_t start = 0;
+        for (; start + fft.size() <= pending.size(); start += hop) {
+            _addFrame(pending.data() + start);
+        }
+        pending.erase(pending.begin(), pending.begin() + std::min(start, pending.size()));
+    }
+
+    // Latest averaged power per bin in dBFS, DC in the middle, empty until the first average is published
+    const std::vector<float>& getLatest() const {
+        return latest;
+    }
+
+    size_t getFrameCount() const {
+        return frames;
+    }
+
+private:
+    FFT fft;
+    std::vector<float> window;
+    std::vector<std::complex<float>> frame;
+    std::vector<float> power;
+    std::vector<float> latest;
+    std::vector<std::complex<float>> pending;
+    double alpha;
+    size_t block_count;
+    size_t hop = 1;
+    float normalization = 1;
+    size_t frames = 0;
+    size_t frames_in_block = 0;
+
+    void _addFrame(const std::complex<float>* samples) {
+        size_t n = fft.size();
+        for (size_t i = 0; i < n; ++i) {
+            frame[i] = samples[i] * window[i];
+        }
+        fft.forward(frame.data());
+
+        bool exponential = block_count == 0;
+        float weight = exponential ? (frames == 0 ? 1.0f : static_cast<float>(alpha)) : 1.0f;
+        for (size_t i = 0; i < n; ++i) {
+            float p = std::norm(frame[i]) * normalization;
+            power[i] = exponential ? power[i] + weight * (p - power[i]) : power[i] + p;
+        }
+        ++frames;
+
+        if (exponential) {
+            _publish(1.0f);
+        } else if (++frames_in_block == block_count) {
+            _publish(1.0f / block_count);
+            std::fill(power.begin(), power.end(), 0.0f);
+            frames_in_block = 0;
+        }
+    }
+
+    void _publish(float scale) {
+        size_t n = power.size();
+        latest.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            // fftshift so the lowest frequency comes first
+            float p = power[(i + n / 2) % n] * scale;
+            latest[i] = 10.0f * std::log10(std::max(p, 1e-20f));
+        }
     }
+};
+
+// Per-stream view of the VitaSocket memory budget
+struct StreamMemoryStats {
+    int stream_id;
+    int priority;
+    double min_retention_seconds;
+    size_t bytes_buffered;
+    size_t bytes_allocated;
+    size_t bytes_evicted;
+    double seconds_buffered;
+    double seconds_since_read;
+};
+
+// Health statistics of the int16 samples received since the last reset, relative to full scale
+struct StreamStats {
+    int stream_id;
+    uint64_t samples;
+    double rms_dbfs;
+    double dc_i;
+    double dc_q;
+    double peak_magnitude;
+    double clipping_percent;
+    // Summed from the context packets' Over-range count fields
+    uint64_t over_range_count;
+    // Data packets whose trailer set the over-range indicator
+    uint64_t over_range_packets;
+};
+
+// Delay between a packet's VRT timestamp, its kernel arrival time and the moment it was parsed, in seconds.
+// Needs kernel timestamps on the socket, transport latency also needs UTC real-time VRT timestamps.
+struct StreamLatency {
+    int stream_id;
+    uint64_t packets;
+    // Kernel arrival time of the newest packet, nanoseconds since the Unix epoch
+    int64_t last_arrival_ns;
+    // Arrival minus VRT timestamp, which includes the packet's own duration
+    double transport_mean;
+    double transport_max;
+    // Parse time minus arrival, time spent queued in the host
+    double queueing_mean;
+    double queueing_max;
+};
+
+// Context packets served from a stream's context cache versus decoded, see VitaSocket::setContextCache
+struct ContextCacheStats {
+    int stream_id;
+    uint64_t hits;
+    uint64_t misses;
+};
+
+// Burst kept by a stream in capture mode, pre-trigger through post-trigger, decoded to normalized complex64.
+// start is only set when the stream's data packets carry a timestamp, see timed.
+struct Capture {
+    SampleTime start;
+    bool timed;
+    double sample_rate;
+    float peak_dbfs;
+    std::vector<std::complex<float>> samples;
+};
+
+// Zero-copy window into a stream, block keeps the bytes alive for as long as the caller holds on to it
+struct SampleView {
+    std::shared_ptr<const StreamBuffer::Block> block;
+    const uint8_t* data;
+    size_t bytes;
+    SampleTime start;
+    bool complex64;
+};
+
+class VitaStream {
+public:
+    VitaStream(int id, size_t max_seconds = 30) : packet_data(100000), spare_blocks(std::make_shared<BlockPool>(2)), stream_id(id), max_seconds(max_seconds),
+        last_read(std::chrono::steady_clock::now()), last_packet(last_read) {
+        vrt_init_context_cache(&context_cache);
+    }
+
+    VitaStream(const VitaStream&) = delete;
+    VitaStream& operator=(const VitaStream&) = delete;
+    VitaStream(VitaStream&&) = delete;
+    VitaStream& operator=(VitaStream&&) = delete;
+
+    // Reads an IF context packet framed by vrt_frame_packets through the stream's context cache, so a context that
+    // is resent unchanged is not decoded again. Returns the packet size in words like vrt_read_packet, and sets
+    // changed to false when the IF context came from the cache. With be set the words are in network order, as framed
+    // by vrt_frame_packets_be.
+    int32_t readContext(const uint32_t* words, const vrt_packet_desc& desc, vrt_packet* packet, bool* changed,
+                        bool be = false) {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        packet->header = desc.header;
+        int32_t rv = be ? vrt_read_fields_be(&packet->header, words + 1, desc.offset_body - 1, &packet->fields, true)
+                        : vrt_read_fields(&packet->header, words + 1, desc.offset_body - 1, &packet->fields, true);
+        if (rv < 0) {
+            return rv;
+        }
+        rv = be ? vrt_read_if_context_cached_be(words + desc.offset_body, desc.words_body, &context_cache, true)
+                : vrt_read_if_context_cached(words + desc.offset_body, desc.words_body, &context_cache, true);
+        if (rv < 0) {
+            return rv;
+        }
+        if (rv != desc.words_body) {
+            return VRT_ERR_MISMATCH_PACKET_SIZE;
+        }
+        packet->if_context = context_cache.if_context;
+        packet->body = nullptr;
+        packet->words_body = 0;
+        *changed = context_cache.changed;
+        context_from_cache = true;
+        return desc.header.packet_size;
+    }
+
+    // Forgets the cached IF context, so the next readContext decodes it again. Hit and miss counts are kept.
+    void resetContextCache() {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        _resetContextCache();
+    }
+
+    // arrival_ns is the kernel receive time of the packet, 0 when the socket does not report one. A context packet
+    // with context_changed false repeats the current context, see readContext.
+    void addPacket(const vrt_packet& packet, int64_t arrival_ns = 0, bool context_changed = true) {
+        if (packet.header.packet_type != VRT_PT_IF_CONTEXT) {
+            addPacket(vrt_packet_view{packet.header, packet.fields, packet.body, packet.words_body, packet.trailer},
+                      arrival_ns);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        if (retired) {
+            return;
+        }
+        // A context that did not come through readContext leaves the cache out of date, so the next cached read
+        // could report an older context as unchanged
+        if (!context_from_cache) {
+            _resetContextCache();
+        }
+        context_from_cache = false;
+        last_packet = std::chrono::steady_clock::now();
+        if (packet.if_context.has.over_range_count) {
+            signal_over_range_count += packet.if_context.over_range_count;
+        }
+        if (!context_changed && _hasContextPacket()) {
+            // Rates and payload format are unchanged, only the header and fields are new
+            context_packet.header = packet.header;
+            context_packet.fields = packet.fields;
+            return;
+        }
+        context_packet = packet;
+        if (decimator) {
+            decimator->setInputRate(_getSampleRate());
+        }
+        // Without a payload format field the stream keeps assuming int16 I/Q
+        PayloadDecoder format = packet.if_context.has.data_packet_payload_format ?
+            selectPayloadDecoder(packet.if_context.data_packet_payload_format) : fixedPointDecoder<16, 16, true, false>();
+        if (format.decode != payload.decode) {
+            if (!format.decode) {
+                std::cout << "C++: Stream " << stream_id << " has an unsupported payload format, ignoring its data" << std::endl;
+            }
+            // Buffered samples of the old format can not be mixed with the new one
+            _clear();
+            payload = format;
+            _updateSampleSize();
+        }
+    }
+
+    // Data packets only need the slim view, so they are read without the IF context a vrt_packet carries
+    void addPacket(const vrt_packet_view& packet, int64_t arrival_ns = 0) {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        if (retired) {
+            return;
+        }
+        last_packet = std::chrono::steady_clock::now();
+        if (arrival_ns > 0) {
+            _recordLatency(packet, arrival_ns);
+        }
+        // Given we don't know how much data we have without a sample rate we just wait until we have a context packet
+        if (_hasContextPacket() && payload.decode){
+            auto* bytePtr = static_cast<uint8_t*>(packet.body); // Convert void* to uint8_t*
+            const uint32_t* words = static_cast<const uint32_t*>(packet.body);
+            size_t n_words = packet.words_body;
+            size_t samples = payload.count(n_words);
+            uint64_t first_new = total_samples;
+            uint64_t power_before = signal.sum_power;
+
+            // Native int16 payloads are buffered as is and only decoded when something needs complex64
+            const std::complex<float>* decoded = nullptr;
+            if (payload.native) {
+                accumulateSignal(words, samples, signal);
+            } else {
+                decoded = _decodePayload(words, n_words);
+                accumulateSignal(decoded, samples, payload.rail, signal);
+            }
+            if (packet.header.has.trailer && packet.trailer.has.over_range && packet.trailer.over_range) {
+                ++signal_over_range_packets;
+            }
+            // The same pass gives the capture detector the packet's mean power
+            double power = samples == 0 ? 0 : (signal.sum_power - power_before) / (32768.0 * 32768.0) / samples;
+
+            if (decimator) {
+                _addDecimated(packet, decoded ? decoded : _decodePayload(words, n_words), samples);
+            } else {
+                _indexPacket(packet, 0);
+                if (payload.native) {
+                    packet_data.append(bytePtr, samples * wire_bytes_per_sample);
+                } else {
+                    packet_data.append(reinterpret_cast<const uint8_t*>(decoded), samples * sizeof(std::complex<float>));
+                }
+                total_samples += samples;
+                if (spectrum) {
+                    spectrum->add(decoded ? decoded : _decodePayload(words, n_words), samples);
+                }
+            }
+
+            if (capture_enabled) {
+                _updateCapture(power, first_new);
+            }
+
+            if (_getSecondsOfData() > max_seconds) {
+                _clear();
+                std::cout << "C++ Dropped packets" << std::endl << std::flush;
+            }
+        }
+    }
+
+    // The copy is made after the lock is released, so packets keep flowing while a large buffer is copied
+    std::vector<uint8_t> getPacketData() {
+        SampleView drained = drainPacketData();
+        return std::vector<uint8_t>(drained.data, drained.data + drained.bytes);
+    }
+
+    // Drains the whole buffer without copying. The filled block is swapped for a spare from the stream's pool in
+    // constant time under the lock and handed to the caller, together with the timestamp of its first sample.
+    // The block returns to the pool once the caller and any views of it let go.
+    // While a capture is in progress the buffer belongs to the burst and an empty view is returned.
+    SampleView drainPacketData() {
+        // Spares are taken outside the lock, a new one is reserved at the size of the last drain
+        std::shared_ptr<StreamBuffer::Block> spare = spare_blocks->acquire(last_drain_bytes);
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        last_read = std::chrono::steady_clock::now();
+        if (capture_active) {
+            return SampleView{packet_data.pin(), packet_data.data(), 0, {0, 0}, _storesComplex64()};
+        }
+        SampleTime start = time_index.empty() ? SampleTime{0, 0} : _timeOfSample(first_sample);
+        std::shared_ptr<const StreamBuffer::Block> filled = packet_data.exchange(std::move(spare));
+        SampleView view{filled, filled->data(), filled->size(), start, _storesComplex64()};
+        last_drain_bytes = filled->size();
+        time_index.clear();
+        first_sample = total_samples;
+        return view;
+    }
+
+    // Returns a zero-copy view of the buffered samples from t_start up to (not including) t_end, both in seconds of
+    // the stream's VRT timestamps, together with the exact timestamp of the first returned sample.
+    // The data is not drained. An empty view is returned when nothing buffered overlaps the range.
+    SampleView getSamples(double t_start, double t_end) const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        last_read = std::chrono::steady_clock::now();
+        SampleView view{packet_data.pin(), packet_data.data(), 0, {0, 0}, _storesComplex64()};
+        if (time_index.empty() || !(t_end > t_start)) {
+            return view;
+        }
+
+        uint64_t first = _sampleAtOrAfter(_toSampleTime(t_start));
+        uint64_t last = _sampleAtOrAfter(_toSampleTime(t_end));
+        if (last <= first) {
+            return view;
+        }
+
+        view.data += (first - first_sample) * bytes_per_sample;
+        view.bytes = (last - first) * bytes_per_sample;
+        view.start = _timeOfSample(first);
+        return view;
+    }
+
+    // Decodes n_samples samples starting at t_start into out as normalized complex64. Returns false and leaves out
+    // untouched when the buffer does not hold the whole window without gaps.
+    bool copyWindow(double t_start, size_t n_samples, std::complex<float>* out) const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        last_read = std::chrono::steady_clock::now();
+        if (time_index.empty() || n_samples == 0) {
+            return false;
+        }
+
+        SampleTime start = _toSampleTime(t_start);
+        uint64_t first = _sampleAtOrAfter(start);
+        if (first + n_samples > total_samples) {
+            return false;
+        }
+
+        // The first buffered sample is more than a sample period late, so the window starts before the buffer
+        SampleTime first_time = _timeOfSample(first);
+        double rate = _storedRate();
+        if (_secondsBetween(start, first_time) * rate >= 1.0) {
+            return false;
+        }
+
+        // A dropped packet shows up as an index entry whose timestamp disagrees with its sample number
+        auto entry = std::upper_bound(time_index.begin(), time_index.end(), first,
+            [](uint64_t s, const IndexEntry& e) { return s < e.sample; });
+        for (; entry != time_index.end() && entry->sample < first + n_samples; ++entry) {
+            double expected = _secondsBetween(first_time, entry->time) * rate;
+            if (std::fabs(expected - static_cast<double>(entry->sample - first)) > 0.5) {
+                return false;
+            }
+        }
+
+        _decodeStored(packet_data.data() + (first - first_sample) * bytes_per_sample, n_samples, out);
+        return true;
+    }
+
+    // First and one-past-last buffered sample times in seconds, both 0 when no timestamped data is buffered
+    std::pair<double, double> getTimeRange() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        if (time_index.empty() || total_samples == first_sample) {
+            return {0, 0};
+        }
+        return {_toSeconds(_timeOfSample(first_sample)), _toSeconds(_timeOfSample(total_samples))};
+    }
+
+    // Drains up to max_samples samples straight into a caller owned buffer of out_bytes bytes and returns how many
+    // were written. With as_complex64 set the samples are converted to normalized complex64 in the same pass,
+    // otherwise the stored bytes (raw int16 I/Q words, or complex64, see isComplex64) are copied as is.
+    // Nothing is drained while a capture is in progress, so the burst keeps its pre-trigger window.
+    size_t readInto(void* out, size_t out_bytes, size_t max_samples, bool as_complex64) {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        last_read = std::chrono::steady_clock::now();
+        if (capture_active) {
+            return 0;
+        }
+        size_t capacity = out_bytes / (as_complex64 ? sizeof(std::complex<float>) : bytes_per_sample);
+        size_t samples = std::min({max_samples, capacity, packet_data.size() / bytes_per_sample});
+        if (samples == 0) {
+            return 0;
+        }
+
+        if (as_complex64) {
+            _decodeStored(packet_data.data(), samples, static_cast<std::complex<float>*>(out));
+        } else {
+            std::memcpy(out, packet_data.data(), samples * bytes_per_sample);
+        }
+
+        // Keep whatever did not fit for the next read
+        _consume(samples);
+        return samples;
+    }
+
+    // True when the buffer holds normalized complex64 rather than raw int16 I/Q words, which is the case when
+    // decimating or when the context packet announces any other payload format
+    bool isComplex64() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        return _storesComplex64();
+    }
+
+    size_t getSampleCount() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        return packet_data.size() / bytes_per_sample;
+    }
+
+    int getStreamID() const {
+        return stream_id;
+    }
+
+    // Runs every data packet through an NCO shift of frequency_shift Hz and a low-pass FIR decimating by factor.
+    // The stream then buffers complex64 at the reduced rate and getSampleRate/getFrequency describe that output.
+    // Empty taps use a default low-pass design, a factor of 1 with no shift turns the stage off.
+    // Changing the stage drops the samples buffered so far since their format and rate no longer match.
+    void setDecimation(int factor, const std::vector<float>& taps, double frequency_shift) {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        _clear();
+        if (factor <= 1 && taps.empty() && frequency_shift == 0) {
+            decimator.reset();
+        } else {
+            decimator.reset(new Decimator(factor, taps, frequency_shift, _getSampleRate()));
+        }
+        _updateSampleSize();
+    }
+
+    int getDecimation() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        return decimator ? decimator->getFactor() : 1;
+    }
+
+    // Keeps a Welch power spectrum of the buffered samples (after decimation) with fft_size bins, a power of two.
+    // block_count > 0 averages blocks of that many frames, otherwise frames are averaged exponentially with alpha.
+    // An fft_size of 0 turns the estimator off.
+    void setSpectrum(size_t fft_size, double overlap, double alpha, size_t block_count) {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        if (fft_size == 0) {
+            spectrum.reset();
+        } else {
+            spectrum.reset(new SpectrumEstimator(fft_size, overlap, alpha, block_count));
+        }
+    }
+
+    // Latest averaged power spectrum in dBm per bin (dBFS + reference level - gain from the context packet),
+    // lowest frequency first. Empty until the estimator has published its first average.
+    std::vector<float> getSpectrum() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        if (!spectrum) {
+            return {};
+        }
+        std::vector<float> psd(spectrum->getLatest());
+        const vrt_if_context& context = context_packet.if_context;
+        float offset = 0;
+        if (_hasContextPacket() && context.has.reference_level) {
+            offset += context.reference_level;
+        }
+        if (_hasContextPacket() && context.has.gain) {
+            offset -= context.gain.stage1 + context.gain.stage2;
+        }
+        for (auto& bin : psd) {
+            bin += offset;
+        }
+        return psd;
+    }
+
+    ContextCacheStats getContextCacheStats(bool reset) {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        ContextCacheStats stats{stream_id, context_cache.hits, context_cache.misses};
+        if (reset) {
+            context_cache.hits = 0;
+            context_cache.misses = 0;
+        }
+        return stats;
+    }
+
+    StreamLatency getLatency(bool reset) {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        double transport_n = static_cast<double>(std::max<uint64_t>(latency.transport_count, 1));
+        double queueing_n = static_cast<double>(std::max<uint64_t>(latency.packets, 1));
+        StreamLatency result{stream_id, latency.packets, latency.last_arrival_ns, latency.transport_sum / transport_n,
+                             latency.transport_max, latency.queueing_sum / queueing_n, latency.queueing_max};
+        if (reset) {
+            int64_t last = latency.last_arrival_ns;
+            latency = LatencyAccumulator();
+            latency.last_arrival_ns = last;
+        }
+        return result;
+    }
+
+    // Capture mode: each data packet's mean power is compared against a running noise floor, and only bursts more than
+    // threshold_db above it are kept, from pre_seconds before the first detection to post_seconds after the last one.
+    // Between bursts the buffer holds just the pre-trigger window. Finished bursts are collected with getCaptures.
+    // Reads that drain the buffer (readInto, getPacketData, drainPacketData) return nothing while a burst is open.
+    // floor_alpha is the weight of each quiet packet in the noise floor average.
+    void setCapture(bool enabled, double threshold_db, double pre_seconds, double post_seconds, double floor_alpha) {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        capture_enabled = enabled;
+        capture_threshold = std::pow(10.0, threshold_db / 10.0);
+        capture_pre_seconds = std::max(0.0, pre_seconds);
+        capture_post_seconds = std::max(0.0, post_seconds);
+        noise_floor_alpha = std::min(1.0, std::max(0.0, floor_alpha));
+        noise_floor = 0;
+        capture_active = false;
+    }
+
+    bool isCapturing() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        return capture_active;
+    }
+
+    // Running noise floor in dBFS, -inf before the first packet
+    double getNoiseFloor() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        return 10.0 * std::log10(noise_floor);
+    }
+
+    // Returns the finished captures, oldest first, and forgets them
+    std::vector<Capture> getCaptures() {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        last_read = std::chrono::steady_clock::now();
+        std::vector<Capture> result;
+        for (const auto& stored : captures) {
+            size_t samples = stored.data.size() / (stored.complex64 ? sizeof(std::complex<float>) : wire_bytes_per_sample);
+            Capture capture{stored.start, stored.timed, stored.sample_rate, stored.peak_dbfs, std::vector<std::complex<float>>(samples)};
+            if (stored.complex64) {
+                std::memcpy(capture.samples.data(), stored.data.data(), stored.data.size());
+            } else {
+                _decodeComplex64(stored.data.data(), samples, capture.samples.data());
+            }
+            result.push_back(std::move(capture));
+        }
+        captures.clear();
+        capture_bytes = 0;
+        capture_seconds = 0;
+        return result;
+    }
+
+    // Statistics of the received samples (before any decimation) since the last reset, no samples are copied
+    StreamStats getStats(bool reset) {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        constexpr double full_scale = 32768.0;
+        double n = static_cast<double>(std::max<uint64_t>(signal.samples, 1));
+        double mean_power = signal.sum_power / (full_scale * full_scale) / n;
+        StreamStats stats{stream_id, signal.samples, 10.0 * std::log10(mean_power), signal.sum_i / full_scale / n,
+                          signal.sum_q / full_scale / n, std::sqrt(static_cast<double>(signal.peak_power)) / full_scale,
+                          100.0 * signal.clipped / n, signal_over_range_count, signal_over_range_packets};
+        if (reset) {
+            signal = SignalAccumulator();
+            signal_over_range_count = 0;
+            signal_over_range_packets = 0;
+        }
+        return stats;
+    }
+
+    // Higher priority streams are trimmed last when the VitaSocket memory budget is exceeded
+    void setPriority(int value) {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        priority = value;
+    }
+
+    int getPriority() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        return priority;
+    }
+
+    // Seconds of data that budget eviction never trims below
+    void setMinRetention(double seconds) {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        min_retention_seconds = std::max(0.0, seconds);
+    }
+
+    double getMinRetention() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        return min_retention_seconds;
+    }
+
+    size_t getAllocatedBytes() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        return packet_data.capacity() + capture_bytes + spare_blocks->spareBytes();
+    }
+
+    std::chrono::steady_clock::time_point getLastPacket() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        return last_packet;
+    }
+
+    // Frees the buffered samples, index and context. A retired stream ignores new packets and reads as empty, so
+    // handles still held elsewhere stay safe to use.
+    void retire() {
+        std::shared_ptr<StreamBuffer::Block> data;
+        {
+            std::lock_guard<std::mutex> lock(stream_mutex);
+            retired = true;
+            data = packet_data.release();
+            _clear();
+            time_index.shrink_to_fit();
+            context_packet = vrt_packet{};
+        }
+
+        // Unmapped rather than kept in the arena's cache, so retiring frees memory, and without holding the stream
+        // lock. The buffer goes first since a drained block returns to the spares when released.
+        Arena::Uncached uncached;
+        data.reset();
+        spare_blocks->clear();
+    }
+
+    bool isRetired() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        return retired;
+    }
+
+    std::chrono::steady_clock::time_point getLastRead() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        return last_read;
+    }
+
+    // Drops the oldest samples, never going below the minimum retention, to release about bytes of memory.
+    // Returns the number of allocated bytes actually released.
+    size_t evict(size_t bytes) {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        size_t before = packet_data.capacity();
+        size_t keep = static_cast<size_t>(min_retention_seconds * _storedRate());
+        size_t buffered = packet_data.size() / bytes_per_sample;
+        if (buffered > keep) {
+            size_t drop = std::min(buffered - keep, (bytes + bytes_per_sample - 1) / bytes_per_sample);
+            _consume(drop);
+            bytes_evicted += drop * bytes_per_sample;
+        }
+        packet_data.shrink();
+        size_t released = spare_blocks->clear();
+        return released + (before > packet_data.capacity() ? before - packet_data.capacity() : 0);
+    }
+
+    StreamMemoryStats getMemoryStats() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        std::chrono::duration<double> idle = std::chrono::steady_clock::now() - last_read;
+        return {stream_id, priority, min_retention_seconds, packet_data.size(), packet_data.capacity(),
+                bytes_evicted, _getSecondsOfData(), idle.count()};
+    }
+
+    int getSampleRate() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        return static_cast<int>(_storedRate());
+    }
+
+    float getSecondsOfData() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        return _getSecondsOfData();
+    }
+
+    bool hasContextPacket() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        return _hasContextPacket();
+    }
+
+    double getFrequency() const {
+        std::lock_guard<std::mutex> lock(stream_mutex);
+        double shift = decimator ? decimator->getFrequencyShift() : 0;
+        return context_packet.if_context.rf_reference_frequency_offset + context_packet.if_context.if_reference_frequency + shift;
+    }
+
+private:
+    // Native payload words are int16 I/Q pairs, I in the upper half of the (already host order) word
+    static constexpr size_t wire_bytes_per_sample = 4;
+
+    // Decoder picked from the context packet's payload format
+    PayloadDecoder payload = fixedPointDecoder<16, 16, true, false>();
+    // Size of a buffered sample, the native wire size or complex64
+    size_t bytes_per_sample = wire_bytes_per_sample;
+    std::unique_ptr<Decimator> decimator;
+    std::vector<std::complex<float>> decode_scratch;
+    std::vector<std::complex<float>> decimate_scratch;
+    std::unique_ptr<SpectrumEstimator> spectrum;
+
+    // Finished capture in its buffered format, decoded when handed out
+    struct StoredCapture {
+        SampleTime start;
+        bool timed;
+        double sample_rate;
+        float peak_dbfs;
+        bool complex64;
+        std::vector<uint8_t> data;
+    };
+
+    struct LatencyAccumulator {
+        uint64_t packets = 0;
+        uint64_t transport_count = 0;
+        int64_t last_arrival_ns = 0;
+        double transport_sum = 0;
+        double transport_max = 0;
+        double queueing_sum = 0;
+        double queueing_max = 0;
+    };
+    LatencyAccumulator latency;
+
+    SignalAccumulator signal;
+    uint64_t signal_over_range_count = 0;
+    uint64_t signal_over_range_packets = 0;
+
+    bool capture_enabled = false;
+    double capture_threshold = 10;
+    double capture_pre_seconds = 0;
+    double capture_post_seconds = 0;
+    double noise_floor_alpha = 0.01;
+    // Linear mean power, 0 until the first packet
+    double noise_floor = 0;
+    bool capture_active = false;
+    uint64_t capture_start = 0;
+    uint64_t capture_end = 0;
+    double capture_peak = 0;
+    std::deque<StoredCapture> captures;
+    size_t capture_bytes = 0;
+    double capture_seconds = 0;
+
+    // Maps a data packet's timestamp to the absolute number of its first sample
+    struct IndexEntry {
+        SampleTime time;
+        uint64_t sample;
+    };
+
+    StreamBuffer packet_data;
+    // Spare blocks for drainPacketData, two are enough for one drain in flight while the next fills
+    std::shared_ptr<BlockPool> spare_blocks;
+    std::atomic<size_t> last_drain_bytes{0};
+    int stream_id;
+    int max_seconds;
+    mutable std::mutex stream_mutex;
+    vrt_packet context_packet{};
+    // Last IF context read by readContext
+    vrt_context_cache context_cache;
+    // Set by readContext, tells the following addPacket that its context is the one in the cache
+    bool context_from_cache = false;
+
+    // Absolute sample numbers of the first buffered sample and one past the last, so consuming never rewrites the index
+    uint64_t first_sample = 0;
+    uint64_t total_samples = 0;
+    std::deque<IndexEntry> time_index;
+
+    int priority = 0;
+    double min_retention_seconds = 0;
+    size_t bytes_evicted = 0;
+    mutable std::chrono::steady_clock::time_point last_read;
+    std::chrono::steady_clock::time_point last_packet;
+    bool retired = false;
+
+
+    void _resetContextCache() {
+        uint64_t hits = context_cache.hits;
+        uint64_t misses = context_cache.misses;
+        vrt_init_context_cache(&context_cache);
+        context_cache.hits = hits;
+        context_cache.misses = misses;
+    }
+
+    bool _hasContextPacket() const {
+        return context_packet.header.packet_type == VRT_PT_IF_CONTEXT;
+    }
+
+    float _getSecondsOfData() const {
+        if (!_hasContextPacket()) {
+            return 0;
+        }
+        return packet_data.size() / _storedRate() / static_cast<float>(bytes_per_sample);
+    }
+
+    int _getSampleRate() const {
+        return 0 == context_packet.if_context.sample_rate ? 0 : context_packet.if_context.sample_rate;
+    }
+
+    // Rate of the buffered samples, which differs from the wire rate when decimating
+    double _storedRate() const {
+        double rate = _getSampleRate();
+        return decimator ? rate / decimator->getFactor() : rate;
+    }
+
+    bool _storesComplex64() const {
+        return decimator || !payload.native;
+    }
+
+    void _updateSampleSize() {
+        bytes_per_sample = _storesComplex64() ? sizeof(std::complex<float>) : wire_bytes_per_sample;
+    }
+
+    const std::complex<float>* _decodePayload(const uint32_t* words, size_t n_words) {
+        decode_scratch.resize(payload.count(n_words));
+        payload.decode(words, n_words, decode_scratch.data());
+        return decode_scratch.data();
+    }
+
+    void _addDecimated(const vrt_packet_view& packet, const std::complex<float>* input, size_t samples) {
+        // The first output of this packet completes at input decimator->getPhase() and represents the middle of
+        // the filter window
+        if (decimator->getPhase() < samples) {
+            double delay = (decimator->getPhase() - decimator->getGroupDelay()) / _getSampleRate();
+            _indexPacket(packet, delay);
+        }
+
+        decimate_scratch.clear();
+        decimator->process(input, samples, decimate_scratch);
+        packet_data.append(reinterpret_cast<const uint8_t*>(decimate_scratch.data()),
+                           decimate_scratch.size() * sizeof(std::complex<float>));
+        total_samples += decimate_scratch.size();
+        if (spectrum) {
+            spectrum->add(decimate_scratch.data(), decimate_scratch.size());
+        }
+    }
+
+    // Runs the detector for a packet whose buffered samples start at first_new, then trims the buffer back to the
+    // pre-trigger window unless a burst is in progress
+    void _updateCapture(double power, uint64_t first_new) {
+        bool detected = noise_floor > 0 && power > noise_floor * capture_threshold;
+        if (!detected) {
+            // Quiet packets only, so bursts do not drag the floor up. Digital silence still needs a nonzero floor.
+            power = std::max(power, 1e-12);
+            noise_floor = noise_floor == 0 ? power : noise_floor + noise_floor_alpha * (power - noise_floor);
+        }
+
+        double rate = _storedRate();
+        uint64_t pre = static_cast<uint64_t>(capture_pre_seconds * rate);
+        if (detected) {
+            if (!capture_active) {
+                capture_active = true;
+                capture_start = first_new > pre ? first_new - pre : 0;
+                capture_peak = 0;
+            }
+            capture_end = total_samples + static_cast<uint64_t>(capture_post_seconds * rate);
+            capture_peak = std::max(capture_peak, power);
+        }
+
+        if (capture_active && (total_samples >= capture_end || (total_samples - capture_start) >= max_seconds * rate)) {
+            _finishCapture();
+        }
+
+        if (!capture_active) {
+            uint64_t buffered = total_samples - first_sample;
+            if (buffered > pre) {
+                _consume(buffered - pre);
+            }
+        }
+    }
+
+    void _finishCapture() {
+        capture_active = false;
+        // Readers can not drain during a burst, but budget eviction can, the capture then starts at what is left
+        uint64_t start = std::max(capture_start, first_sample);
+        if (start >= total_samples) {
+            return;
+        }
+
+        // Packets without TSI/TSF still give a capture, only without a start time
+        bool timed = !time_index.empty();
+        const uint8_t* begin = packet_data.data() + (start - first_sample) * bytes_per_sample;
+        const uint8_t* end = packet_data.data() + packet_data.size();
+        double rate = _storedRate();
+        captures.push_back({timed ? _timeOfSample(start) : SampleTime{0, 0}, timed, rate,
+                            static_cast<float>(10.0 * std::log10(capture_peak)), _storesComplex64(),
+                            std::vector<uint8_t>(begin, end)});
+        capture_bytes += captures.back().data.size();
+        capture_seconds += (total_samples - start) / rate;
+
+        // Captures nobody collects are bounded like the continuous buffer, oldest dropped first
+        while (captures.size() > 1 && capture_seconds > max_seconds) {
+            const StoredCapture& oldest = captures.front();
+            capture_bytes -= oldest.data.size();
+            capture_seconds -= oldest.data.size() / (oldest.complex64 ? sizeof(std::complex<float>) :
+                                                     wire_bytes_per_sample) / oldest.sample_rate;
+            captures.pop_front();
+        }
+    }
+
+    void _clear() {
+        packet_data.clear();
+        time_index.clear();
+        first_sample = total_samples;
+    }
+
+    void _consume(size_t samples) {
+        packet_data.consume(samples * bytes_per_sample);
+        first_sample += samples;
+        // Keep the entry that covers the first remaining sample
+        while (time_index.size() > 1 && time_index[1].sample <= first_sample) {
+            time_index.pop_front();
+        }
+        if (first_sample == total_samples) {
+            time_index.clear();
+        }
+    }
+
+    // Timestamp of the packet's first sample. False when it carries none, or when its fractional part can't be
+    // turned into seconds: a free-running count, or a sample count before the sample rate is known.
+    bool _packetTime(const vrt_packet_view& packet, SampleTime& time) const {
+        if (packet.header.tsi == VRT_TSI_NONE && packet.header.tsf == VRT_TSF_NONE) {
+            return false;
+        }
+        if (packet.header.tsf == VRT_TSF_FREE_RUNNING_COUNT ||
+            (packet.header.tsf == VRT_TSF_SAMPLE_COUNT && _getSampleRate() <= 0)) {
+            return false;
+        }
+
+        time = {packet.fields.integer_seconds_timestamp, 0};
+        if (packet.header.tsf == VRT_TSF_REAL_TIME) {
+            time.picoseconds = packet.fields.fractional_seconds_timestamp;
+        } else if (packet.header.tsf == VRT_TSF_SAMPLE_COUNT) {
+            uint64_t count = packet.fields.fractional_seconds_timestamp;
+            uint64_t rate = _getSampleRate();
+            time.integer_seconds += count / rate;
+            time.picoseconds = static_cast<uint64_t>(std::llround((count % rate) * (1e12 / rate)));
+        }
+        return true;
+    }
+
+    // Records the packet's timestamp, moved by offset seconds, as the time of the next buffered sample
+    void _indexPacket(const vrt_packet_view& packet, double offset) {
+        SampleTime time;
+        if (_packetTime(packet, time)) {
+            time_index.push_back({_addSeconds(time, offset), total_samples});
+        }
+    }
+
+    void _recordLatency(const vrt_packet_view& packet, int64_t arrival_ns) {
+        struct timespec now;
+        clock_gettime(CLOCK_REALTIME, &now);
+        int64_t now_ns = static_cast<int64_t>(now.tv_sec) * 1000000000LL + now.tv_nsec;
+        double queueing = (now_ns - arrival_ns) * 1e-9;
+        latency.packets += 1;
+        latency.last_arrival_ns = arrival_ns;
+        latency.queueing_sum += queueing;
+        latency.queueing_max = std::max(latency.queueing_max, queueing);
+
+        // Only UTC timestamps share the kernel clock's epoch
+        SampleTime time;
+        if (packet.header.tsi == VRT_TSI_UTC && _packetTime(packet, time)) {
+            double transport = (arrival_ns / 1000000000LL - static_cast<int64_t>(time.integer_seconds)) +
+                               ((arrival_ns % 1000000000LL) * 1000.0 - static_cast<double>(time.picoseconds)) * 1e-12;
+            latency.transport_count += 1;
+            latency.transport_sum += transport;
+            latency.transport_max = latency.transport_count == 1 ? transport : std::max(latency.transport_max, transport);
+        }
+    }
+
+    static SampleTime _toSampleTime(double seconds) {
+        if (seconds <= 0) {
+            return {0, 0};
+        }
+        double whole = std::floor(seconds);
+        uint64_t ps = static_cast<uint64_t>(std::llround((seconds - whole) * 1e12));
+        return {static_cast<uint32_t>(whole) + static_cast<uint32_t>(ps / 1000000000000ULL), ps % 1000000000000ULL};
+    }
+
+    static double _toSeconds(const SampleTime& time) {
+        return time.integer_seconds + time.picoseconds * 1e-12;
+    }
+
+    static double _secondsBetween(const SampleTime& from, const SampleTime& to) {
+        return (static_cast<double>(to.integer_seconds) - from.integer_seconds) +
+               (static_cast<double>(to.picoseconds) - static_cast<double>(from.picoseconds)) * 1e-12;
+    }
+
+    static bool _before(const SampleTime& a, const SampleTime& b) {
+        return a.integer_seconds < b.integer_seconds ||
+               (a.integer_seconds == b.integer_seconds && a.picoseconds < b.picoseconds);
+    }
+
+    // Absolute number of the first buffered sample at or after time, clamped to the buffered range
+    uint64_t _sampleAtOrAfter(const SampleTime& time) const {
+        auto next = std::upper_bound(time_index.begin(), time_index.end(), time,
+            [](const SampleTime& t, const IndexEntry& entry) { return _before(t, entry.time); });
+        if (next == time_index.begin()) {
+            return first_sample;
+        }
+
+        const IndexEntry& entry = *std::prev(next);
+        uint64_t end = next == time_index.end() ? total_samples : next->sample;
+        // Small tolerance so a time that lands exactly on a sample is not rounded past it
+        double offset = std::ceil(_secondsBetween(entry.time, time) * _storedRate() - 1e-6);
+        uint64_t sample = entry.sample + static_cast<uint64_t>(std::max(0.0, offset));
+        return std::max(first_sample, std::min(sample, end));
+    }
+
+    SampleTime _timeOfSample(uint64_t sample) const {
+        auto next = std::upper_bound(time_index.begin(), time_index.end(), sample,
+            [](uint64_t s, const IndexEntry& entry) { return s < entry.sample; });
+        const IndexEntry& entry = next == time_index.begin() ? time_index.front() : *std::prev(next);
+
+        double offset = (static_cast<double>(sample) - static_cast<double>(entry.sample)) / _storedRate();
+        return _addSeconds(entry.time, offset);
+    }
+
+    static SampleTime _addSeconds(const SampleTime& time, double offset) {
+        int64_t ps = static_cast<int64_t>(time.picoseconds) + std::llround(offset * 1e12);
+        int64_t seconds = static_cast<int64_t>(time.integer_seconds) + ps / 1000000000000LL;
+        ps %= 1000000000000LL;
+        if (ps < 0) {
+            ps += 1000000000000LL;
+            seconds -= 1;
+        }
+        return {static_cast<uint32_t>(seconds), static_cast<uint64_t>(ps)};
+    }
+
+    void _decodeStored(const uint8_t* src, size_t samples, std::complex<float>* out) const {
+        if (_storesComplex64()) {
+            std::memcpy(out, src, samples * sizeof(std::complex<float>));
+        } else {
+            _decodeComplex64(src, samples, out);
+        }
+    }
+
+    static void _decodeComplex64(const uint8_t* src, size_t samples, std::complex<float>* out) {
+        constexpr float scale = 1.0f / 32768.0f;
+        const uint32_t* words = reinterpret_cast<const uint32_t*>(src);
+        for (size_t i = 0; i < samples; ++i) {
+            int16_t re = static_cast<int16_t>(words[i] >> 16);
+            int16_t im = static_cast<int16_t>(words[i] & 0xFFFF);
+            out[i] = std::complex<float>(re * scale, im * scale);
+        }
+    }
+
+
+    int seconds_to_bytes(int seconds) {
+        // Don't keep data until we have a context packet
+        if (!_hasContextPacket()) {
+            return 0;
+        }
+
+        int sample_rate = _storedRate();
+        int bytes_per_second = sample_rate * bytes_per_sample;
+        std::cout << "Bytes per second: " << bytes_per_second << std::endl;
+        return seconds * bytes_per_second;
+    }
+};
+
+
+// Where an ingest thread ended up, as observed by the thread itself when it started
+struct ThreadPlacement {
+    std::string role;
+    int index;
+    long tid;
+    // CPUs the thread may run on
+    std::vector<int> cpus;
+    int cpu;
+    // NUMA node of cpu
+    int numa_node;
+    // Node new memory is preferred on, -1 for the default local policy
+    int memory_node;
+    std::string policy;
+    int priority;
+    // Requested settings the kernel refused
+    std::string errors;
+};
+
+// Per-socket receive counters. kernel_drops is the kernel's SO_RXQ_OVFL count of datagrams dropped because the
+// receive buffer was full.
+struct SocketStats {
+    int source_id;
+    std::string description;
+    uint64_t reads;
+    uint64_t bytes;
+    uint64_t kernel_drops;
+    // SO_RCVBUF as granted by the kernel
+    int receive_buffer_bytes;
+};
+
+// Kernel arrival times of the bytes in an ingest buffer, one marker per received chunk
+class ArrivalMarkers {
+public:
+    // A chunk that arrived at arrival_ns ends just before byte end of the buffer
+    void add(size_t end, int64_t arrival_ns) {
+        markers.push_back({end, arrival_ns});
+    }
+
+    // Takes over the markers of from, whose buffer was appended to this one at byte base
+    void append(ArrivalMarkers& from, size_t base) {
+        for (const auto& marker : from.markers) {
+            markers.push_back({marker.end + base, marker.arrival_ns});
+        }
+        from.clear();
+    }
+
+    // The first bytes of the buffer were removed
+    void erase(size_t bytes) {
+        while (!markers.empty() && markers.front().end <= bytes) {
+            markers.pop_front();
+        }
+        for (auto& marker : markers) {
+            marker.end -= bytes;
+        }
+    }
+
+    void clear() {
+        markers.clear();
+    }
+
+    // Arrival of the chunk that completed the bytes before end, 0 when unknown. Markers are added in increasing end
+    // order, so this is a binary search and stays cheap when a burst leaves thousands of chunks in one buffer.
+    int64_t at(size_t end) const {
+        auto marker = std::lower_bound(markers.begin(), markers.end(), end,
+            [](const Marker& m, size_t e) { return m.end < e; });
+        return marker == markers.end() ? 0 : marker->arrival_ns;
+    }
+
+private:
+    struct Marker {
+        size_t end;
+        int64_t arrival_ns;
+    };
+    std::deque<Marker> markers;
+};
+
+// recv that also picks up the SO_TIMESTAMPNS arrival time and the SO_RXQ_OVFL drop count when the socket has
+// them enabled, arrival_ns and drops are left alone otherwise
+static ssize_t receiveChunk(int fd, uint8_t* buffer, size_t length, int64_t& arrival_ns, uint32_t& drops) {
+    struct iovec iov{buffer, length};
+    alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(struct timespec)) + CMSG_SPACE(sizeof(uint32_t))];
+    struct msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    ssize_t n = recvmsg(fd, &msg, 0);
+    if (n <= 0) {
+        return n;
+    }
+    for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET) {
+            continue;
+        }
+        if (cmsg->cmsg_type == SCM_TIMESTAMPNS) {
+            struct timespec stamp;
+            std::memcpy(&stamp, CMSG_DATA(cmsg), sizeof(stamp));
+            arrival_ns = static_cast<int64_t>(stamp.tv_sec) * 1000000000LL + stamp.tv_nsec;
+        } else if (cmsg->cmsg_type == SO_RXQ_OVFL) {
+            std::memcpy(&drops, CMSG_DATA(cmsg), sizeof(drops));
+        }
+    }
+    return n;
+}
+
+class VitaSocket {
+
+    public:
+
+        VitaSocket(int buffer_size, bool little_endian=true) : buffer_size(buffer_size), little_endian(true), running(true) {
+            shared_buffer.reserve(buffer_size);
+        }
+
+        ~VitaSocket() {
+            stop_vita_socket();
+            join();
+            for (const auto& loop : loops) {
+                close(loop->epoll_fd);
+                close(loop->wake_fd);
+            }
+        }
+
+        // Returns at once, threads finish within about 100 ms and join() waits for them
+        void stop_vita_socket() {
+            std::lock_guard<std::mutex> lock(loops_mutex);
+            // Wakes a receiver blocked in recv. Done before clearing running since the receiver closes its socket
+            // once it sees that.
+            for (int fd : legacy_fds) {
+                shutdown(fd, SHUT_RDWR);
+            }
+            legacy_fds.clear();
+            running = false;
+            for (const auto& loop : loops) {
+                uint64_t one = 1;
+                if (write(loop->wake_fd, &one, sizeof(one)) < 0) {
+                    perror("eventfd write failed");
+                }
+            }
+        }
+
+        std::vector<int> getStreamIDs() {
+            std::lock_guard<std::mutex> lock(stream_id_mutex);
+            std::vector<int> ids;
+            for (const auto& stream : streams) {
+                ids.push_back(stream.first);
+            }
+            return ids;
+        }
+
+        std::shared_ptr<VitaStream> getStream(int stream_id) {
+            std::lock_guard<std::mutex> lock(stream_id_mutex);
+            if (streams.find(stream_id) == streams.end()) {
+                return nullptr;
+            }
+            return streams.at(stream_id);
+        }
+
+        // Retires streams that have not received a packet for this many seconds, 0 disables expiry
+        void setIdleTimeout(double seconds) {
+            idle_timeout_seconds = std::max(0.0, seconds);
+        }
+
+        double getIdleTimeout() const {
+            return idle_timeout_seconds;
+        }
+
+        // Latest averaged spectrum of a stream, empty when the stream is unknown or has no estimator
+        std::vector<float> getSpectrum(int stream_id) {
+            std::shared_ptr<VitaStream> stream = getStream(stream_id);
+            return stream ? stream->getSpectrum() : std::vector<float>();
+        }
+
+        // IDs of streams retired since the last call
+        std::vector<int> getRetiredStreamIDs() {
+            std::lock_guard<std::mutex> lock(stream_id_mutex);
+            std::vector<int> ids;
+            ids.swap(retired_ids);
+            return ids;
+        }
+
+
+        // Fills out, a row major [stream_ids.size(), n_samples] complex64 array, with the same time window from every
+        // stream. All streams must share a sample rate. Rows of streams that cannot cover the window are zeroed and
+        // their IDs are returned.
+        std::vector<int> getAligned(const std::vector<int>& stream_ids, double t_start, size_t n_samples,
+                                    std::complex<float>* out) {
+            std::vector<std::shared_ptr<VitaStream>> rows;
+            {
+                std::lock_guard<std::mutex> lock(stream_id_mutex);
+                for (int id : stream_ids) {
+                    auto it = streams.find(id);
+                    rows.push_back(it == streams.end() ? nullptr : it->second);
+                }
+            }
+
+            int sample_rate = 0;
+            for (size_t i = 0; i < rows.size(); ++i) {
+                if (rows[i] == nullptr || !rows[i]->hasContextPacket()) {
+                    continue;
+                }
+                int rate = rows[i]->getSampleRate();
+                if (sample_rate != 0 && rate != sample_rate) {
+                    throw std::runtime_error("Stream " + std::to_string(stream_ids[i]) + " sample rate " +
+                                             std::to_string(rate) + " does not match " + std::to_string(sample_rate));
+                }
+                sample_rate = rate;
+            }
+
+            std::vector<int> uncovered;
+            for (size_t i = 0; i < rows.size(); ++i) {
+                std::complex<float>* row = out + i * n_samples;
+                if (rows[i] == nullptr || !rows[i]->copyWindow(t_start, n_samples, row)) {
+                    std::fill(row, row + n_samples, std::complex<float>(0, 0));
+                    uncovered.push_back(stream_ids[i]);
+                }
+            }
+            return uncovered;
+        }
+
+        // Caps the bytes allocated by all stream buffers together, 0 disables the budget.
+        // When it is exceeded the lowest priority, least recently read streams are trimmed first.
+        void setMemoryBudget(size_t bytes) {
+            memory_budget = bytes;
+        }
+
+        size_t getMemoryBudget() const {
+            return memory_budget;
+        }
+
+        size_t getMemoryUsage() {
+            std::lock_guard<std::mutex> lock(stream_id_mutex);
+            size_t total = 0;
+            for (const auto& stream : streams) {
+                total += stream.second->getAllocatedBytes();
+            }
+            return total;
+        }
+
+        // Health statistics of every stream, see VitaStream::getStats
+        std::vector<StreamStats> getStats(bool reset) {
+            std::vector<std::shared_ptr<VitaStream>> all;
+            {
+                std::lock_guard<std::mutex> lock(stream_id_mutex);
+                for (const auto& stream : streams) {
+                    all.push_back(stream.second);
+                }
+            }
+            std::vector<StreamStats> stats;
+            for (const auto& stream : all) {
+                stats.push_back(stream->getStats(reset));
+            }
+            return stats;
+        }
+
+        std::vector<StreamMemoryStats> getMemoryStats() {
+            std::lock_guard<std::mutex> lock(stream_id_mutex);
+            std::vector<StreamMemoryStats> stats;
+            for (const auto& stream : streams) {
+                stats.push_back(stream.second->getMemoryStats());
+            }
+            return stats;
+        }
+
+        void join() {
+            if (receiverThread.joinable()) {
+                receiverThread.join();
+            }
+            if (parserThread.joinable()) {
+                parserThread.join();
+            }
+            std::lock_guard<std::mutex> lock(loops_mutex);
+            for (const auto& loop : loops) {
+                if (loop->thread.joinable()) {
+                    loop->thread.join();
+                }
+            }
+        }
+
+        int run_tcp(const char* host, int port) {
+            startLegacy(openTcpSocket(host, port), std::string("tcp ") + host + ":" + std::to_string(port));
+            return 0;
+        }
+
+        int run_udp(const char* host, int port) {
+            startLegacy(openUdpSocket(host, port), std::string("udp ") + host + ":" + std::to_string(port));
+            return 0;
+        }
+
+        int run_multicast(const char* group, int port) {
+            startLegacy(openMulticastSocket(group, port), std::string("multicast ") + group + ":" + std::to_string(port));
+            return 0;
+        }
+
+        // Event loop mode: io_threads epoll threads read and parse every source added with addTcpSource,
+        // addUdpSource and addMulticastSource, instead of a receiver and parser thread pair per source.
+        // Adding a source starts two threads if this was not called first.
+        void startEventLoop(int io_threads) {
+            std::lock_guard<std::mutex> lock(loops_mutex);
+            if (!loops.empty()) {
+                throw std::runtime_error("Event loop already started");
+            }
+            for (int i = 0; i < std::max(1, io_threads); ++i) {
+                std::unique_ptr<EventLoop> loop(new EventLoop());
+                loop->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+                loop->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+                if (loop->epoll_fd < 0 || loop->wake_fd < 0) {
+                    throw std::runtime_error("epoll setup failed");
+                }
+                struct epoll_event event{};
+                event.events = EPOLLIN;
+                event.data.u64 = 0;
+                if (epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, loop->wake_fd, &event) < 0) {
+                    throw std::runtime_error("epoll_ctl(wake) failed");
+                }
+                // The first loop also does the housekeeping the parser thread does in the legacy mode
+                loop->thread = std::thread(&VitaSocket::eventLoop, this, loop.get(), i);
+                loops.push_back(std::move(loop));
+            }
+        }
+
+        // Pins ingest threads of a role ("receiver", "parser" or "io") to cpus, an empty list removes the pin.
+        // Like the other placement settings it applies to threads started afterwards.
+        void setThreadAffinity(const std::string& role, const std::vector<int>& cpus) {
+            if (role != "receiver" && role != "parser" && role != "io") {
+                throw std::runtime_error("Unknown thread role " + role);
+            }
+            for (int cpu : cpus) {
+                if (cpu < 0 || cpu >= CPU_SETSIZE) {
+                    throw std::runtime_error("CPU " + std::to_string(cpu) + " out of range");
+                }
+            }
+            std::lock_guard<std::mutex> lock(placement_mutex);
+            thread_affinity[role] = cpus;
+        }
+
+        // Runs ingest threads under SCHED_FIFO at this priority (1-99), 0 keeps the normal policy.
+        // Needs CAP_SYS_NICE, a refusal is reported in getThreadPlacement.
+        void setRealtimePriority(int priority) {
+            if (priority < 0 || priority > 99) {
+                throw std::runtime_error("SCHED_FIFO priority must be between 0 and 99");
+            }
+            realtime_priority = priority;
+        }
+
+        // Makes ingest threads prefer memory on this NUMA node, -1 restores the default. Stream and ingest buffers
+        // are first written by these threads, so that is where their pages are placed.
+        void setNumaNode(int node) {
+            if (node < -1 || node >= 64) {
+                throw std::runtime_error("NUMA node must be between -1 and 63");
+            }
+            numa_node = node;
+        }
 
-    double getFrequency() const {
-        std::lock_guard<std::mutex> lock(stream_mutex);
-        return context_packet.if_context.rf_reference_frequency_offset + context_packet.if_context.if_reference_frequency;
-    }
+        std::vector<ThreadPlacement> getThreadPlacement() {
+            std::lock_guard<std::mutex> lock(placement_mutex);
+            return placements;
+        }
 
-private:
-    std::vector<uint8_t> packet_data;
-    int stream_id;
-    int max_seconds;
-    mutable std::mutex stream_mutex;
-    vrt_packet context_packet;
+        // Socket tuning, applied to sockets opened afterwards. A receive buffer of 0 keeps the system default, force
+        // uses SO_RCVBUFFORCE to go past net.core.rmem_max and falls back to SO_RCVBUF without CAP_NET_ADMIN.
+        void setReceiveBuffer(int bytes, bool force) {
+            receive_buffer_bytes = std::max(0, bytes);
+            receive_buffer_force = force;
+        }
 
+        // SO_BUSY_POLL in microseconds, 0 leaves it off
+        void setBusyPoll(int microseconds) {
+            busy_poll_us = std::max(0, microseconds);
+        }
 
-    bool _hasContextPacket() const {
-        return context_packet.header.packet_type == VRT_PT_IF_CONTEXT;
-    }
+        // With false a multicast socket only receives the groups it joined itself (IP_MULTICAST_ALL)
+        void setMulticastAll(bool enabled) {
+            multicast_all = enabled;
+        }
 
-    float _getSecondsOfData() const {
-        if (!_hasContextPacket()) {
-            return 0;
+        // Interface name or IPv4 address to join multicast groups on, empty lets the kernel choose
+        void setMulticastInterface(const std::string& interface) {
+            std::lock_guard<std::mutex> lock(loops_mutex);
+            multicast_interface = interface;
         }
-        return packet_data.size() / _getSampleRate() / 4.0;
-    }
 
-    int _getSampleRate() const {
-        return 0 == context_packet.if_context.sample_rate ? 0 : context_packet.if_context.sample_rate;
-    }
+        // SO_TIMESTAMPNS: record the kernel arrival time of packets for getLatency
+        void setKernelTimestamps(bool enabled) {
+            kernel_timestamps = enabled;
+        }
 
+        std::vector<SocketStats> getSocketStats() {
+            std::vector<SocketStats> stats;
+            {
+                std::lock_guard<std::mutex> lock(buffer_mutex);
+                if (legacy_stats.source_id == 0 && !legacy_stats.description.empty()) {
+                    stats.push_back(legacy_stats);
+                }
+            }
+            std::lock_guard<std::mutex> lock(loops_mutex);
+            for (const auto& loop : loops) {
+                std::lock_guard<std::mutex> loop_lock(loop->mutex);
+                for (const auto& source : loop->sources) {
+                    stats.push_back(source.second.stats);
+                }
+            }
+            return stats;
+        }
 
-    int seconds_to_bytes(int seconds) {
-        // Don't keep data until we have a context packet
-        if (!_hasContextPacket()) {
-            return 0;
+        // Opt-in: IF context packets of known streams are read through a per-stream cache, so contexts that are
+        // resent unchanged skip the decode and the copy into the stream
+        void setContextCache(bool enabled) {
+            if (context_cache_enabled.exchange(enabled) == enabled) {
+                return;
+            }
+            // Contexts read while the cache was off never went through it, so what it holds may be stale
+            std::vector<std::shared_ptr<VitaStream>> all;
+            {
+                std::lock_guard<std::mutex> lock(stream_id_mutex);
+                for (const auto& stream : streams) {
+                    all.push_back(stream.second);
+                }
+            }
+            for (const auto& stream : all) {
+                stream->resetContextCache();
+            }
         }
 
-        int sample_rate = _getSampleRate();
-        int bytes_per_sample = 4;
-        int bytes_per_second = sample_rate * bytes_per_sample;
-        std::cout << "Bytes per second: " << bytes_per_second << std::endl;
-        return seconds * bytes_per_second;
-    }
-};
+        // Context cache hits and misses of every stream, see setContextCache
+        std::vector<ContextCacheStats> getContextCacheStats(bool reset) {
+            std::vector<std::shared_ptr<VitaStream>> all;
+            {
+                std::lock_guard<std::mutex> lock(stream_id_mutex);
+                for (const auto& stream : streams) {
+                    all.push_back(stream.second);
+                }
+            }
+            std::vector<ContextCacheStats> stats;
+            for (const auto& stream : all) {
+                stats.push_back(stream->getContextCacheStats(reset));
+            }
+            return stats;
+        }
 
+        // Arrival latency of every stream, see VitaStream::getLatency
+        std::vector<StreamLatency> getLatency(bool reset) {
+            std::vector<std::shared_ptr<VitaStream>> all;
+            {
+                std::lock_guard<std::mutex> lock(stream_id_mutex);
+                for (const auto& stream : streams) {
+                    all.push_back(stream.second);
+                }
+            }
+            std::vector<StreamLatency> latencies;
+            for (const auto& stream : all) {
+                latencies.push_back(stream->getLatency(reset));
+            }
+            return latencies;
+        }
 
-class VitaSocket {
+        // Each returns an ID for removeSource
+        int addTcpSource(const char* host, int port) {
+            return addSource(openTcpSocket(host, port), std::string("tcp ") + host + ":" + std::to_string(port));
+        }
 
-    public:
+        int addUdpSource(const char* host, int port) {
+            return addSource(openUdpSocket(host, port), std::string("udp ") + host + ":" + std::to_string(port));
+        }
 
-        VitaSocket(int buffer_size, bool little_endian=true) : buffer_size(buffer_size), little_endian(true), running(true) {
-            shared_buffer.reserve(buffer_size);
+        int addMulticastSource(const char* group, int port) {
+            return addSource(openMulticastSocket(group, port),
+                             std::string("multicast ") + group + ":" + std::to_string(port));
         }
 
-        void stop_vita_socket() {
-            running = false;
+        // Stops reading the source and closes its socket. Returns false for an unknown ID.
+        bool removeSource(int source_id) {
+            std::lock_guard<std::mutex> lock(loops_mutex);
+            for (const auto& loop : loops) {
+                std::lock_guard<std::mutex> loop_lock(loop->mutex);
+                auto it = loop->sources.find(source_id);
+                if (it != loop->sources.end()) {
+                    closeSource(*loop, it);
+                    return true;
+                }
+            }
+            return false;
         }
 
-        std::vector<int> getStreamIDs() {
-            std::lock_guard<std::mutex> lock(stream_id_mutex);
+        std::vector<int> getSourceIDs() {
+            std::lock_guard<std::mutex> lock(loops_mutex);
             std::vector<int> ids;
-            for (const auto& stream : streams) {
-                ids.push_back(stream.first);
+            for (const auto& loop : loops) {
+                std::lock_guard<std::mutex> loop_lock(loop->mutex);
+                for (const auto& source : loop->sources) {
+                    ids.push_back(source.first);
+                }
             }
             return ids;
         }
 
-        VitaStream* getStream(int stream_id) {
-            std::lock_guard<std::mutex> lock(stream_id_mutex);
-            if (streams.find(stream_id) == streams.end()) {
-                return nullptr;
-            }
-            return &streams.at(stream_id);
-        }
+    private:
 
+        // A socket served by an event loop. Stream sockets keep a partial packet in pending between reads.
+        struct IngestSource {
+            int fd;
+            std::string description;
+            ArenaBytes pending;
+            ArrivalMarkers arrivals;
+            SocketStats stats;
+        };
+
+        // One epoll instance and its thread. A source stays on one loop, so its pending bytes are only touched there.
+        struct EventLoop {
+            int epoll_fd = -1;
+            int wake_fd = -1;
+            std::thread thread;
+            // Held while events are handled and while sources are added or removed
+            std::mutex mutex;
+            std::map<int, IngestSource> sources;
+            // Receive buffer shared by the loop's sources, only the bytes received are appended to their pending
+            std::vector<uint8_t> scratch;
+        };
 
-        void join() {
-            receiverThread.join();
-            parserThread.join();
-        }
+        int buffer_size;
 
-        int run_tcp(const char* host, int port) {
+        bool little_endian;
+
+        std::mutex buffer_mutex;
+        
+        std::mutex stream_id_mutex;
+
+        // std::vector<uint32_t> shared_buffer;
+        ArenaBytes shared_buffer;
+
+        std::atomic<bool> running;
+
+        std::atomic<size_t> memory_budget{0};
+
+        std::atomic<double> idle_timeout_seconds{0};
+        std::vector<int> retired_ids;
+
+        std::thread receiverThread;
+        std::thread parserThread;
+        // Sockets of the legacy threads, shut down by stop_vita_socket to unblock recv
+        std::vector<int> legacy_fds;
+
+        std::mutex placement_mutex;
+        std::map<std::string, std::vector<int>> thread_affinity;
+        std::atomic<int> realtime_priority{0};
+        std::atomic<int> numa_node{-1};
+        std::vector<ThreadPlacement> placements;
+
+        std::atomic<int> receive_buffer_bytes{0};
+        std::atomic<bool> receive_buffer_force{false};
+        std::atomic<int> busy_poll_us{0};
+        std::atomic<bool> multicast_all{true};
+        std::atomic<bool> kernel_timestamps{false};
+        std::atomic<bool> context_cache_enabled{false};
+        // Guarded by loops_mutex
+        std::string multicast_interface;
+        // Guarded by buffer_mutex, like the arrival markers of shared_buffer
+        SocketStats legacy_stats{-1, "", 0, 0, 0, 0};
+        ArrivalMarkers shared_arrivals;
+
+        std::mutex loops_mutex;
+        std::vector<std::unique_ptr<EventLoop>> loops;
+        int next_source_id = 1;
+        
+        // Python may hold on to a stream after it is retired, so streams are shared
+        std::map<int, std::shared_ptr<VitaStream>> streams;
+
+        // Connected TCP socket
+        int openTcpSocket(const char* host, int port) {
 
             struct sockaddr_in servaddr;
             int sockfd = socket(AF_INET, SOCK_STREAM, 0);
@@ -164,6 +2578,7 @@ class VitaSocket {
             if (setsockopt(sockfd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int)) < 0) {
                 throw std::runtime_error("setsockopt(SO_REUSEADDR) failed");
             }
+            applySocketOptions(sockfd, false);
 
             std::memset(&servaddr, 0, sizeof(servaddr));
             servaddr.sin_family = AF_INET;
@@ -178,14 +2593,11 @@ class VitaSocket {
                 throw std::runtime_error("Connection Failed");
             }
 
-            receiverThread = std::thread(&VitaSocket::receiveData, this, sockfd, servaddr);
-            parserThread = std::thread(&VitaSocket::parseData, this);
-
-            return 0;
+            return sockfd;
         }
 
-
-        int run_udp(const char* host, int port){
+        // UDP socket bound to host:port
+        int openUdpSocket(const char* host, int port) {
 
             struct sockaddr_in servaddr;
             int sockfd = socket(AF_INET, SOCK_DGRAM, 0);
@@ -197,6 +2609,7 @@ class VitaSocket {
             if (setsockopt(sockfd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int)) < 0) {
                 throw std::runtime_error("setsockopt(SO_REUSEADDR) failed");
             }
+            applySocketOptions(sockfd, true);
 
             std::memset(&servaddr, 0, sizeof(servaddr));
             servaddr.sin_family = AF_INET;
@@ -210,13 +2623,11 @@ class VitaSocket {
                 throw std::runtime_error("bind failed");
             }
 
-            receiverThread = std::thread(&VitaSocket::receiveData, this, sockfd, servaddr);
-            parserThread = std::thread(&VitaSocket::parseData, this);
-
-            return 0;
+            return sockfd;
         }
-        
-        int run_multicast(const char* group, int port) {
+
+        // UDP socket bound to port that has joined group
+        int openMulticastSocket(const char* group, int port) {
             struct sockaddr_in servaddr;
             int sockfd = socket(AF_INET, SOCK_DGRAM, 0);
             if (sockfd < 0) {
@@ -228,6 +2639,12 @@ class VitaSocket {
             if (setsockopt(sockfd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int)) < 0) {
                 throw std::runtime_error("setsockopt(SO_REUSEADDR) failed");
             }
+            applySocketOptions(sockfd, true);
+
+            int all = multicast_all ? 1 : 0;
+            if (setsockopt(sockfd, IPPROTO_IP, IP_MULTICAST_ALL, &all, sizeof(all)) < 0) {
+                throw std::runtime_error("setsockopt(IP_MULTICAST_ALL) failed");
+            }
 
             std::memset(&servaddr, 0, sizeof(servaddr));
             servaddr.sin_family = AF_INET;
@@ -240,46 +2657,352 @@ class VitaSocket {
             }
 
             // Join the multicast group
-            struct ip_mreq mreq;
+            struct ip_mreqn mreq;
             std::memset(&mreq, 0, sizeof(mreq));
             mreq.imr_multiaddr.s_addr = inet_addr(group); // Multicast group
-            mreq.imr_interface.s_addr = htonl(INADDR_ANY); // Default interface
+            mreq.imr_address.s_addr = htonl(INADDR_ANY); // Default interface
+            std::string interface;
+            {
+                std::lock_guard<std::mutex> lock(loops_mutex);
+                interface = multicast_interface;
+            }
+            if (!interface.empty()) {
+                // An address picks the interface that owns it, anything else is taken as an interface name
+                if (inet_pton(AF_INET, interface.c_str(), &mreq.imr_address) <= 0) {
+                    mreq.imr_ifindex = static_cast<int>(if_nametoindex(interface.c_str()));
+                    if (mreq.imr_ifindex == 0) {
+                        throw std::runtime_error("Unknown multicast interface " + interface);
+                    }
+                }
+            }
 
             if (setsockopt(sockfd, IPPROTO_IP, IP_ADD_MEMBERSHIP, 
                         reinterpret_cast<const char*>(&mreq), sizeof(mreq)) < 0) {
                 throw std::runtime_error("setsockopt(IP_ADD_MEMBERSHIP) failed");
             }
 
-            // Start threads to receive and parse data as before
-            receiverThread = std::thread(&VitaSocket::receiveData, this, sockfd, servaddr);
+            return sockfd;
+        }
+
+        void applySocketOptions(int sockfd, bool datagram) {
+            int bytes = receive_buffer_bytes;
+            if (bytes > 0) {
+                bool forced = receive_buffer_force &&
+                              setsockopt(sockfd, SOL_SOCKET, SO_RCVBUFFORCE, &bytes, sizeof(bytes)) == 0;
+                if (!forced && setsockopt(sockfd, SOL_SOCKET, SO_RCVBUF, &bytes, sizeof(bytes)) < 0) {
+                    throw std::runtime_error("setsockopt(SO_RCVBUF) failed");
+                }
+            }
+
+            int busy_poll = busy_poll_us;
+            if (busy_poll > 0 && setsockopt(sockfd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll, sizeof(busy_poll)) < 0) {
+                throw std::runtime_error("setsockopt(SO_BUSY_POLL) failed");
+            }
+
+            int enable = 1;
+            if (kernel_timestamps && setsockopt(sockfd, SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable)) < 0) {
+                throw std::runtime_error("setsockopt(SO_TIMESTAMPNS) failed");
+            }
+            // Drop counts are only kept for datagram sockets, and cost nothing to ask for
+            if (datagram && setsockopt(sockfd, SOL_SOCKET, SO_RXQ_OVFL, &enable, sizeof(enable)) < 0) {
+                throw std::runtime_error("setsockopt(SO_RXQ_OVFL) failed");
+            }
+        }
+
+        static int grantedReceiveBuffer(int sockfd) {
+            int bytes = 0;
+            socklen_t length = sizeof(bytes);
+            getsockopt(sockfd, SOL_SOCKET, SO_RCVBUF, &bytes, &length);
+            return bytes;
+        }
+
+        void startLegacy(int sockfd, const std::string& description) {
+            {
+                std::lock_guard<std::mutex> lock(loops_mutex);
+                legacy_fds.push_back(sockfd);
+            }
+            {
+                std::lock_guard<std::mutex> lock(buffer_mutex);
+                legacy_stats = SocketStats{0, description, 0, 0, 0, grantedReceiveBuffer(sockfd)};
+            }
+            receiverThread = std::thread(&VitaSocket::receiveData, this, sockfd);
             parserThread = std::thread(&VitaSocket::parseData, this);
+        }
 
-            return 0;
+        // Applies the affinity, memory policy and scheduling settings to the calling thread and records the result
+        void placeThread(const std::string& role, int index) {
+            std::vector<int> cpus;
+            {
+                std::lock_guard<std::mutex> lock(placement_mutex);
+                auto it = thread_affinity.find(role);
+                if (it != thread_affinity.end()) {
+                    cpus = it->second;
+                }
+            }
+
+            std::string errors;
+            if (!cpus.empty()) {
+                cpu_set_t set;
+                CPU_ZERO(&set);
+                for (int cpu : cpus) {
+                    CPU_SET(cpu, &set);
+                }
+                int rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+                if (rc != 0) {
+                    errors += std::string("affinity: ") + strerror(rc) + "; ";
+                }
+            }
+
+            // Raw syscalls so there is no libnuma dependency, the values are MPOL_DEFAULT and MPOL_PREFERRED
+            constexpr int mpol_default = 0;
+            constexpr int mpol_preferred = 1;
+            int node = numa_node;
+            if (node >= 0) {
+                // The kernel reads maxnode - 1 bits, so one more than the mask holds for node 63 to count
+                unsigned long mask = 1UL << node;
+                if (syscall(SYS_set_mempolicy, mpol_preferred, &mask, sizeof(mask) * 8 + 1) != 0) {
+                    errors += std::string("numa: ") + strerror(errno) + "; ";
+                }
+            }
+
+            int priority = realtime_priority;
+            if (priority > 0) {
+                struct sched_param param{};
+                param.sched_priority = priority;
+                int rc = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+                if (rc != 0) {
+                    errors += std::string("sched_fifo: ") + strerror(rc) + "; ";
+                }
+            }
+
+            // Read back what actually applies
+            ThreadPlacement placement{role, index, static_cast<long>(syscall(SYS_gettid)), {}, -1, -1, -1, "", 0, errors};
+            cpu_set_t actual;
+            CPU_ZERO(&actual);
+            if (pthread_getaffinity_np(pthread_self(), sizeof(actual), &actual) == 0) {
+                for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                    if (CPU_ISSET(cpu, &actual)) {
+                        placement.cpus.push_back(cpu);
+                    }
+                }
+            }
+            unsigned cpu = 0;
+            unsigned cpu_node = 0;
+            if (syscall(SYS_getcpu, &cpu, &cpu_node, nullptr) == 0) {
+                placement.cpu = static_cast<int>(cpu);
+                placement.numa_node = static_cast<int>(cpu_node);
+            }
+            int mode = mpol_default;
+            unsigned long mask = 0;
+            if (syscall(SYS_get_mempolicy, &mode, &mask, sizeof(mask) * 8 + 1, nullptr, 0UL) == 0 && mode == mpol_preferred) {
+                for (int bit = 0; bit < 64; ++bit) {
+                    if (mask & (1UL << bit)) {
+                        placement.memory_node = bit;
+                        break;
+                    }
+                }
+            }
+            int policy = SCHED_OTHER;
+            struct sched_param param{};
+            if (pthread_getschedparam(pthread_self(), &policy, &param) == 0) {
+                placement.policy = policy == SCHED_FIFO ? "SCHED_FIFO" : policy == SCHED_RR ? "SCHED_RR" : "SCHED_OTHER";
+                placement.priority = param.sched_priority;
+            }
+
+            std::lock_guard<std::mutex> lock(placement_mutex);
+            // A restarted thread replaces its old record
+            placements.erase(std::remove_if(placements.begin(), placements.end(), [&](const ThreadPlacement& p) {
+                return p.role == role && p.index == index;
+            }), placements.end());
+            placements.push_back(placement);
         }
 
+        int addSource(int sockfd, const std::string& description) {
+            int flags = fcntl(sockfd, F_GETFL, 0);
+            if (flags < 0 || fcntl(sockfd, F_SETFL, flags | O_NONBLOCK) < 0) {
+                close(sockfd);
+                throw std::runtime_error("fcntl(O_NONBLOCK) failed");
+            }
 
+            bool empty;
+            {
+                std::lock_guard<std::mutex> lock(loops_mutex);
+                empty = loops.empty();
+            }
+            if (empty) {
+                startEventLoop(2);
+            }
 
-    private:
+            std::lock_guard<std::mutex> lock(loops_mutex);
+            // The loop with the fewest sources takes the new one
+            EventLoop* loop = nullptr;
+            for (const auto& candidate : loops) {
+                std::lock_guard<std::mutex> loop_lock(candidate->mutex);
+                if (loop == nullptr || candidate->sources.size() < loop->sources.size()) {
+                    loop = candidate.get();
+                }
+            }
 
-        int buffer_size;
+            int source_id = next_source_id++;
+            std::lock_guard<std::mutex> loop_lock(loop->mutex);
+            struct epoll_event event{};
+            event.events = EPOLLIN | EPOLLRDHUP;
+            event.data.u64 = static_cast<uint64_t>(source_id);
+            if (epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, sockfd, &event) < 0) {
+                close(sockfd);
+                throw std::runtime_error("epoll_ctl(add) failed");
+            }
+            loop->sources.emplace(source_id, IngestSource{sockfd, description, {}, {},
+                                                          SocketStats{source_id, description, 0, 0, 0, grantedReceiveBuffer(sockfd)}});
+            std::cout << "C++: Added source " << source_id << " " << description << std::endl;
+            return source_id;
+        }
 
-        bool little_endian;
+        // Caller holds loop.mutex
+        void closeSource(EventLoop& loop, std::map<int, IngestSource>::iterator it) {
+            epoll_ctl(loop.epoll_fd, EPOLL_CTL_DEL, it->second.fd, nullptr);
+            close(it->second.fd);
+            std::cout << "C++: Removed source " << it->first << " " << it->second.description << std::endl;
+            loop.sources.erase(it);
+        }
 
-        std::mutex buffer_mutex;
-        
-        std::mutex stream_id_mutex;
+        // Reads what the socket has without blocking and parses every complete packet.
+        // Returns false once the peer has closed or the socket failed.
+        bool readSource(IngestSource& source, std::vector<uint8_t>& scratch) {
+            scratch.resize(std::max(buffer_size, 65536));
+            // A bounded number of reads per wakeup so one busy source can not starve the others on the loop
+            for (int reads = 0; reads < 64; ++reads) {
+                int64_t arrival_ns = 0;
+                uint32_t drops = static_cast<uint32_t>(source.stats.kernel_drops);
+                ssize_t n = receiveChunk(source.fd, scratch.data(), scratch.size(), arrival_ns, drops);
+                source.stats.kernel_drops = drops;
+                if (n > 0) {
+                    source.pending.insert(source.pending.end(), scratch.data(), scratch.data() + n);
+                    source.stats.reads += 1;
+                    source.stats.bytes += n;
+                    if (arrival_ns > 0) {
+                        source.arrivals.add(source.pending.size(), arrival_ns);
+                    }
+                }
+                if (n < 0) {
+                    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                        return true;
+                    }
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    perror("recv failed");
+                    return false;
+                }
+                if (n == 0) {
+                    // End of stream for TCP, an empty datagram otherwise
+                    int type = 0;
+                    socklen_t length = sizeof(type);
+                    getsockopt(source.fd, SOL_SOCKET, SO_TYPE, &type, &length);
+                    if (type == SOCK_STREAM) {
+                        return false;
+                    }
+                    continue;
+                }
 
-        // std::vector<uint32_t> shared_buffer;
-        std::vector<uint8_t> shared_buffer;
+                parseSource(source);
+                // Same overflow policy as the shared buffer of the legacy mode
+                if (source.pending.size() > 1000000000) {
+                    std::cerr << "O" << std::endl << std::flush;
+                    source.pending.clear();
+                    source.arrivals.clear();
+                }
+            }
+            return true;
+        }
 
-        std::atomic<bool> running;
+        // Parses the complete packets at the front of the source's pending bytes. Packet sizes are taken from the
+        // headers first, so a packet split across reads waits for the rest instead of being treated as corrupt.
+        void parseSource(IngestSource& source) {
+            ArenaBytes& pending = source.pending;
+            while (pending.size() >= 4) {
+                size_t framed = 0;
+                while (framed + 4 <= pending.size()) {
+                    // Packet size in words, the low half of the network order header word
+                    size_t words = (static_cast<size_t>(pending[framed + 2]) << 8) | pending[framed + 3];
+                    if (words == 0 || framed + words * 4 > pending.size()) {
+                        break;
+                    }
+                    framed += words * 4;
+                }
 
-        std::thread receiverThread;
-        std::thread parserThread;
-        
-        std::map<int, VitaStream> streams;
+                int consumed = framed == 0 ? 0 : processVRT(pending, 0, framed, &source.arrivals);
+                if (consumed <= 0) {
+                    bool corrupt_header = ((static_cast<size_t>(pending[2]) << 8) | pending[3]) == 0;
+                    if (!corrupt_header) {
+                        break;
+                    }
+                    // Resync a byte at a time, like processVRT does on a bad packet
+                    consumed = 1;
+                }
+                consumed = static_cast<int>(std::min<size_t>(consumed, pending.size()));
+                pending.erase(pending.begin(), pending.begin() + consumed);
+                source.arrivals.erase(consumed);
+            }
+        }
+
+        void eventLoop(EventLoop* loop, int index) {
+            placeThread("io", index);
+            bool housekeeping = index == 0;
+            std::vector<struct epoll_event> events(64);
+            clock_t last_print = clock();
+            auto last_sweep = std::chrono::steady_clock::now();
+
+            while (running) {
+                // The timeout bounds how long housekeeping waits on an idle loop
+                int n = epoll_wait(loop->epoll_fd, events.data(), static_cast<int>(events.size()), 100);
+                if (n < 0 && errno != EINTR) {
+                    perror("epoll_wait failed");
+                    break;
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(loop->mutex);
+                    for (int i = 0; i < n; ++i) {
+                        if (events[i].data.u64 == 0) {
+                            uint64_t count;
+                            if (read(loop->wake_fd, &count, sizeof(count)) < 0) {
+                                // Nothing to reset
+                            }
+                            continue;
+                        }
+                        // The source may have been removed since epoll_wait returned
+                        auto it = loop->sources.find(static_cast<int>(events[i].data.u64));
+                        if (it == loop->sources.end()) {
+                            continue;
+                        }
+                        bool open = readSource(it->second, loop->scratch);
+                        if (!open || (events[i].events & (EPOLLERR | EPOLLHUP))) {
+                            closeSource(*loop, it);
+                        }
+                    }
+                }
+
+                if (housekeeping) {
+                    if (clock() - last_print > CLOCKS_PER_SEC*5) {
+                        last_print = clock();
+                        print_info();
+                    }
+                    if (std::chrono::steady_clock::now() - last_sweep > std::chrono::seconds(1)) {
+                        last_sweep = std::chrono::steady_clock::now();
+                        retireIdleStreams();
+                    }
+                    enforceMemoryBudget();
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(loop->mutex);
+            while (!loop->sources.empty()) {
+                closeSource(*loop, loop->sources.begin());
+            }
+        }
 
-        void addPacketToStream(int stream_id, const vrt_packet& packet) {
+        void addPacketToStream(int stream_id, const vrt_packet& packet, int64_t arrival_ns, bool context_changed = true) {
             std::lock_guard<std::mutex> lock(stream_id_mutex);
             if (streams.find(stream_id) == streams.end()) {
 
@@ -289,119 +3012,200 @@ class VitaSocket {
                     return;
                 }
 
-                // Doing a no copy emplace
-                streams.emplace(std::piecewise_construct, 
-                std::forward_as_tuple(stream_id), 
-                std::forward_as_tuple(stream_id));
+                streams.emplace(stream_id, std::make_shared<VitaStream>(stream_id));
 
 
             }
-            streams.at(stream_id).addPacket(packet);
+            streams.at(stream_id)->addPacket(packet, arrival_ns, context_changed);
         }
 
-        uint32_t littleEndianToUint32(const std::vector<uint8_t>& vec, size_t index) {
-            return static_cast<uint32_t>(vec[index]) << 24|
-                static_cast<uint32_t>(vec[index + 1]) << 16 |
-                static_cast<uint32_t>(vec[index + 2]) << 8 |
-                static_cast<uint32_t>(vec[index + 3]);
+        void addPacketToStream(int stream_id, const vrt_packet_view& packet, int64_t arrival_ns) {
+            std::lock_guard<std::mutex> lock(stream_id_mutex);
+            if (streams.find(stream_id) == streams.end()) {
+                streams.emplace(stream_id, std::make_shared<VitaStream>(stream_id));
+            }
+            streams.at(stream_id)->addPacket(packet, arrival_ns);
         }
 
-        int processVRT(std::vector<uint8_t> &local_buffer, int local_buffer_offset) {
-
-            // Only use the valid words e.g 4 bytes
-            int local_buffer_size = local_buffer.size() - local_buffer_offset;
-            local_buffer_size = local_buffer_size - (local_buffer_size % 4);
-
-            
-            std::vector<uint32_t> uint32_vector; 
-            uint32_vector.reserve(local_buffer_size / 4);
+        void retireIdleStreams() {
+            double timeout = idle_timeout_seconds;
+            if (timeout <= 0) {
+                return;
+            }
 
-            if (little_endian){
-                // Need to cast local_buffer to unit32_t 
-                // Have to be carefull because the buffer is little endian, but we are on a big endian system
-                for (int i = local_buffer_offset; i <= local_buffer_size-4; i += 4) {
-                    uint32_vector.push_back(littleEndianToUint32(local_buffer, i));
+            auto now = std::chrono::steady_clock::now();
+            std::vector<std::shared_ptr<VitaStream>> idle;
+            {
+                std::lock_guard<std::mutex> lock(stream_id_mutex);
+                for (auto it = streams.begin(); it != streams.end();) {
+                    std::chrono::duration<double> silent = now - it->second->getLastPacket();
+                    if (silent.count() > timeout) {
+                        idle.push_back(it->second);
+                        retired_ids.push_back(it->first);
+                        it = streams.erase(it);
+                    } else {
+                        ++it;
+                    }
                 }
-            } else {
-                // We are on a big endian system so we can just cast the buffer to uint32_t
-                uint32_vector = std::vector<uint32_t>(reinterpret_cast<uint32_t*>(local_buffer.data() + local_buffer_offset), reinterpret_cast<uint32_t*>(local_buffer.data() + local_buffer_size));
             }
-            
 
-            int size = uint32_vector.size();
+            // Free the memory outside the map lock, handles held by Python keep the (now empty) object alive
+            for (const auto& stream : idle) {
+                std::cout << "C++: Retired idle stream " << stream->getStreamID() << std::endl;
+                stream->retire();
+            }
+        }
 
-            int32_t offset = 0;
+        void enforceMemoryBudget() {
+            size_t budget = memory_budget;
+            if (budget == 0) {
+                return;
+            }
 
-            while (offset + 40 < size) {
-                // std::cout << "Main loop" << std::endl;
-                struct vrt_packet p;
-                // std::cout<< "Offset: " << offset << " Size: " << size << std::endl;
-                int32_t rv = vrt_read_packet(uint32_vector.data() + offset, uint32_vector.size(), &p, true);
-                if (rv == -1){
-                    break;
-                    // if (size - offset < 1000){
-                    //     // Could be buffer is to small or may just be a bad packet
-                    //     break;
-                    // }
-                    // // Shift the buffer by 1 byte and try again
-                    // return (offset * 4) + 1;
-                }
-                if (rv < 0) {
-                    std::cerr << "Failed to parse packet: " << vrt_string_error(rv) << " " << rv << std::endl;
-                    // Shift the buffer by 1 byte and try again
-                    return (offset * 4) + 1;
+            struct Candidate {
+                std::shared_ptr<VitaStream> stream;
+                int priority;
+                std::chrono::steady_clock::time_point last_read;
+            };
+            std::vector<Candidate> candidates;
+            size_t total = 0;
+            {
+                std::lock_guard<std::mutex> lock(stream_id_mutex);
+                for (auto& stream : streams) {
+                    total += stream.second->getAllocatedBytes();
+                    candidates.push_back({stream.second, stream.second->getPriority(), stream.second->getLastRead()});
                 }
+            }
+            if (total <= budget) {
+                return;
+            }
 
-                // Check if the packet is within the buffer
-                // VRT dose not allways insure that the packet is complete
-                if (rv + offset > size){
-                    std::cout << "Packet size: " << rv << std::endl;
-                    // std::cout << "Offset: " << offset << " Size: " << size << std::endl;
-                    return (offset * 4) + 1;
+            // Trim to 90% of the budget so we are not evicting on every parse pass
+            size_t target = budget - budget / 10;
+            std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+                return a.priority != b.priority ? a.priority < b.priority : a.last_read < b.last_read;
+            });
+            for (const auto& candidate : candidates) {
+                if (total <= target) {
+                    break;
                 }
+                size_t released = candidate.stream->evict(total - target);
+                total -= std::min(total, released);
+            }
+        }
 
+        // Network order payload words to host order, in place. Streams only keep the body, so nothing else of a
+        // packet read with the _be readers is ever swapped.
+        static void bodyToHost(vrt_packet_view& view) {
+            uint32_t* words = static_cast<uint32_t*>(view.body);
+            for (int32_t i = 0; i < view.words_body; ++i) {
+                words[i] = __builtin_bswap32(words[i]);
+            }
+        }
 
-                // Check if the packet.body (void*) is pointing within the buffer
-                // If not then the packet failed to parse
-                // Nullptr is allowed due to context packets
-                if (p.header.packet_type <= VRT_PT_EXT_DATA_WITH_STREAM_ID){
-                    // cast p.body to unit32_t*  
-                    uint32_t* body = static_cast<uint32_t*>(p.body);
-                    if (body < uint32_vector.data() + offset || body + p.words_body > uint32_vector.data() + size){
-                        std::cout << "Packet size: " << rv << std::endl;
-                        std::cout << "Offset: " << offset << " Size: " << size << std::endl;
-                        return (offset * 4) + 1;
-                    }
+        // local_buffer_end limits parsing to a prefix of the buffer, arrivals gives the kernel arrival times of its bytes
+        int processVRT(ArenaBytes &local_buffer, int local_buffer_offset,
+                       size_t local_buffer_end = std::numeric_limits<size_t>::max(),
+                       const ArrivalMarkers* arrivals = nullptr) {
 
-                    if (p.words_body <= 0){
-                        std::cerr << "Packet body size is not valid: " << p.words_body << std::endl; 
-                        return (offset * 4) + 1;
-                    }
-                }
+            // Only use the valid words e.g 4 bytes
+            int local_buffer_size = std::min(local_buffer.size(), local_buffer_end) - local_buffer_offset;
+            local_buffer_size = local_buffer_size - (local_buffer_size % 4);
+
+            // Packets are framed and read straight from the receive buffer. It is in network order, so on a little
+            // endian host the _be readers decode the headers and only the bodies handed to streams are swapped.
+            uint32_t* words = reinterpret_cast<uint32_t*>(local_buffer.data() + local_buffer_offset);
+            const bool be = little_endian;
+            int size = local_buffer_size / 4;
 
-                // Check to make sure that packet.header.packet_count top 4 bits are 0
-                // Only the last 4 bits are used
-                int top_4_bits = p.header.packet_count & 0xF0;
-                if (top_4_bits != 0){
-                    std::cerr << "Packet Count top 4 bits are not 0 they are " << top_4_bits << std::endl;
+            int32_t offset = 0;
+
+            // Packet boundaries are found with a cheap peek at the header and fields of each packet, the full decode
+            // below then only has to look at one packet at a time
+            std::array<vrt_packet_desc, 64> descs;
+            while (offset < size) {
+                int32_t framed = be ? vrt_frame_packets_be(words + offset, size - offset, descs.data(),
+                                                           static_cast<int32_t>(descs.size()), true)
+                                    : vrt_frame_packets(words + offset, size - offset, descs.data(),
+                                                        static_cast<int32_t>(descs.size()), true);
+                if (framed == 0) {
+                    // Incomplete packet, wait for more data
+                    break;
+                }
+                if (framed < 0) {
+                    std::cerr << "Failed to parse packet: " << vrt_string_error(framed) << " " << framed << std::endl;
+                    // Shift the buffer by 1 byte and try again
                     return (offset * 4) + 1;
                 }
 
-                if (p.header.packet_type == VRT_PT_IF_CONTEXT) {
-                    // Check if the packet is a context packet that is has a positive sample rate
-                    if (p.if_context.sample_rate <= 0) {
-                        std::cerr << "Sample rate is not valid" << std::endl;
+                for (int32_t i = 0; i < framed; ++i) {
+                    const vrt_packet_desc& desc = descs[i];
+
+                    // Check to make sure that packet.header.packet_count top 4 bits are 0
+                    // Only the last 4 bits are used
+                    int top_4_bits = desc.header.packet_count & 0xF0;
+                    if (top_4_bits != 0){
+                        std::cerr << "Packet Count top 4 bits are not 0 they are " << top_4_bits << std::endl;
                         return (offset * 4) + 1;
                     }
 
-                    if (p.body != nullptr){
-                        std::cerr << "Context packet body is not null" << std::endl;
-                        return (offset * 4) + 1;
+                    int32_t rv;
+                    int64_t arrival_ns =
+                        arrivals ? arrivals->at(local_buffer_offset + (offset + desc.header.packet_size) * 4) : 0;
+                    if (desc.header.packet_type == VRT_PT_IF_CONTEXT) {
+                        struct vrt_packet p;
+                        bool context_changed = true;
+                        std::shared_ptr<VitaStream> context_stream;
+                        if (context_cache_enabled) {
+                            context_stream = getStream(desc.stream_id);
+                        }
+                        rv = context_stream ?
+                            context_stream->readContext(words + offset, desc, &p, &context_changed, be) :
+                            be ? vrt_read_packet_be(words + offset, desc.header.packet_size, &p, true) :
+                            vrt_read_packet(words + offset, desc.header.packet_size, &p, true);
+                        if (rv < 0) {
+                            std::cerr << "Failed to parse packet: " << vrt_string_error(rv) << " " << rv << std::endl;
+                            // Shift the buffer by 1 byte and try again
+                            return (offset * 4) + 1;
+                        }
+
+                        // Check if the packet is a context packet that is has a positive sample rate
+                        if (p.if_context.sample_rate <= 0) {
+                            std::cerr << "Sample rate is not valid" << std::endl;
+                            return (offset * 4) + 1;
+                        }
+
+                        if (p.body != nullptr){
+                            std::cerr << "Context packet body is not null" << std::endl;
+                            return (offset * 4) + 1;
+                        }
+
+                        addPacketToStream(p.fields.stream_id, p, arrival_ns, context_changed);
+                    } else {
+                        // Everything else is read into the slim view, which skips the IF context of a vrt_packet
+                        vrt_packet_view view;
+                        rv = be ? vrt_read_packet_view_be(words + offset, desc.header.packet_size, &view, true)
+                                : vrt_read_packet_view(words + offset, desc.header.packet_size, &view, true);
+                        if (rv < 0) {
+                            std::cerr << "Failed to parse packet: " << vrt_string_error(rv) << " " << rv << std::endl;
+                            // Shift the buffer by 1 byte and try again
+                            return (offset * 4) + 1;
+                        }
+
+                        // Ext context packets may have an empty body
+                        if (view.header.packet_type <= VRT_PT_EXT_DATA_WITH_STREAM_ID && view.words_body <= 0){
+                            std::cerr << "Packet body size is not valid: " << view.words_body << std::endl;
+                            return (offset * 4) + 1;
+                        }
+
+                        if (be) {
+                            bodyToHost(view);
+                        }
+
+                        addPacketToStream(view.fields.stream_id, view, arrival_ns);
                     }
+                    offset += rv;
                 }
-
-                addPacketToStream(p.fields.stream_id, p);
-                offset += rv;
             }
 
             if (offset > size){
@@ -413,23 +3217,41 @@ class VitaSocket {
         }
 
         void print_info() {
+            // Ingest threads add and retire streams concurrently, so copy the handles out and format without the lock
+            size_t buffered = 0;
+            {
+                std::lock_guard<std::mutex> lock(buffer_mutex);
+                buffered = shared_buffer.size();
+            }
+            std::vector<std::shared_ptr<VitaStream>> snapshot;
+            {
+                std::lock_guard<std::mutex> lock(stream_id_mutex);
+                snapshot.reserve(streams.size());
+                for (const auto& stream : streams) {
+                    snapshot.push_back(stream.second);
+                }
+            }
+
             // Rather then printing line by line lets build the data and then print it
             std::string data;
-            data += "C++: Vita Socket INFO shared buffer size " + std::to_string(shared_buffer.size()) + "\n";
-            data += "C++: Stream Count: " + std::to_string(streams.size()) + "\n";
-            for (const auto& stream : streams) {
-                if (stream.second.getSampleRate() > 0){
-                    data += "   C++: Stream ID: " + std::to_string(stream.first) + " Sample Rate: " + std::to_string(stream.second.getSampleRate()) + " Seconds of Data: " + std::to_string(stream.second.getSecondsOfData()) + "\n";
+            data += "C++: Vita Socket INFO shared buffer size " + std::to_string(buffered) + "\n";
+            data += "C++: Stream Count: " + std::to_string(snapshot.size()) + "\n";
+            for (const auto& stream : snapshot) {
+                if (stream->getSampleRate() > 0){
+                    data += "   C++: Stream ID: " + std::to_string(stream->getStreamID()) + " Sample Rate: " + std::to_string(stream->getSampleRate()) + " Seconds of Data: " + std::to_string(stream->getSecondsOfData()) + "\n";
                 }
             }
             std::cout << data << std::flush;
         }
 
         void parseData() {
-            std::vector<uint8_t> local_buffer;
+            placeThread("parser", 0);
+            ArenaBytes local_buffer;
             local_buffer.reserve(buffer_size);
+            ArrivalMarkers local_arrivals;
             int local_buffer_offset = 0;
             clock_t last_print = clock();
+            auto last_sweep = std::chrono::steady_clock::now();
 
 
         
@@ -441,6 +3263,11 @@ class VitaSocket {
                     print_info();
                 }
 
+                if (std::chrono::steady_clock::now() - last_sweep > std::chrono::seconds(1)) {
+                    last_sweep = std::chrono::steady_clock::now();
+                    retireIdleStreams();
+                }
+
                 {
                     std::unique_lock<std::mutex> lock(buffer_mutex);
                     if (shared_buffer.size() == 0) {
@@ -450,14 +3277,16 @@ class VitaSocket {
                         continue;
                     }
                     // Add shared buffer to the end of the local buffer
+                    local_arrivals.append(shared_arrivals, local_buffer.size());
                     local_buffer.resize(shared_buffer.size() + local_buffer.size());
                     std::copy(shared_buffer.begin(), shared_buffer.end(), local_buffer.end() - shared_buffer.size());
                     shared_buffer.clear();
                     lock.unlock();
                 }
 
-                int offset = processVRT(local_buffer, local_buffer_offset);
+                int offset = processVRT(local_buffer, local_buffer_offset, std::numeric_limits<size_t>::max(), &local_arrivals);
                 offset += local_buffer_offset;
+                enforceMemoryBudget();
 
                 if (offset > 0 && offset < local_buffer.size()) {
                     int remaining = (local_buffer.size() - offset);
@@ -470,6 +3299,7 @@ class VitaSocket {
                         local_buffer_offset = offset;
                     } else {
                         std::copy(local_buffer.end() - remaining, local_buffer.end(), local_buffer.begin());
+                        local_arrivals.erase(local_buffer.size() - remaining);
                         local_buffer.resize(remaining);
                         local_buffer_offset = 0;
                     }
@@ -477,8 +3307,10 @@ class VitaSocket {
                 } else if (offset == -1) {
                     std::cerr << "Clearing buffer due to failure to parse packet" << std::endl;
                     local_buffer.clear();
+                    local_arrivals.clear();
                 } else if (offset == local_buffer.size()) {
                     local_buffer.clear();
+                    local_arrivals.clear();
                 }
                 else if (offset == 0 && local_buffer.size() > 300){
                     std::cout << "This should not happen " << offset << " " << local_buffer.size() << std::endl;
@@ -491,14 +3323,19 @@ class VitaSocket {
             }
         }
 
-        void receiveData(int sockfd, struct sockaddr_in servaddr) {
+        void receiveData(int sockfd) {
+            placeThread("receiver", 0);
             uint8_t buffer[buffer_size];
-            socklen_t len = sizeof(servaddr);
 
             int buffers_per_gb = 1000000000 / buffer_size;
 
             while (running) {
-                int n = recv(sockfd, buffer, buffer_size, 0);
+                int64_t arrival_ns = 0;
+                uint32_t drops = static_cast<uint32_t>(legacy_stats.kernel_drops);
+                int n = receiveChunk(sockfd, buffer, buffer_size, arrival_ns, drops);
+                if (!running) {
+                    break;
+                }
                 if (n < 0) {
                     perror("recvfrom failed");
                     exit(EXIT_FAILURE);
@@ -512,16 +3349,27 @@ class VitaSocket {
                 if (shared_buffer.size() > (buffers_per_gb * buffer_size)){
                     std::cerr << "O" << std::endl << std::flush;
                     shared_buffer.clear();
+                    shared_arrivals.clear();
                 }
 
                 shared_buffer.resize(shared_buffer.size() + n); // Resize the vector
                 std::memcpy(shared_buffer.data() + shared_buffer.size() - n, buffer, n);
+                if (arrival_ns > 0) {
+                    shared_arrivals.add(shared_buffer.size(), arrival_ns);
+                }
+                legacy_stats.kernel_drops = drops;
+                if (n > 0) {
+                    legacy_stats.reads += 1;
+                    legacy_stats.bytes += n;
+                }
                 lock.unlock();
             }
             close(sockfd);
         }
 };
 
+// Left out when the file is included by the test suite
+#ifndef VITA_SOCKET_NO_MAIN
 int main() {
     // run_tcp("127.0.0.1", 5002);
     // run_udp("127.0.0.1", 5002);
@@ -542,14 +3390,14 @@ int main() {
         for (const auto& id : ids) {
             std::cout << id << " " << std::endl << std::flush;
             // std::vector<std::vector<uint8_t>> data = getStream(id)->getPacketData();
-            VitaStream* stream = vita_socket.getStream(id);
+            std::shared_ptr<VitaStream> stream = vita_socket.getStream(id);
             if (stream == nullptr) {
                 continue;
             }
             float seconds_of_data = stream->getSecondsOfData();
             std::cout << "Stream ID: " << id << " Seconds of data: " << seconds_of_data << std::endl;
-            std::vector<uint8_t> data = stream->getPacketData();
-            std::cout << "Data size bytes: " << data.size() << std::endl;
+            SampleView data = stream->drainPacketData();
+            std::cout << "Data size bytes: " << data.bytes << std::endl;
             // Flush the print buffer
             std::cout << std::flush;
         }
@@ -559,3 +3407,4 @@ int main() {
     vita_socket.join();
     return 0;
 }
+#endif